@@ -0,0 +1,170 @@
+"""
+Copyright (c) 2026 MPI-M, Clara Bayley
+
+
+----- CLEO -----
+File: majorant_sampling.py
+Project: boxmodelcollisions
+Created Date: Sunday 18th October 2026
+Author: Clara Bayley (CB)
+Additional Contributors:
+-----
+License: BSD 3-Clause "New" or "Revised" License
+https://opensource.org/licenses/BSD-3-Clause
+-----
+File Description:
+Script runs an ensemble of CLEO 0-D box models for collisions with selected collision
+kernels (e.g. Golovin's, Long's or Low and List's) with and without majorant sampling of
+super-droplet pairs and then compares the mass moments of each run. With the same seed,
+majorant sampling rejects only pairs which would not collide, so the mass moments of a
+serial build should agree (to within rounding error) with those from direct sampling.
+Exits with non-zero status if they do not. Initial super-droplets are synthetic, so no
+input binary files are needed.
+"""
+
+# %%
+### -------------------------------- IMPORTS ------------------------------- ###
+import argparse
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+from ruamel.yaml import YAML
+
+# %%
+### --------------------------- PARSE ARGUMENTS ---------------------------- ###
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "path2CLEO", type=Path, help="Absolute path to CLEO directory (for cleopy)"
+)
+parser.add_argument("path2build", type=Path, help="Absolute path to build directory")
+parser.add_argument(
+    "src_config_filename",
+    type=Path,
+    help="Absolute path to source (ensemble) configuration YAML file",
+)
+parser.add_argument(
+    "--kernels",
+    nargs="*",
+    choices=["golovin", "long", "lowlist"],
+    type=str,
+    help="kernel examples to run",
+)
+parser.add_argument(
+    "--do_run_executable",
+    action="store_true",  # default is False
+    help="Run executable with and without majorant sampling",
+)
+parser.add_argument(
+    "--do_compare_results",
+    action="store_true",  # default is False
+    help="Compare mass moments of runs with and without majorant sampling",
+)
+parser.add_argument(
+    "--rtol",
+    type=float,
+    default=1e-12,
+    help="Maximum allowed relative difference of mass moments (default 1e-12)",
+)
+args = parser.parse_args()
+
+# %%
+### -------------------------- INPUT PARAMETERS ---------------------------- ###
+### --- command line parsed arguments --- ###
+path2CLEO = args.path2CLEO
+path2build = args.path2build
+src_config_filename = args.src_config_filename
+kernels = args.kernels
+
+### --- additional/derived arguments --- ###
+tmppath = path2build / "tmp"
+binpath = path2build / "bin"
+
+samplings = {"direct": False, "majorant": True}  # sampling: majorant_sampling
+
+kernel_configs = {}  # kernel: {sampling: [config_filename, config_params]}
+for k in kernels:
+    kernel_configs[k] = {}
+    for s, is_majorant in samplings.items():
+        cf = tmppath / f"majorant_sampling_{k}_{s}_config.yaml"
+        cp = {
+            "constants_filename": str(path2CLEO / "libs" / "cleoconstants.hpp"),
+            "majorant_sampling": is_majorant,
+            "setup_filename": str(binpath / f"majorant_sampling_{k}_{s}_setup.txt"),
+            "zarrbasedir": str(binpath / f"majorant_sampling_{k}_{s}_sol.zarr"),
+        }
+        kernel_configs[k][s] = [cf, cp]
+
+executables = {
+    "golovin": "golcolls",
+    "long": "longcolls",
+    "lowlist": "lowlistcolls",
+}
+
+
+# %%
+### ------------------------- FUNCTION DEFINITIONS ------------------------- ###
+def write_config(src_config_filename, config_filename, config_params):
+    from cleopy import editconfigfile
+
+    ### --- copy src_config_filename into tmp and edit parameters --- ###
+    config_filename.unlink(missing_ok=True)  # delete any existing config
+    shutil.copy(src_config_filename, config_filename)
+    editconfigfile.edit_config_params(config_filename, config_params)
+
+
+def run_exectuable(executable, config_filename):
+    ### --- delete any existing output dataset and setup files --- ###
+    yaml = YAML()
+    with open(config_filename, "r") as file:
+        config = yaml.load(file)
+    Path(config["outputdata"]["setup_filename"]).unlink(missing_ok=True)
+    shutil.rmtree(Path(config["outputdata"]["zarrbasedir"]), ignore_errors=True)
+
+    ### --- run exectuable with given config file --- ###
+    cmd = [executable, config_filename]
+    print(" ".join([str(c) for c in cmd]))
+    subprocess.run(cmd, check=True)
+
+
+def compare_results(path2CLEO, reference_config, test_config, rtol):
+    compare_script = path2CLEO / "scripts" / "compare_massmoments_script.py"
+    python = sys.executable
+
+    yaml = YAML()
+    datasets = []
+    for config_filename in [reference_config, test_config]:
+        with open(config_filename, "r") as file:
+            config = yaml.load(file)
+        datasets.append(Path(config["outputdata"]["zarrbasedir"]))
+
+    cmd = [python, compare_script, datasets[0], datasets[1], f"--rtol={rtol}"]
+    print(" ".join([str(c) for c in cmd]))
+    return subprocess.run(cmd).returncode == 0
+
+
+# %%
+### --------------------- RUN EXAMPLE FOR EACH KERNEL ---------------------- ###
+tmppath.mkdir(parents=True, exist_ok=True)
+binpath.mkdir(parents=True, exist_ok=True)
+
+is_agreement = True
+for kernel, configs in kernel_configs.items():
+    if args.do_run_executable:
+        executable = (
+            path2build / "examples" / "boxmodelcollisions" / "src" / executables[kernel]
+        )
+        for config_filename, config_params in configs.values():
+            write_config(src_config_filename, config_filename, config_params)
+            run_exectuable(executable, config_filename)
+
+    if args.do_compare_results:
+        reference_config = configs["direct"][0]
+        test_config = configs["majorant"][0]
+        is_agreement &= compare_results(
+            path2CLEO, reference_config, test_config, args.rtol
+        )
+
+if not is_agreement:
+    print("mass moments with and without majorant sampling do not agree")
+    sys.exit(1)
@@ -26,9 +26,12 @@ struct GolovinCreateMicrophysics {
   MicrophysicalProcess auto operator()(const Config& config, const Timesteps& tsteps) const {
     const auto c = config.get_collisions();
 
+    const auto sampling = c.majorant_sampling ? PairSampling::majorant : PairSampling::direct;
+
     const PairProbability auto prob = GolovinProb();
     const MicrophysicalProcess auto colls =
-        CollCoal(tsteps.get_collstep(), &step2realtime, prob, c.seed);
+        CollCoal(tsteps.get_collstep(), &step2realtime, prob, c.seed, sampling,
+                 ensemble_collision_seeds(config));
     return colls;
   }
 };
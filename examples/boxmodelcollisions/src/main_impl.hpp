@@ -15,6 +15,8 @@
  * File Description:
  * Common setup across all executables of CLEO super-droplet model (SDM) for 0-D box model
  * "boxmodelcollisions" examples (each with it's own microphysics, e.g. different collision kernel).
+ * If the configuration has an "ensemble" section, an ensemble of independent box models, each
+ * with its own (synthetic) initial super-droplets, is run as the gridboxes of one domain.
  * After make/compiling each executable, execute for example via e.g.
  * ./src/golcolls ../src/config/config.yaml
  */
@@ -25,25 +27,32 @@
 #include <Kokkos_Core.hpp>
 #include <cmath>
 #include <concepts>
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 #include "cartesiandomain/cartesianmaps.hpp"
 #include "cartesiandomain/createcartesianmaps.hpp"
 #include "cartesiandomain/movement/cartesian_movement.hpp"
+#include "cleoconstants.hpp"
 #include "configuration/communicator.hpp"
 #include "configuration/config.hpp"
 #include "coupldyn_null/nulldynamics.hpp"
 #include "coupldyn_null/nulldyncomms.hpp"
 #include "gridboxes/boundary_conditions.hpp"
 #include "gridboxes/gridboxmaps.hpp"
+#include "initialise/gbx_bounds_from_binary.hpp"
 #include "initialise/init_all_supers_from_binary.hpp"
+#include "initialise/init_supers_synthetic.hpp"
 #include "initialise/initgbxsnull.hpp"
 #include "initialise/initialconditions.hpp"
 #include "initialise/timesteps.hpp"
 #include "observers/collect_data_for_simple_dataset.hpp"
 #include "observers/gbxindex_observer.hpp"
+#include "observers/massmoments_observer.hpp"
+#include "observers/nsupers_observer.hpp"
 #include "observers/observers.hpp"
 #include "observers/streamout_observer.hpp"
 #include "observers/superdrops_observer.hpp"
@@ -65,12 +74,62 @@ inline InitialConditions auto create_initconds(const Config& config, const GbxMa
   return InitConds(initsupers, initgbxs);
 }
 
+/* returns initial conditions for ensemble of box models where the super-droplets in each member
+(i.e. gridbox) are generated from the synthetic initsupers configuration, or from the member's
+own initsupers parameters if given by the ensemble configuration */
+inline InitialConditions auto create_ensemble_initconds(const Config& config,
+                                                        const GbxBoundsFromBinary& gfb,
+                                                        const CartesianMaps& gbxmaps) {
+  auto params = config.get_initsuperssynthetic();
+  auto members = config.get_ensemble().members;
+  params.nspacedims = 1;  // members are arranged along coord3
+  for (auto& m : members) {
+    m.nspacedims = 1;
+  }
+
+  const auto initsupers = InitSupersSynthetic(params, gfb, gbxmaps, members);
+  const auto initgbxs = InitGbxsNull(gbxmaps.get_local_ngridboxes_hostcopy());
+
+  return InitConds(initsupers, initgbxs);
+}
+
+/* returns seed for the collisions of each member of the ensemble (in order of gridbox index),
+i.e. the seed of each member's initsupers, or an empty vector if there is no ensemble. Used by
+microphysics with a fixed seed so that each member's collisions are seeded independently */
+inline std::vector<uint64_t> ensemble_collision_seeds(const Config& config) {
+  const auto ensemble = config.get_ensemble();
+  if (ensemble.nmembers == 0) {
+    return {};
+  }
+
+  auto seeds = std::vector<uint64_t>(ensemble.nmembers, config.get_initsuperssynthetic().seed);
+  for (size_t m(0); m < ensemble.members.size(); ++m) {
+    seeds.at(m) = ensemble.members.at(m).seed;
+  }
+  return seeds;
+}
+
 inline GridboxMaps auto create_gbxmaps(const Config& config) {
+  check_lexicographic_gridbox_ordering(config.get_gridbox_ordering());
   const auto gbxmaps = create_cartesian_maps(config.get_ngbxs(), config.get_nspacedims(),
                                              config.get_grid_filename());
   return gbxmaps;
 }
 
+/* returns bounds of gridboxes for an ensemble of box models, i.e. a 1-D domain (along coord3)
+with one cubic gridbox of volume VOLUME for every member of the ensemble */
+inline GbxBoundsFromBinary create_ensemble_gbxbounds(const Config& config) {
+  const auto ensemble = config.get_ensemble();
+  if (config.get_initsuperssynthetic().nsupers_per_gbx == 0) {
+    throw std::invalid_argument("ensemble requires initsupers of type 'synthetic'");
+  }
+
+  const auto length = std::cbrt(ensemble.VOLUME) / dimless_constants::COORD0;
+  const auto ndims = std::vector<size_t>{ensemble.nmembers, 1, 1};
+
+  return GbxBoundsFromBinary(ndims, {length, length, length}, 1);
+}
+
 inline auto create_movement(const CartesianMaps& gbxmaps) {
   const Motion<CartesianMaps> auto motion = NullMotion{};
   const BoundaryConditions<CartesianMaps> auto boundary_conditions = NullBoundaryConditions{};
@@ -105,18 +164,106 @@ inline Observer auto create_observer(const Config& config, const Timesteps& tste
   return obssd >> obs1 >> obs0;
 }
 
-template <typename Dataset, typename Store, typename CreateMicrophysics>
-inline auto create_sdm(const Config& config, const Timesteps& tsteps, Dataset& dataset,
-                       Store& store, const CreateMicrophysics create_microphysics) {
+/* as create_superdrops_observer but also outputs super-droplets' gridbox indexes, i.e. the
+ensemble member each super-droplet belongs to */
+template <typename Dataset, typename Store>
+inline Observer auto create_ensemble_superdrops_observer(const unsigned int interval,
+                                                         Dataset& dataset, Store& store,
+                                                         const int maxchunk) {
+  CollectDataForDataset<Dataset> auto sdgbxindex = CollectSdgbxindex(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto sdid = CollectSdId(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto xi = CollectXi(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto radius = CollectRadius(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto msol = CollectMsol(dataset, maxchunk);
+
+  const auto collect_sddata = msol >> radius >> xi >> sdid >> sdgbxindex;
+  return SuperdropsObserver(interval, dataset, store, maxchunk, collect_sddata);
+}
+
+/* observer for ensemble of box models which, in addition to the super-droplets' data (with
+their member), outputs the mass moments and number of super-droplets of each member */
+template <typename Dataset, typename Store>
+inline Observer auto create_ensemble_observer(const Config& config, const Timesteps& tsteps,
+                                              Dataset& dataset, Store& store,
+                                              const size_t nmembers) {
+  const auto obsstep = tsteps.get_obsstep();
+  const auto maxchunk = config.get_maxchunk();
+
+  const Observer auto obs0 = StreamOutObserver(obsstep, &step2realtime);
+
+  const Observer auto obs1 = TimeObserver(obsstep, dataset, store, maxchunk, &step2dimlesstime);
+
+  const Observer auto obs2 = GbxindexObserver(dataset, store, maxchunk, nmembers);
+
+  const Observer auto obs3 = MassMomentsObserver(obsstep, dataset, store, maxchunk, nmembers);
+
+  const Observer auto obs4 = NsupersObserver(obsstep, dataset, maxchunk, nmembers);
+
+  const Observer auto obssd =
+      create_ensemble_superdrops_observer(obsstep, dataset, store, maxchunk);
+
+  return obssd >> obs4 >> obs3 >> obs2 >> obs1 >> obs0;
+}
+
+template <typename CreateMicrophysics>
+inline auto create_sdm(const Config& config, const Timesteps& tsteps, const CartesianMaps& gbxmaps,
+                       const Observer auto obs, const CreateMicrophysics create_microphysics) {
   const auto couplstep = (unsigned int)tsteps.get_couplstep();
-  const GridboxMaps auto gbxmaps = create_gbxmaps(config);
   const MicrophysicalProcess auto microphys = create_microphysics(config, tsteps);
   const MoveSupersInDomain movesupers = create_movement(gbxmaps);
-  const Observer auto obs = create_observer(config, tsteps, dataset, store);
 
   return SDMMethods(couplstep, gbxmaps, microphys, movesupers, obs);
 }
 
+/* runs CLEO SDM coupled to null dynamics from the given initial conditions */
+template <typename SDM>
+inline void run_cleo(const Timesteps& tsteps, const SDM& sdm,
+                     const InitialConditions auto& initconds) {
+  /* Create coupldyn solver and coupling between coupldyn and SDM */
+  const CoupledDynamics auto coupldyn = NullDynamics(tsteps.get_couplstep());
+  const CouplingComms<CartesianMaps, NullDynamics> auto comms = NullDynComms{};
+
+  /* Run CLEO (SDM coupled to dynamics solver) */
+  const RunCLEO runcleo(sdm, coupldyn, comms);
+  runcleo(initconds, tsteps.get_t_end());
+}
+
+/* runs single box model, i.e. domain with one gridbox */
+template <typename Dataset, typename Store, typename CreateMicrophysics>
+inline void run_boxmodel(const Config& config, const Timesteps& tsteps, Dataset& dataset,
+                         Store& store, const CreateMicrophysics create_microphysics) {
+  /* CLEO Super-Droplet Model (excluding coupled dynamics solver) */
+  const GridboxMaps auto gbxmaps = create_gbxmaps(config);
+  const Observer auto obs = create_observer(config, tsteps, dataset, store);
+  const SDMMethods sdm = create_sdm(config, tsteps, gbxmaps, obs, create_microphysics);
+
+  /* Initial conditions for CLEO run */
+  const InitialConditions auto initconds = create_initconds(config, sdm.gbxmaps);
+
+  run_cleo(tsteps, sdm, initconds);
+}
+
+/* runs ensemble of independent box models as the gridboxes of one domain. Super-droplets never
+move between gridboxes so each gridbox evolves independently. If the microphysics has a fixed
+seed, collisions in each member are also seeded by the member's own seed (see
+ensemble_collision_seeds), otherwise their random numbers are drawn from one shared pool. */
+template <typename Dataset, typename Store, typename CreateMicrophysics>
+inline void run_ensemble(const Config& config, const Timesteps& tsteps, Dataset& dataset,
+                         Store& store, const CreateMicrophysics create_microphysics) {
+  const auto nmembers = config.get_ensemble().nmembers;
+
+  /* CLEO Super-Droplet Model (excluding coupled dynamics solver) */
+  const auto gfb = create_ensemble_gbxbounds(config);
+  const GridboxMaps auto gbxmaps = create_cartesian_maps_from_bounds(1, gfb);
+  const Observer auto obs = create_ensemble_observer(config, tsteps, dataset, store, nmembers);
+  const SDMMethods sdm = create_sdm(config, tsteps, gbxmaps, obs, create_microphysics);
+
+  /* Initial conditions for CLEO run */
+  const InitialConditions auto initconds = create_ensemble_initconds(config, gfb, gbxmaps);
+
+  run_cleo(tsteps, sdm, initconds);
+}
+
 template <typename CreateMicrophysics>
 inline int generic_microphysics_main(int argc, char* argv[],
                                      const CreateMicrophysics create_microphysics) {
@@ -150,21 +297,16 @@ inline int generic_microphysics_main(int argc, char* argv[],
 
     /* Create Xarray dataset wit Zarr backend for writing output data to a store */
     auto store = FSStore(config.get_zarrbasedir());
-    auto dataset = SimpleDataset(store);
-
-    /* CLEO Super-Droplet Model (excluding coupled dynamics solver) */
-    const SDMMethods sdm = create_sdm(config, tsteps, dataset, store, create_microphysics);
-
-    /* Create coupldyn solver and coupling between coupldyn and SDM */
-    const CoupledDynamics auto coupldyn = NullDynamics(tsteps.get_couplstep());
-    const CouplingComms<CartesianMaps, NullDynamics> auto comms = NullDynComms{};
-
-    /* Initial conditions for CLEO run */
-    const InitialConditions auto initconds = create_initconds(config, sdm.gbxmaps);
-
-    /* Run CLEO (SDM coupled to dynamics solver) */
-    const RunCLEO runcleo(sdm, coupldyn, comms);
-    runcleo(initconds, tsteps.get_t_end());
+    auto dataset = SimpleDataset(store, config.get_shard_nchunks(),
+                                 config.get_metadata_commit_nobs(),
+                                 config.get_crash_safe_metadata());
+
+    /* Run CLEO as single box model or as ensemble of box models */
+    if (config.get_ensemble().nmembers > 0) {
+      run_ensemble(config, tsteps, dataset, store, create_microphysics);
+    } else {
+      run_boxmodel(config, tsteps, dataset, store, create_microphysics);
+    }
   }
   Kokkos::finalize();
 
@@ -24,9 +24,15 @@
 
 struct LongHydroCreateMicrophysics {
   inline MicrophysicalProcess auto operator()(const Config& config, const Timesteps& tsteps) const {
+    const auto c = config.get_collisions();
+    const auto sampling = c.majorant_sampling ? PairSampling::majorant : PairSampling::direct;
+
     const PairProbability auto prob = LongHydroProb();  // assumes coaleff = 1.0
-    const MicrophysicalProcess auto colls = CollCoal(tsteps.get_collstep(), &step2realtime, prob);
-    return colls;
+    if (c.seed != NaNVals::sizet()) {  // fixed seed (for reproducibility)
+      return CollCoal(tsteps.get_collstep(), &step2realtime, prob, c.seed, sampling,
+                      ensemble_collision_seeds(config));
+    }
+    return CollCoal(tsteps.get_collstep(), &step2realtime, prob, sampling);
   }
 };
 
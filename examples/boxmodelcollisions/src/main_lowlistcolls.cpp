@@ -27,15 +27,26 @@
 struct LowListCreateMicrophysics {
   MicrophysicalProcess auto operator()(const Config& config, const Timesteps& tsteps) const {
     const auto c = config.get_breakup();
+    const auto colls = config.get_collisions();
+    const auto sampling = colls.majorant_sampling ? PairSampling::majorant : PairSampling::direct;
+
     const PairProbability auto buprob = LowListBuProb(RogersGKTerminalVelocity{});
     const NFragments auto nfrags = ConstNFrags(c.constnfrags.nfrags);
-    const MicrophysicalProcess auto bu =
-        CollBu(tsteps.get_collstep(), &step2realtime, buprob, nfrags);
-
     const PairProbability auto coalprob = LowListCoalProb(RogersGKTerminalVelocity{});
-    const MicrophysicalProcess auto coal =
-        CollCoal(tsteps.get_collstep(), &step2realtime, coalprob);
 
+    if (colls.seed != NaNVals::sizet()) {  // fixed (different) seeds (for reproducibility)
+      const auto gbxseeds = ensemble_collision_seeds(config);
+      const MicrophysicalProcess auto bu = CollBu(tsteps.get_collstep(), &step2realtime, buprob,
+                                                  nfrags, colls.seed + 1, sampling, gbxseeds);
+      const MicrophysicalProcess auto coal = CollCoal(tsteps.get_collstep(), &step2realtime,
+                                                      coalprob, colls.seed, sampling, gbxseeds);
+      return coal >> bu;
+    }
+
+    const MicrophysicalProcess auto bu =
+        CollBu(tsteps.get_collstep(), &step2realtime, buprob, nfrags, sampling);
+    const MicrophysicalProcess auto coal =
+        CollCoal(tsteps.get_collstep(), &step2realtime, coalprob, sampling);
     return coal >> bu;
   }
 };
@@ -77,6 +77,7 @@ inline InitialConditions auto create_initconds(const Config& config, const GbxMa
 }
 
 inline GridboxMaps auto create_gbxmaps(const Config& config) {
+  check_lexicographic_gridbox_ordering(config.get_gridbox_ordering());
   const auto gbxmaps = create_cartesian_maps(config.get_ngbxs(), config.get_nspacedims(),
                                              config.get_grid_filename());
   return gbxmaps;
@@ -166,7 +167,9 @@ int main(int argc, char* argv[]) {
 
     /* Create Xarray dataset wit Zarr backend for writing output data to a store */
     auto store = FSStore(config.get_zarrbasedir());
-    auto dataset = CollectiveDataset<FSStore, CartesianDecomposition>(store);
+    auto dataset = CollectiveDataset<FSStore, CartesianDecomposition>(
+        store, config.get_shard_nchunks(), config.get_metadata_commit_nobs(),
+        config.get_crash_safe_metadata());
 
     /* CLEO Super-Droplet Model (excluding coupled dynamics solver) */
     const SDMMethods sdm = create_sdm(config, tsteps, dataset, store);
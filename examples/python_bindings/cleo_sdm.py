@@ -86,7 +86,10 @@ def prepare_to_timestep_sdm(cleo, cleo_config, sdm):
         cleo_config.get_initsupersfrombinary(), sdm.gbxmaps
     )
     allsupers = cleo.create_supers_from_binary(
-        initsupers, sdm.gbxmaps.get_local_ngridboxes_hostcopy()
+        initsupers,
+        sdm.gbxmaps.get_local_ngridboxes_hostcopy(),
+        cleo_config.get_sort_supers_method(),
+        cleo_config.get_max_supers_capacity(),
     )
 
     print("CLEO STATUS: creating gridboxes")
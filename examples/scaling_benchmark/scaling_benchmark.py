@@ -0,0 +1,144 @@
+"""
+Copyright (c) 2026 MPI-M, Clara Bayley
+
+
+----- CLEO -----
+File: scaling_benchmark.py
+Project: scaling_benchmark
+Created Date: Sunday 18th October 2026
+Author: Clara Bayley (CB)
+Additional Contributors:
+-----
+License: BSD 3-Clause "New" or "Revised" License
+https://opensource.org/licenses/BSD-3-Clause
+-----
+File Description:
+Script runs CLEO executable "scaling_benchmark" for a sweep over the number of MPI
+processes and threads. No input files are needed, the benchmark generates its own grid
+and super-droplets. Timings of each run are appended to the benchmark's summary CSV
+file (see config).
+"""
+
+# %%
+### -------------------------------- IMPORTS ------------------------------- ###
+import argparse
+import os
+import shutil
+import subprocess
+from pathlib import Path
+
+# %%
+### --------------------------- PARSE ARGUMENTS ---------------------------- ###
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "path2CLEO", type=Path, help="Absolute path to CLEO directory (for cleopy)"
+)
+parser.add_argument("path2build", type=Path, help="Absolute path to build directory")
+parser.add_argument(
+    "src_config_filename",
+    type=Path,
+    help="Absolute path to source configuration YAML file",
+)
+parser.add_argument(
+    "--scaling",
+    type=str,
+    choices=["strong", "weak"],
+    default="strong",
+    help="Type of scaling benchmark",
+)
+parser.add_argument(
+    "--gridbox_ordering",
+    type=str,
+    choices=["lexicographic", "morton"],
+    default="lexicographic",
+    help="Order of gridboxes (and super-droplets) in memory",
+)
+parser.add_argument(
+    "--sort_supers_method",
+    type=str,
+    choices=["counting_sort", "inplace"],
+    default="counting_sort",
+    help="Method for sorting super-droplets",
+)
+parser.add_argument(
+    "--nranks",
+    type=int,
+    nargs="+",
+    default=[1, 2, 4],
+    help="Number(s) of MPI processes to run benchmark with",
+)
+parser.add_argument(
+    "--nthreads",
+    type=int,
+    nargs="+",
+    default=[1, 2, 4, 8],
+    help="Number(s) of threads per MPI process to run benchmark with",
+)
+parser.add_argument(
+    "--mpiexec",
+    type=str,
+    default="mpiexec",
+    help="Command to launch MPI processes",
+)
+args = parser.parse_args()
+
+# %%
+### -------------------------- INPUT PARAMETERS ---------------------------- ###
+### --- command line parsed arguments --- ###
+path2CLEO = args.path2CLEO
+path2build = args.path2build
+src_config_filename = args.src_config_filename
+
+### --- additional/derived arguments --- ###
+tmppath = path2build / "tmp"
+binpath = path2build / "bin" / "scaling_benchmark"
+
+config_filename = tmppath / "scaling_benchmark_config.yaml"
+config_params = {
+    "constants_filename": str(path2CLEO / "libs" / "cleoconstants.hpp"),
+    "setup_filename": str(binpath / "setup.txt"),
+    "zarrbasedir": str(binpath / "sol.zarr"),
+    "scaling": args.scaling,
+    "gridbox_ordering": args.gridbox_ordering,
+    "sort_supers_method": args.sort_supers_method,
+    "performance_filename": str(binpath / "timings.csv"),
+}
+
+
+# %%
+### ------------------------- FUNCTION DEFINITIONS ------------------------- ###
+def configfile(path2CLEO, path2build, tmppath, binpath, config_filename, config_params):
+    from cleopy import editconfigfile
+
+    ### --- ensure build, tmp and bin directories exist --- ###
+    if path2CLEO == path2build:
+        raise ValueError("build directory cannot be CLEO")
+    path2build.mkdir(exist_ok=True)
+    tmppath.mkdir(exist_ok=True)
+    binpath.mkdir(parents=True, exist_ok=True)
+
+    ### --- copy src_config_filename into tmp and edit parameters --- ###
+    config_filename.unlink(missing_ok=True)  # delete any existing config
+    shutil.copy(src_config_filename, config_filename)
+    editconfigfile.edit_config_params(config_filename, config_params)
+
+
+def run_exectuable(path2build, config_filename, mpiexec, nranks, nthreads):
+    from cleopy import editconfigfile
+
+    executable = (
+        path2build / "examples" / "scaling_benchmark" / "src" / "scaling_benchmark"
+    )
+    for nt in nthreads:
+        editconfigfile.edit_config_params(config_filename, {"num_threads": nt})
+        env = dict(os.environ, OMP_NUM_THREADS=str(nt))
+        for nr in nranks:
+            cmd = [mpiexec, "-n", str(nr), executable, config_filename]
+            print(" ".join([str(c) for c in cmd]))
+            subprocess.run(cmd, check=True, env=env)
+
+
+# %%
+### ---------------------------- RUN BENCHMARK ----------------------------- ###
+configfile(path2CLEO, path2build, tmppath, binpath, config_filename, config_params)
+run_exectuable(path2build, config_filename, args.mpiexec, args.nranks, args.nthreads)
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: main_scaling_benchmark.cpp
+ * Project: src
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * runs a self-contained benchmark of CLEO super-droplet model (SDM) with a uniform grid and
+ * super-droplets generated from parameters in the configuration file (i.e. without any input
+ * files). Microphysics, terminal velocity and boundary conditions are chosen by the "driver"
+ * configuration, as for the generic CLEO driver, and SDM is coupled to null dynamics. Time spent
+ * in each stage of the model is recorded by a PerformanceObserver and a summary of the run is
+ * appended to a CSV file. For strong scaling the domain is the same for any number of MPI
+ * processes, for weak scaling the domain grows with the number of processes.
+ * After make/compiling, execute for example via:
+ * mpiexec -n 4 ./examples/scaling_benchmark/src/scaling_benchmark ../src/config/config.yaml
+ */
+
+#include <mpi.h>
+
+#include <Kokkos_Core.hpp>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cartesiandomain/cartesianmaps.hpp"
+#include "cartesiandomain/createcartesianmaps.hpp"
+#include "cleo_driver/sdm_from_config.hpp"
+#include "cleoconstants.hpp"
+#include "configuration/communicator.hpp"
+#include "configuration/config.hpp"
+#include "coupldyn_null/nulldynamics.hpp"
+#include "coupldyn_null/nulldyncomms.hpp"
+#include "gridboxes/boundary_conditions.hpp"
+#include "gridboxes/gridboxmaps.hpp"
+#include "gridboxes/sortsupers.hpp"
+#include "initialise/gbx_bounds_from_binary.hpp"
+#include "initialise/init_supers_synthetic.hpp"
+#include "initialise/initgbxs_uniform.hpp"
+#include "initialise/initialconditions.hpp"
+#include "initialise/timesteps.hpp"
+#include "observers/observers.hpp"
+#include "observers/performance_observer.hpp"
+#include "observers/streamout_observer.hpp"
+#include "runcleo/coupleddynamics.hpp"
+#include "runcleo/couplingcomms.hpp"
+#include "runcleo/runcleo.hpp"
+#include "runcleo/sdmmethods.hpp"
+#include "superdrops/microphysicalprocess.hpp"
+#include "superdrops/terminalvelocity.hpp"
+
+/* returns number of gridboxes in [coord3, coord1, coord2] dimensions of the (global) domain.
+For strong scaling this is ndims of the benchmark configuration, for weak scaling ndims is the
+number of gridboxes for each process and the domain is extended in the coord1 direction (or
+coord3 direction for a 1-D model) by the number of processes */
+std::vector<size_t> global_ndims(const Config& config) {
+  const auto benchmark = config.get_benchmark();
+  auto ndims = benchmark.ndims;
+
+  if (benchmark.scaling == "weak") {
+    const auto comm_size = static_cast<size_t>(init_communicator::get_comm_size());
+    const auto nspacedims = config.get_nspacedims();
+    if (nspacedims == 0 && comm_size > 1) {
+      throw std::invalid_argument("weak scaling of 0-D model not possible with > 1 MPI process");
+    }
+    const auto d = (nspacedims == 1) ? 0 : 1;  // dimension to extend (coord3 or coord1)
+    ndims.at(d) *= comm_size;
+  }
+
+  return ndims;
+}
+
+/* returns gridbox boundaries for a uniform grid given by the benchmark configuration */
+GbxBoundsFromBinary create_gbxbounds(const Config& config) {
+  const auto benchmark = config.get_benchmark();
+  if (benchmark.gbxsizes.size() != 3) {
+    throw std::invalid_argument("benchmark configuration parameters not set");
+  }
+  if (config.get_initsuperssynthetic().nsupers_per_gbx == 0) {
+    throw std::invalid_argument("benchmark requires initsupers of type 'synthetic'");
+  }
+
+  const auto gbxsizes = std::array<double, 3>{benchmark.gbxsizes.at(0) / dlc::COORD0,
+                                              benchmark.gbxsizes.at(1) / dlc::COORD0,
+                                              benchmark.gbxsizes.at(2) / dlc::COORD0};
+
+  return GbxBoundsFromBinary(global_ndims(config), gbxsizes, config.get_nspacedims());
+}
+
+/* returns name of files for timings of stages of benchmark for given number of MPI processes and
+threads, i.e. performance_filename with e.g. "_strong_np4_nt8" appended to its stem */
+std::filesystem::path performance_filename(const Config& config, const int nranks,
+                                           const int nthreads) {
+  const auto benchmark = config.get_benchmark();
+  auto filename = benchmark.performance_filename;
+  const auto suffix = "_" + benchmark.scaling + "_np" + std::to_string(nranks) + "_nt" +
+                      std::to_string(nthreads) + filename.extension().string();
+  return filename.replace_filename(filename.stem().string() + suffix);
+}
+
+inline Observer auto create_observer(const Timesteps& tsteps,
+                                     const std::filesystem::path filename) {
+  const auto obsstep = tsteps.get_obsstep();
+
+  const Observer auto obs0 = StreamOutObserver(obsstep, &step2realtime);
+
+  const Observer auto obs1 = PerformanceObserver(obsstep, &step2realtime, filename);
+
+  return obs1 >> obs0;
+}
+
+/* creates CLEO SDM with uniform grid and the given microphysics, terminal velocity and boundary
+conditions (chosen by the driver configuration) and then runs it coupled to null dynamics with
+synthetic initial conditions. */
+template <MicrophysicalProcess Microphys, VelocityFormula TV,
+          BoundaryConditions<CartesianMaps> BCs>
+inline void run_benchmark(const Config& config, const Timesteps& tsteps,
+                          const GbxBoundsFromBinary& gfb, const std::filesystem::path filename,
+                          const Microphys microphys, const TV terminalv,
+                          const BCs boundary_conditions) {
+  const auto couplstep = (unsigned int)tsteps.get_couplstep();
+  const auto t_end = (unsigned int)tsteps.get_t_end();
+
+  /* CLEO Super-Droplet Model (excluding coupled dynamics solver) */
+  const GridboxMaps auto gbxmaps = create_cartesian_maps_from_bounds(
+      config.get_nspacedims(), gfb, config.get_gridbox_ordering());
+  const MoveSupersInDomain movesupers =
+      create_movement(tsteps, gbxmaps, terminalv, boundary_conditions);
+  const Observer auto obs = create_observer(tsteps, filename);
+  const SDMMethods sdm(couplstep, gbxmaps, microphys, movesupers, obs);
+
+  /* Solver of dynamics coupled to CLEO SDM and coupling between them */
+  CoupledDynamics auto coupldyn = NullDynamics(couplstep);
+  const CouplingComms<CartesianMaps, NullDynamics> auto comms = NullDynComms{};
+
+  /* Initial conditions for CLEO run */
+  const auto benchmark = config.get_benchmark();
+  const auto initsupers = InitSupersSynthetic(config.get_initsuperssynthetic(), gfb, sdm.gbxmaps);
+  const auto initgbxs = InitGbxsUniform(sdm.gbxmaps.get_local_ngridboxes_hostcopy(),
+                                        benchmark.P_init, benchmark.TEMP_init, benchmark.relh_init);
+  const InitialConditions auto initconds = InitConds(initsupers, initgbxs);
+
+  /* Run CLEO (SDM coupled to dynamics solver) */
+  const auto sort_method = sort_supers_method(config.get_sort_supers_method());
+  const RunCLEO runcleo(sdm, coupldyn, comms, sort_method, config.get_max_supers_capacity());
+  runcleo(initconds, t_end);
+}
+
+/* appends summary of benchmark (on process 0) to CSV file called performance_filename with
+"_summary.csv" appended to its stem. Time is maximum over all processes. */
+void write_summary(const Config& config, const int nranks, const int nthreads, const size_t ngbxs,
+                   const double walltime) {
+  auto maxtime = walltime;
+  MPI_Allreduce(&walltime, &maxtime, 1, MPI_DOUBLE, MPI_MAX, init_communicator::get_communicator());
+  if (init_communicator::get_comm_rank() != 0) {
+    return;
+  }
+
+  const auto benchmark = config.get_benchmark();
+  const auto tsteps = config.get_timesteps();
+  const auto nsupers = ngbxs * config.get_initsuperssynthetic().nsupers_per_gbx;
+  const auto nsteps = static_cast<size_t>(tsteps.T_END / tsteps.COUPLTSTEP);
+
+  auto filename = benchmark.performance_filename;
+  filename.replace_filename(filename.stem().string() + "_summary.csv");
+  const auto is_new = !std::filesystem::exists(filename);
+
+  std::ofstream file(filename, std::ios::app);
+  if (is_new) {
+    file << "scaling,nranks,nthreads,nspacedims,ngbxs,nsupers,nsteps,walltime[s]\n";
+  }
+  file << benchmark.scaling << "," << nranks << "," << nthreads << "," << config.get_nspacedims()
+       << "," << ngbxs << "," << nsupers << "," << nsteps << "," << maxtime << "\n";
+
+  std::cout << "-----\n CLEO Benchmark (" << benchmark.scaling << " scaling): " << nranks
+            << " MPI processes, " << nthreads << " threads, " << ngbxs << " gridboxes, " << nsupers
+            << " superdroplets, " << nsteps << " steps, " << maxtime << "s \n-----\n";
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    throw std::invalid_argument("configuration file(s) not specified");
+  }
+
+  Kokkos::Timer kokkostimer;
+
+  /* Read input parameters from configuration file(s) */
+  const std::filesystem::path config_filename(argv[1]);  // path to configuration file
+  const Config config(config_filename);
+
+  /* Initialize Communicator here */
+  init_communicator init_comm(argc, argv, config);
+
+  /* Initialise Kokkos parallel environment */
+  Kokkos::initialize(config.get_kokkos_initialization_settings());
+  {
+    Kokkos::print_configuration(std::cout);
+
+    /* Create timestepping parameters from configuration */
+    const Timesteps tsteps(config.get_timesteps());
+
+    /* Uniform grid (for all processes) generated from the configuration */
+    const auto gfb = create_gbxbounds(config);
+
+    const auto nranks = init_communicator::get_comm_size();
+    const auto nthreads = Kokkos::DefaultHostExecutionSpace().concurrency();
+    const auto filename = performance_filename(config, nranks, nthreads);
+
+    /* Assemble CLEO as chosen by the configuration and run it */
+    Kokkos::Timer benchmarktimer;
+    with_microphysics(config, tsteps, [&](const auto microphys) {
+      with_terminal_velocity(config, [&](const auto terminalv) {
+        with_boundary_conditions(config, [&](const auto boundary_conditions) {
+          run_benchmark(config, tsteps, gfb, filename, microphys, terminalv, boundary_conditions);
+        });
+      });
+    });
+
+    write_summary(config, nranks, nthreads, gfb.get_ngbxs(), benchmarktimer.seconds());
+  }
+  Kokkos::finalize();
+
+  const auto ttot = double{kokkostimer.seconds()};
+  std::cout << "-----\n CLEO Total Program Duration: " << ttot << "s \n-----\n";
+
+  return 0;
+}
@@ -79,6 +79,8 @@ void CartesianDecomposition::set_gridbox_bounds(GbxBoundsFromBinary gfb) {
 // Defines if a dimension is periodic or finite
 void CartesianDecomposition::set_dimensions_bound_behavior(std::array<size_t, 3> behaviors) {
   dimension_bound_behavior = behaviors;
+  for (auto dimension : {0, 1, 2})
+    spatial_index.is_periodic[dimension] = (dimension_bound_behavior[dimension] != 0);
 }
 
 int CartesianDecomposition::get_partition_index_from_slice(std::array<int, 3> slice_indices) const {
@@ -106,97 +108,27 @@ bool CartesianDecomposition::check_indices_inside_partition(std::array<size_t, 3
   return inside;
 }
 
+// Given coordinates returns the local index of the gridbox which bounds them, the out of bounds
+// gridbox index if they are outside of a finite dimension of the domain, or otherwise encodes in
+// the return value which process owns the bounding gridbox. Coordinates outside of a periodic
+// dimension are corrected to go around the domain.
 unsigned int CartesianDecomposition::get_local_bounding_gridbox_index(
     std::array<double, 3>& coordinates) const {
-  // Spatial index coordinate of gridbox in each dimension given the superdroplet coordinates
-  std::array<size_t, 3> bounding_gridbox_index_coordinates;
-
-  std::array<int, 3> external_direction = {0, 0, 0};
-  bool local_coordinate = true;
-  auto partition_size = partition_sizes[my_rank];
-
-  for (auto dimension : {0, 1, 2}) {
-    // Tests whether the coordinate in that dimension is smaller than the
-    // beginning of the partition
-    if (coordinates[dimension] < gridbox_bounds[dimension].front()) {
-      // If the dimension behavior is finite and the coordinate is smaller than
-      // the beginning of the domain return the out_of_bounds value
-      if (dimension_bound_behavior[dimension] == 0 &&
-          coordinates[dimension] < domain_bounds[0][dimension]) {
-        return LIMITVALUES::oob_gbxindex;
-      }
-      // The coordinate is inside of the domain but outside of the partition in that dimension
-      external_direction[dimension] -= 1;
-      local_coordinate = false;
-
-      // Tests whether the coordinate for that dimension is larger than the end of the partition
-    } else if (coordinates[dimension] > gridbox_bounds[dimension].back()) {
-      // If the dimension behavior is finite and the coordinate is larger than
-      // the end of the domain return the out_of_bounds value
-
-      if (dimension_bound_behavior[dimension] == 0 &&
-          coordinates[dimension] > domain_bounds[1][dimension]) {
-        return LIMITVALUES::oob_gbxindex;
-      }
-
-      // The coordinate is inside of the domain but outside of the partition in that dimension
-      external_direction[dimension] += 1;
-      local_coordinate = false;
-      // If none of the tests above pass then the coordinate is inside of the
-      // partition in that dimension
-    } else if (local_coordinate) {
-      bounding_gridbox_index_coordinates[dimension] =
-          binary_search(coordinates, dimension, partition_size, gridbox_bounds);
-    }
-  }
-  // If the coordinate is inside of the partition in all dimensions, returns the
-  // index of its bounding gridbox
-  if (local_coordinate) {
-    return get_index_from_coordinates({get_local_partition_size()[0], get_local_partition_size()[1],
-                                       get_local_partition_size()[2]},
-                                      bounding_gridbox_index_coordinates[0],
-                                      bounding_gridbox_index_coordinates[1],
-                                      bounding_gridbox_index_coordinates[2]);
-
-    // Otherwise, the coordinate is outside of the partition
-  } else {
-    bool corrected = false;
-    for (auto dimension : {0, 1, 2}) {
-      // Since the finite dimensions have already been checked before,
-      // if the coordinate is outside of the domain for a dimension correct it to go around
-      if (coordinates[dimension] < domain_bounds[0][dimension]) {
-        coordinates[dimension] += (domain_bounds[1][dimension] - domain_bounds[0][dimension]);
-        corrected = true;
-      } else if (coordinates[dimension] > domain_bounds[1][dimension]) {
-        coordinates[dimension] -= (domain_bounds[1][dimension] - domain_bounds[0][dimension]);
-        corrected = true;
-      }
-    }
+  return spatial_index.local_bounding_gridbox_index(coordinates[0], coordinates[1],
+                                                    coordinates[2]);
+}
 
-    // If the coordinates have been corrected but the target partition is local
-    // then get the local bounding gridbox
-    if (corrected && neighboring_processes.at(external_direction) == my_rank)
-      return get_local_bounding_gridbox_index(coordinates);
+const spatial_indexh& CartesianDecomposition::get_spatial_index() const { return spatial_index; }
 
-    // If the coordinate is outside of the local partition, encode in the return
-    // value which process contains it
-    return (LIMITVALUES::oob_gbxindex - 1) - neighboring_processes.at(external_direction);
-  }
+const std::string& CartesianDecomposition::get_gridbox_ordering() const {
+  return gridbox_ordering;
 }
 
 // Given a global gridbox index returns which process ows it
 int CartesianDecomposition::get_gridbox_owner_process(size_t global_gridbox_index) const {
-  // Tests whether the gridbox index is out of the domain
-  if (global_gridbox_index == LIMITVALUES::oob_gbxindex) return -1;
-
-  // Get global gridbox coordinates
-  auto gridbox_coordinates = get_coordinates_from_index(ndims, global_gridbox_index);
-
-  // For each process tests whether its partition bounds the gridbox coordinates
-  for (size_t process = 0; process < partition_origins.size(); process++)
-    if (check_indices_inside_partition(gridbox_coordinates, process)) return process;
-
-  return -1;
+  // Returns -1 if the gridbox index is out of the domain, otherwise searches the
+  // partitions' slices in each dimension for the gridbox coordinates
+  return spatial_index.gridbox_owner_process(global_gridbox_index);
 }
 
 // Given a global gridbox index returns the corresponding local gridbox index
@@ -214,9 +146,11 @@ int CartesianDecomposition::global_to_local_gridbox_index(size_t global_gridbox_
                                           global_coordinates[1] - partition_origin[1],
                                           global_coordinates[2] - partition_origin[2]};
 
-  return get_index_from_coordinates({partition_size[0], partition_size[1], partition_size[2]},
-                                    local_coordinates[0], local_coordinates[1],
-                                    local_coordinates[2]);
+  auto lexicographic_index =
+      get_index_from_coordinates({partition_size[0], partition_size[1], partition_size[2]},
+                                 local_coordinates[0], local_coordinates[1], local_coordinates[2]);
+
+  return lexicographic_to_ordered_index(lexicographic_index, partition_size);
 }
 
 // Given a local gridbox index returns the corresponding global gridbox index
@@ -225,12 +159,13 @@ int CartesianDecomposition::local_to_global_gridbox_index(size_t local_gridbox_i
   // if no process is specified assumes the local one
   if (process == -1) process = my_rank;
 
-  if (process == my_rank && local_gridbox_index > total_local_gridboxes) return -1;
+  if (process == my_rank && local_gridbox_index >= total_local_gridboxes) return -1;
 
   auto partition_size = partition_sizes[process];
   auto partition_origin = partition_origins[process];
+  auto lexicographic_index = ordered_to_lexicographic_index(local_gridbox_index, partition_size);
   auto local_coordinates = get_coordinates_from_index(
-      {partition_size[0], partition_size[1], partition_size[2]}, local_gridbox_index);
+      {partition_size[0], partition_size[1], partition_size[2]}, lexicographic_index);
 
   return get_index_from_coordinates(ndims, local_coordinates[0] + partition_origin[0],
                                     local_coordinates[1] + partition_origin[1],
@@ -238,8 +173,15 @@ int CartesianDecomposition::local_to_global_gridbox_index(size_t local_gridbox_i
 }
 
 // Main subroutine for the creation of the decomposition
-bool CartesianDecomposition::create(std::vector<size_t> ndims, GbxBoundsFromBinary gfb) {
+bool CartesianDecomposition::create(std::vector<size_t> ndims, GbxBoundsFromBinary gfb,
+                                    const std::string& gridbox_ordering) {
+  if (gridbox_ordering != "lexicographic" && gridbox_ordering != "morton") {
+    throw std::invalid_argument("gridbox ordering must be either 'lexicographic' or 'morton'");
+  }
+  this->gridbox_ordering = gridbox_ordering;
   this->ndims = ndims;
+  // Finite in z and periodic in x and y dimensions by default (see set_dimensions_bound_behavior)
+  dimension_bound_behavior = {0, 1, 1};
   int comm_size, decomposition_index;
   std::vector<std::vector<size_t>> factorizations;
   comm_size = init_communicator::get_comm_size();
@@ -268,6 +210,8 @@ bool CartesianDecomposition::create(std::vector<size_t> ndims, GbxBoundsFromBina
     set_gridbox_bounds(gfb);
     calculate_partition_coordinates();
     calculate_neighboring_processes();
+    calculate_gridbox_orderings();
+    calculate_spatial_index(gfb);
 
     return true;
   }
@@ -319,6 +263,8 @@ bool CartesianDecomposition::create(std::vector<size_t> ndims, GbxBoundsFromBina
   set_gridbox_bounds(gfb);
   calculate_partition_coordinates();
   calculate_neighboring_processes();
+  calculate_gridbox_orderings();
+  calculate_spatial_index(gfb);
   return true;
 }
 
@@ -358,6 +304,103 @@ void CartesianDecomposition::calculate_partition_coordinates() {
   }
 }
 
+// Fills the spatial_index with the bounds of the gridboxes along each dimension of the entire
+// domain and the first gridbox of each slice of the decomposition in each dimension
+void CartesianDecomposition::calculate_spatial_index(const GbxBoundsFromBinary& gfb) {
+  std::array<size_t, 3> bounds_size, slices_size;
+  for (auto dimension : {0, 1, 2}) {
+    spatial_index.offsets[dimension] = dimension > 0 ? bounds_size[dimension - 1] : 0;
+    spatial_index.slice_offsets[dimension] = dimension > 0 ? slices_size[dimension - 1] : 0;
+    bounds_size[dimension] = spatial_index.offsets[dimension] + ndims[dimension] + 1;
+    slices_size[dimension] = spatial_index.slice_offsets[dimension] + decomposition[dimension] + 1;
+    spatial_index.ndims[dimension] = ndims[dimension];
+    spatial_index.decomposition[dimension] = decomposition[dimension];
+    spatial_index.local_origin[dimension] = partition_origins[my_rank][dimension];
+    spatial_index.local_size[dimension] = partition_sizes[my_rank][dimension];
+    spatial_index.is_periodic[dimension] = (dimension_bound_behavior[dimension] != 0);
+  }
+  spatial_index.my_rank = my_rank;
+  spatial_index.bounds = spatial_indexh::viewd_bounds("spatial_index_bounds", bounds_size[2]);
+  spatial_index.slices = spatial_indexh::viewd_slices("spatial_index_slices", slices_size[2]);
+
+  // Local gridbox index of each gridbox of the local partition in lexicographic order
+  // (left empty if the local gridbox indexes are already in lexicographic order)
+  const auto ordering_size = gridbox_ordering == "lexicographic" ? 0 : total_local_gridboxes;
+  spatial_index.local_ordering =
+      spatial_indexh::viewd_ordering("spatial_index_local_ordering", ordering_size);
+  for (size_t n = 0; n < ordering_size; n++)
+    spatial_index.local_ordering(n) = lexicographic_to_ordered_index(n, partition_sizes[my_rank]);
+
+  for (auto dimension : {0, 1, 2}) {
+    // Lower bound of every gridbox along the dimension and the upper bound of the last one
+    const auto offset = spatial_index.offsets[dimension];
+    for (size_t n = 0; n < ndims[dimension]; n++) {
+      std::array<size_t, 3> indices = {0, 0, 0};
+      indices[dimension] = n;
+      const auto idx = get_index_from_coordinates(ndims, indices[0], indices[1], indices[2]);
+      const auto bounds = dimension == 0   ? gfb.get_coord3gbxbounds(idx)
+                          : dimension == 1 ? gfb.get_coord1gbxbounds(idx)
+                                           : gfb.get_coord2gbxbounds(idx);
+      spatial_index.bounds(offset + n) = bounds.first;
+      spatial_index.bounds(offset + n + 1) = bounds.second;
+    }
+
+    // Gridboxes are uniformly spaced if all their widths equal the mean width
+    const auto mean_width =
+        (spatial_index.bounds(offset + ndims[dimension]) - spatial_index.bounds(offset)) /
+        ndims[dimension];
+    spatial_index.is_uniform[dimension] = true;
+    for (size_t n = 0; n < ndims[dimension]; n++) {
+      const auto width = spatial_index.bounds(offset + n + 1) - spatial_index.bounds(offset + n);
+      if (std::abs(width - mean_width) > 1e-12 * std::abs(mean_width))
+        spatial_index.is_uniform[dimension] = false;
+    }
+    spatial_index.inverse_widths[dimension] = 1.0 / mean_width;
+
+    // First gridbox of every slice along the dimension followed by the number of gridboxes
+    const auto slice_offset = spatial_index.slice_offsets[dimension];
+    for (size_t slice = 0; slice < decomposition[dimension]; slice++) {
+      std::array<int, 3> slice_indices = {0, 0, 0};
+      slice_indices[dimension] = slice;
+      const auto partition = get_partition_index_from_slice(slice_indices);
+      spatial_index.slices(slice_offset + slice) = partition_origins[partition][dimension];
+    }
+    spatial_index.slices(slice_offset + decomposition[dimension]) = ndims[dimension];
+  }
+}
+
+// Calculates the order of the gridboxes in every partition size if they are not lexicographic
+void CartesianDecomposition::calculate_gridbox_orderings() {
+  ordered_to_lexicographic.clear();
+  lexicographic_to_ordered.clear();
+  if (gridbox_ordering == "lexicographic") return;
+
+  for (const auto& partition_size : partition_sizes) {
+    if (ordered_to_lexicographic.count(partition_size)) continue;
+
+    auto ordering = get_morton_ordering(partition_size);
+    std::vector<size_t> inverse(ordering.size());
+    for (size_t local_gridbox_index = 0; local_gridbox_index < ordering.size();
+         local_gridbox_index++)
+      inverse[ordering[local_gridbox_index]] = local_gridbox_index;
+
+    ordered_to_lexicographic[partition_size] = ordering;
+    lexicographic_to_ordered[partition_size] = inverse;
+  }
+}
+
+size_t CartesianDecomposition::ordered_to_lexicographic_index(
+    size_t local_gridbox_index, const std::array<size_t, 3>& partition_size) const {
+  if (gridbox_ordering == "lexicographic") return local_gridbox_index;
+  return ordered_to_lexicographic.at(partition_size).at(local_gridbox_index);
+}
+
+size_t CartesianDecomposition::lexicographic_to_ordered_index(
+    size_t lexicographic_index, const std::array<size_t, 3>& partition_size) const {
+  if (gridbox_ordering == "lexicographic") return lexicographic_index;
+  return lexicographic_to_ordered.at(partition_size).at(lexicographic_index);
+}
+
 // Returns how many multiplications by 10 are needed to turn a double to int
 int get_multiplications_to_turn_int(double entry_value) {
   int total_multiplications = 0;
@@ -462,6 +505,35 @@ std::array<size_t, 3> get_coordinates_from_index(const std::vector<size_t>& ndim
   return std::array<size_t, 3>{k, i, j};
 }
 
+// Returns the Morton (Z-order) key of gridbox coordinate indices by interleaving the
+// bits of the indices in the z, x and y directions (up to 21 bits of each index)
+uint64_t get_morton_key(const size_t k, const size_t i, const size_t j) {
+  uint64_t key = 0;
+  for (uint64_t bit = 0; bit < 21; bit++) {
+    key |= ((static_cast<uint64_t>(k) >> bit) & 1) << (3 * bit);
+    key |= ((static_cast<uint64_t>(i) >> bit) & 1) << (3 * bit + 1);
+    key |= ((static_cast<uint64_t>(j) >> bit) & 1) << (3 * bit + 2);
+  }
+  return key;
+}
+
+// Returns the lexicographic indices of the gridboxes of a partition sorted by their Morton key,
+// i.e. in the order they are visited by a Morton curve through the partition
+std::vector<size_t> get_morton_ordering(const std::array<size_t, 3>& partition_size) {
+  const std::vector<size_t> size = {partition_size[0], partition_size[1], partition_size[2]};
+  std::vector<size_t> ordering(size[0] * size[1] * size[2]);
+  std::vector<uint64_t> keys(ordering.size());
+  for (size_t index = 0; index < ordering.size(); index++) {
+    const auto coordinates = get_coordinates_from_index(size, index);
+    ordering[index] = index;
+    keys[index] = get_morton_key(coordinates[0], coordinates[1], coordinates[2]);
+  }
+
+  std::sort(ordering.begin(), ordering.end(),
+            [&keys](const size_t a, const size_t b) { return keys[a] < keys[b]; });
+  return ordering;
+}
+
 // Returns all possible factorizations of an integer
 std::vector<std::vector<size_t>> factorize(int n) {
   std::vector<std::vector<size_t>> result;
@@ -511,24 +583,3 @@ void heap_permutation(std::vector<std::vector<size_t>>& results, std::vector<siz
     }
   }
 }
-
-int binary_search(std::array<double, 3>& coordinates, int dimension,
-                  std::array<size_t, 3> partition_size,
-                  std::vector<std::vector<double>> gridbox_bounds) {
-  int left = 0;
-  int right = partition_size[dimension] - 1;
-  while (left <= right) {
-    int mid = (left + (right - left) / 2);
-    if ((coordinates[dimension] >= gridbox_bounds[dimension][mid]) &&
-        (coordinates[dimension] < gridbox_bounds[dimension][mid + 1])) {
-      return mid;
-    }
-    if (coordinates[dimension] >= gridbox_bounds[dimension][mid + 1]) {
-      left = mid + 1;
-    } else if (coordinates[dimension] < gridbox_bounds[dimension][mid]) {
-      right = mid;
-    }
-  }
-  // If target is not found
-  return -1;
-}
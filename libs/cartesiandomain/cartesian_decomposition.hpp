@@ -26,14 +26,17 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../cleoconstants.hpp"
 #include "cartesiandomain/domainboundaries.hpp"
+#include "cartesiandomain/spatial_index.hpp"
 #include "configuration/communicator.hpp"
 #include "initialise/gbx_bounds_from_binary.hpp"
 
@@ -72,18 +75,43 @@ class CartesianDecomposition {
   // Number of local gridboxes
   size_t total_local_gridboxes;
 
+  // Index (in host memory) of the gridbox bounds and partitions of the entire domain
+  spatial_indexh spatial_index;
+
+  // Order of the gridboxes in each partition, either "lexicographic" or "morton"
+  std::string gridbox_ordering;
+  // For each partition size (unless ordering is lexicographic), the lexicographic index
+  // of the gridbox at each local gridbox index and the inverse mapping
+  std::map<std::array<size_t, 3>, std::vector<size_t>> ordered_to_lexicographic;
+  std::map<std::array<size_t, 3>, std::vector<size_t>> lexicographic_to_ordered;
+
   // Fill the partition_begin_coordinates and partition_end_coordinates arrays
   void calculate_partition_coordinates();
 
   // Fills the neighboring_processes array
   void calculate_neighboring_processes();
 
+  // Fills the spatial_index with the gridbox bounds and partitions of the entire domain
+  void calculate_spatial_index(const GbxBoundsFromBinary& gfb);
+
+  // Fills the ordered_to_lexicographic and lexicographic_to_ordered maps
+  void calculate_gridbox_orderings();
+
+  // Convert a local gridbox index to/from the index of the same gridbox if the gridboxes
+  // of a partition of the given size were in lexicographic order
+  size_t ordered_to_lexicographic_index(size_t local_gridbox_index,
+                                        const std::array<size_t, 3>& partition_size) const;
+  size_t lexicographic_to_ordered_index(size_t lexicographic_index,
+                                        const std::array<size_t, 3>& partition_size) const;
+
  public:
   CartesianDecomposition();
   ~CartesianDecomposition();
 
-  // Creates the decomposition
-  bool create(std::vector<size_t> ndims, GbxBoundsFromBinary gfb);
+  // Creates the decomposition with gridboxes in each partition ordered either
+  // lexicographically (as in the global domain) or along a Morton (Z-order) curve
+  bool create(std::vector<size_t> ndims, GbxBoundsFromBinary gfb,
+              const std::string& gridbox_ordering = "lexicographic");
 
   // Local and global amount of gridboxes
   size_t get_total_local_gridboxes() const;
@@ -104,6 +132,8 @@ class CartesianDecomposition {
   int global_to_local_gridbox_index(size_t global_gridbox_index) const;
   int get_gridbox_owner_process(size_t global_gridbox_index) const;
   unsigned int get_local_bounding_gridbox_index(std::array<double, 3>& coordinates) const;
+  const spatial_indexh& get_spatial_index() const;
+  const std::string& get_gridbox_ordering() const;
   // void set_gridbox_size(double z_size, double x_size, double y_size);
   void set_gridbox_bounds(GbxBoundsFromBinary gfb);
   // Sets the behavior of all dimensions
@@ -131,13 +161,14 @@ size_t get_index_from_coordinates(const std::vector<size_t>& ndims, const size_t
 std::array<size_t, 3> get_coordinates_from_index(const std::vector<size_t>& ndims,
                                                  const size_t index);
 
+// Functions for ordering the gridboxes of a partition along a Morton (Z-order) curve
+uint64_t get_morton_key(const size_t k, const size_t i, const size_t j);
+std::vector<size_t> get_morton_ordering(const std::array<size_t, 3>& partition_size);
+
 // Support functions
 std::vector<std::vector<size_t>> factorize(int n);
 void factorize_helper(int n, int start, std::vector<size_t>& current,
                       std::vector<std::vector<size_t>>& result);
 void heap_permutation(std::vector<std::vector<size_t>>& results, std::vector<size_t> arr, int size);
 int get_multiplications_to_turn_int(double entry_value);
-int binary_search(std::array<double, 3>& coordinates, int dimension,
-                  std::array<size_t, 3> partition_size,
-                  std::vector<std::vector<double>> gridbox_bounds);
 #endif  // LIBS_CARTESIANDOMAIN_CARTESIAN_DECOMPOSITION_HPP_
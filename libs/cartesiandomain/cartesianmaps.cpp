@@ -55,27 +55,23 @@ size_t CartesianMaps::get_local_ngridboxes() const {
 KOKKOS_FUNCTION
 size_t CartesianMaps::local_to_global_gridbox_index(unsigned int local_gridbox_index,
                                                     int process) const {
-  if (is_decomp) {
+  if (is_decomp || is_reordered) {
     return domain_decomposition.local_to_global_gridbox_index(local_gridbox_index, process);
   }
   return local_gridbox_index;
 }
 
 /* given coordinates, associated gxbindex is found. The coords may be updated too,
- * e.g. if the domain has a cyclic boundary condition and they therefore need to be corrected
+ * e.g. if the domain has a cyclic boundary condition and they therefore need to be corrected.
+ * For a decomposed domain the gridbox is found (on host or device) using the spatial index,
+ * so super-droplets may move several gridboxes or to any process in one step.
  */
-// TODO(ALL) make domain_decomp call compatible with GPUs and then remove comm_size guard
 KOKKOS_FUNCTION
 unsigned int CartesianMaps::get_local_bounding_gridbox_index(const unsigned int gbxindex,
                                                              double& coord3, double& coord1,
                                                              double& coord2) const {
   if (is_decomp) {
-    auto coordinates = std::array<double, 3>{coord3, coord1, coord2};
-    const auto idx = domain_decomposition.get_local_bounding_gridbox_index(coordinates);
-    coord3 = coordinates[0];
-    coord1 = coordinates[1];
-    coord2 = coordinates[2];
-    return idx;
+    return spatial_index.local_bounding_gridbox_index(coord3, coord1, coord2);
   }
   return get_no_decomposition_bounding_gridbox(*this, gbxindex, coord3, coord1, coord2);
 }
@@ -26,12 +26,14 @@
 #include <Kokkos_UnorderedMap.hpp>
 #include <array>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../cleoconstants.hpp"
 #include "../kokkosaliases.hpp"
 #include "cartesiandomain/cartesian_decomposition.hpp"
 #include "cartesiandomain/doubly_periodic_domain.hpp"
+#include "cartesiandomain/spatial_index.hpp"
 #include "initialise/gbx_bounds_from_binary.hpp"
 
 namespace dlc = dimless_constants;
@@ -50,6 +52,8 @@ struct CartesianMaps {
  private:
   CartesianDecomposition domain_decomposition;
   bool is_decomp;
+  bool is_reordered;             // true if local gridboxes are not in lexicographic order
+  spatial_indexd spatial_index;  // copy of domain_decomposition's spatial index in device memory
 
   /* maps from gbxidx to {lower, upper} coords of gridbox boundaries */
   kokkos_pairmap to_coord3bounds;
@@ -74,6 +78,7 @@ struct CartesianMaps {
   for e.g. for global_ndims, gbxareas and gbxvols undefined upon construction */
   explicit CartesianMaps()
       : is_decomp(false),
+        is_reordered(false),
         to_coord3bounds(kokkos_pairmap(0)),
         to_coord1bounds(kokkos_pairmap(0)),
         to_coord2bounds(kokkos_pairmap(0)),
@@ -265,16 +270,24 @@ struct CartesianMaps {
     return to_forward_coord2nghbr.value_at(i);  // value returned by map at index i
   }
 
-  void create_decomposition(std::vector<size_t> global_ndims, GbxBoundsFromBinary gfb) {
-    domain_decomposition.create(global_ndims, gfb);
+  void create_decomposition(std::vector<size_t> global_ndims, GbxBoundsFromBinary gfb,
+                            const std::string& gridbox_ordering = "lexicographic") {
+    domain_decomposition.create(global_ndims, gfb, gridbox_ordering);
     if (domain_decomposition.get_total_local_gridboxes() <
         domain_decomposition.get_total_global_gridboxes()) {
       is_decomp = true;
     }
+    is_reordered = (domain_decomposition.get_gridbox_ordering() != "lexicographic");
+    spatial_index =
+        domain_decomposition.get_spatial_index().create_copy<ExecSpace::memory_space>();
   }
 
   const CartesianDecomposition& get_domain_decomposition() const { return domain_decomposition; }
 
+  /* returns index (in device memory) for finding the gridbox which bounds a coordinate */
+  KOKKOS_INLINE_FUNCTION
+  const spatial_indexd& get_spatial_index() const { return spatial_index; }
+
   size_t get_total_global_ngridboxes() const {
     return domain_decomposition.get_total_global_gridboxes();
   }
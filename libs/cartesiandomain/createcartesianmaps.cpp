@@ -49,16 +49,31 @@ or 3-D model with periodic or finite boundary conditions. In a non-3D case, boun
 neighbours maps for unused dimensions are 'null' (ie. return numerical limits), however the area
 and volume of each gridbox remains finite. E.g. In the 0-D case, the bounds maps all have 1
 {key, value} where key=gbxidx=0 and value = {max, min} numerical limits, meanwhile volume
-function returns a value determined from the gridfile 'grid_filename' */
+function returns a value determined from the gridfile 'grid_filename'. Within each process'
+partition of the domain, local gridbox indexes are either in lexicographic order (i.e. the same
+order as the global gridbox indexes) or in the order of a Morton (Z-order) curve through the
+partition so that neighbouring gridboxes (and their super-droplets) are closer in memory */
 CartesianMaps create_cartesian_maps(const size_t ngbxs, const unsigned int nspacedims,
-                                    const std::filesystem::path grid_filename) {
+                                    const std::filesystem::path grid_filename,
+                                    const std::string& gridbox_ordering) {
   std::cout << "\n--- create cartesian gridbox maps ---\n";
 
   const auto gfb = GbxBoundsFromBinary(ngbxs, nspacedims, grid_filename);
+  const auto gbxmaps = create_cartesian_maps_from_bounds(nspacedims, gfb, gridbox_ordering);
 
+  std::cout << "--- create cartesian gridbox maps: success ---\n";
+
+  return gbxmaps;
+}
+
+/* creates cartesian maps instance, as in create_cartesian_maps, but using gridbox bounds
+already given by 'gfb' (e.g. for a grid generated without a gridfile) */
+CartesianMaps create_cartesian_maps_from_bounds(const unsigned int nspacedims,
+                                                const GbxBoundsFromBinary& gfb,
+                                                const std::string& gridbox_ordering) {
   auto gbxmaps = CartesianMaps();
 
-  gbxmaps.create_decomposition(gfb.ndims, gfb);
+  gbxmaps.create_decomposition(gfb.ndims, gfb, gridbox_ordering);
   set_cartesian_maps(nspacedims, gfb, gbxmaps);
 
   set_maps_ndims(gfb.ndims, gbxmaps);
@@ -66,11 +81,18 @@ CartesianMaps create_cartesian_maps(const size_t ngbxs, const unsigned int nspac
   check_ngridboxes_matches_ndims(gbxmaps, gbxmaps.get_total_global_ngridboxes());
   check_ngridboxes_matches_maps(gbxmaps, gbxmaps.get_local_ngridboxes_hostcopy());
 
-  std::cout << "--- create cartesian gridbox maps: success ---\n";
-
   return gbxmaps;
 }
 
+/* throws error if 'gridbox_ordering' is not "lexicographic", e.g. for a model whose coupled
+dynamics or initial conditions assume that local gridbox indexes are in lexicographic order */
+void check_lexicographic_gridbox_ordering(const std::string& gridbox_ordering) {
+  if (gridbox_ordering != "lexicographic") {
+    throw std::invalid_argument("gridbox_ordering '" + gridbox_ordering +
+                                "' not supported by this model, use 'lexicographic'");
+  }
+}
+
 void check_ngridboxes_matches_maps(const CartesianMaps& gbxmaps, const size_t ngbxs) {
   const auto ngbxs_from_maps = gbxmaps.maps_size();
   if (ngbxs_from_maps != ngbxs + 1) {
@@ -28,6 +28,7 @@
 #include <filesystem>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -47,8 +48,21 @@ and neighbours maps for unused dimensions are 'null'
 gridbox remains finite. E.g. In the 0-D case, the bounds maps all
 have 1 {key, value} where key=gbxidx=0 and value = {max, min}
 numerical limits, meanwhile volume function returns a value determined
-from the gridfile 'grid_filename' */
+from the gridfile 'grid_filename'. Local gridbox indexes follow the
+'gridbox_ordering' ("lexicographic" or "morton") of the gridboxes
+within each process' partition of the domain */
 CartesianMaps create_cartesian_maps(const size_t ngbxs, const unsigned int nspacedims,
-                                    const std::filesystem::path grid_filename);
+                                    const std::filesystem::path grid_filename,
+                                    const std::string& gridbox_ordering = "lexicographic");
+
+/* creates cartesian maps instance, as in create_cartesian_maps, but using gridbox bounds
+already given by 'gfb' (e.g. for a grid generated without a gridfile) */
+CartesianMaps create_cartesian_maps_from_bounds(
+    const unsigned int nspacedims, const GbxBoundsFromBinary& gfb,
+    const std::string& gridbox_ordering = "lexicographic");
+
+/* throws error if 'gridbox_ordering' is not "lexicographic", e.g. for a model whose coupled
+dynamics or initial conditions assume that local gridbox indexes are in lexicographic order */
+void check_lexicographic_gridbox_ordering(const std::string& gridbox_ordering);
 
 #endif  // LIBS_CARTESIANDOMAIN_CREATECARTESIANMAPS_HPP_
@@ -28,8 +28,7 @@ viewd_supers create_newsupers_for_gridboxes(const CartesianMaps& gbxmaps,
                                             const CreateSuperdrop& create_superdrop,
                                             Kokkos::View<unsigned int*> gbxindexes,
                                             const size_t newnsupers_pergbx);
-void add_superdrops_for_gridboxes(const SupersInDomain& allsupers,
-                                  const viewd_constsupers newsupers);
+void add_superdrops_for_gridboxes(SupersInDomain& allsupers, const viewd_constsupers newsupers);
 SupersInDomain move_supers_between_gridboxes_again(const viewd_gbx d_gbxs,
                                                    SupersInDomain& allsupers);
 
@@ -244,10 +243,10 @@ size_t check_space_in_totsupers(const SupersInDomain& allsupers,
   return oldnsupers;
 }
 
-/* check there is space in totsupers for newsupers, then append superdrops in newsupers to end of
-totsupers view */
-void add_superdrops_for_gridboxes(const SupersInDomain& allsupers,
-                                  const viewd_constsupers newsupers) {
+/* grow capacity of totsupers if necessary and check there is then space in totsupers for
+newsupers, then append superdrops in newsupers to end of the superdroplets in the domain */
+void add_superdrops_for_gridboxes(SupersInDomain& allsupers, const viewd_constsupers newsupers) {
+  allsupers.reserve(allsupers.domain_nsupers() + newsupers.extent(0));
   const auto totsupers = allsupers.get_totsupers();
   const auto og_ntotsupers = check_space_in_totsupers(allsupers, newsupers);
 
@@ -56,13 +56,15 @@ struct CartesianCheckBounds {
 /* returned type satisfies motion concept for motion of a
 superdroplet using a predictor-corrector method to update
 a superdroplet's coordinates and then updating it's
-sdgbxindex as appropriate for a cartesian domain */
+sdgbxindex as appropriate for a cartesian domain. If
+max_nsubsteps > 1, motion steps may be split into up
+to max_nsubsteps sub-steps to satisfy the CFL criteria */
 template <VelocityFormula TV>
 inline PredCorrMotion<CartesianMaps, TV, CartesianCheckBounds> CartesianMotion(
     const unsigned int motionstep, const std::function<double(unsigned int)> int2time,
-    const TV terminalv) {
-  return PredCorrMotion<CartesianMaps, TV, CartesianCheckBounds>(motionstep, int2time, terminalv,
-                                                                 CartesianCheckBounds{});
+    const TV terminalv, const unsigned int max_nsubsteps = 1) {
+  return PredCorrMotion<CartesianMaps, TV, CartesianCheckBounds>(
+      motionstep, int2time, terminalv, CartesianCheckBounds{}, max_nsubsteps);
 }
 
 #endif  // LIBS_CARTESIANDOMAIN_MOVEMENT_CARTESIAN_MOTION_HPP_
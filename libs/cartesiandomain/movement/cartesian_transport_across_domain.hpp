@@ -25,13 +25,16 @@
 #include <concepts>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../../cleoconstants.hpp"
 #include "../../kokkosaliases.hpp"
 #include "cartesiandomain/cartesianmaps.hpp"
+#include "configuration/communication_metrics.hpp"
 #include "configuration/communicator.hpp"
 #include "gridboxes/gridbox.hpp"
 #include "gridboxes/gridboxmaps.hpp"
@@ -45,7 +48,7 @@ which move to/from gridboxes on different nodes.
 */
 template <GridboxMaps GbxMaps>
 viewd_supers sendrecv_supers(const GbxMaps& gbxmaps, const viewd_gbx d_gbxs,
-                             viewd_supers totsupers);
+                             viewd_supers totsupers, const size_t max_capacity);
 
 /*
  * struct satisfying TransportAcrossDomain concept for transporting superdroplets around a
@@ -61,11 +64,13 @@ struct CartesianTransportAcrossDomain {
 
 /*
 function to move super-droplets between MPI processes, e.g. for superdroplets
-which move to/from gridboxes on different nodes.
+which move to/from gridboxes on different nodes. If there is not enough space in totsupers for the
+received superdroplets, totsupers is reallocated with a larger capacity (up to max_capacity) so the
+returned view may not be the same as the given one.
 */
 template <GridboxMaps GbxMaps>
 viewd_supers sendrecv_supers(const GbxMaps& gbxmaps, const viewd_gbx d_gbxs,
-                             viewd_supers totsupers) {
+                             viewd_supers totsupers, const size_t max_capacity) {
   int comm_size, my_rank;
   comm_size = init_communicator::get_comm_size();
   my_rank = init_communicator::get_comm_rank();
@@ -110,18 +115,29 @@ viewd_supers sendrecv_supers(const GbxMaps& gbxmaps, const viewd_gbx d_gbxs,
   local_superdrops = superdrop_index + 1;
 
   // Share how many superdrops each process will send and receive to/from the others
+  const auto alltoall_start = MPI_Wtime();
   MPI_Alltoall(per_process_send_superdrops.data(), 1, MPI_INT, per_process_recv_superdrops.data(),
                1, MPI_INT, MPI_COMM_WORLD);
+  communication_metrics::add_alltoall_time(MPI_Wtime() - alltoall_start);
   total_superdrops_to_recv =
       std::accumulate(per_process_recv_superdrops.begin(), per_process_recv_superdrops.end(), 0);
 
-  if (local_superdrops + total_superdrops_to_recv > totsupers.extent(0)) {
-    throw std::runtime_error("must have enough space in supers view to receive superdroplets");
-  }
-  if (local_superdrops + total_superdrops_to_recv > totsupers.extent(0)) {
-    std::cout << "MAXIMUM NUMBER OF LOCAL SUPERDROPLETS EXCEEDED" << std::endl;
-    return totsupers;
+  // Agree on every process whether any process cannot fit its superdroplets before exchanging
+  // any of them, so that if one process throws an error every process does (max_capacity is the
+  // same on every process so there is no need to agree if capacity is unlimited)
+  const auto nsupers = size_t{local_superdrops + total_superdrops_to_recv};
+  if (max_capacity < std::numeric_limits<size_t>::max()) {
+    auto is_overflow = int{nsupers > max_capacity};
+    MPI_Allreduce(MPI_IN_PLACE, &is_overflow, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD);
+    if (is_overflow) {
+      const auto err = std::string(
+          "number of superdroplets on at least one process exceeds maximum capacity of "
+          "superdroplets' view (" + std::to_string(max_capacity) + "), this process has " +
+          std::to_string(nsupers));
+      throw std::runtime_error(err);
+    }
   }
+  totsupers = grow_supers_capacity(totsupers, nsupers, max_capacity);
 
   // Knowing how many superdroplets will be sent and received, allocate
   // buffers to serialize the data
@@ -201,7 +217,25 @@ viewd_supers sendrecv_supers(const GbxMaps& gbxmaps, const viewd_gbx d_gbxs,
     }
   }
 
+  const auto waitall_start = MPI_Wtime();
   MPI_Waitall(comm_size * 6, exchange_requests.data(), exchange_statuses.data());
+  communication_metrics::add_waitall_time(MPI_Wtime() - waitall_start);
+
+  // Number of bytes actually exchanged with other processes given by the counts of each buffer
+  auto nbytes_sent = size_t{0};
+  auto nbytes_recv = size_t{0};
+  for (int i = 0; i < comm_size; i++) {
+    if (i != my_rank) {
+      nbytes_sent += uint_send_counts[i] * sizeof(unsigned int) +
+                     per_process_send_superdrops[i] * sizeof(uint64_t) +
+                     double_send_counts[i] * sizeof(double);
+      nbytes_recv += uint_recv_counts[i] * sizeof(unsigned int) +
+                     per_process_recv_superdrops[i] * sizeof(uint64_t) +
+                     double_recv_counts[i] * sizeof(double);
+    }
+  }
+  communication_metrics::add_sendrecv(total_superdrops_to_send, total_superdrops_to_recv,
+                                      nbytes_sent, nbytes_recv);
 
   for (unsigned int i = local_superdrops; i < local_superdrops + total_superdrops_to_recv; i++) {
     int data_offset = i - local_superdrops;
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: spatial_index.hpp
+ * Project: cartesiandomain
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * struct for finding the gridbox (and the process which owns it) which bounds a coordinate in a
+ * (possibly decomposed) cartesian domain without searching the gridbox maps, e.g. for
+ * super-droplets which move several gridboxes in one step or which are added to the domain.
+ * Lookup can be done on host or device and needs no memory allocation.
+ */
+
+#ifndef LIBS_CARTESIANDOMAIN_SPATIAL_INDEX_HPP_
+#define LIBS_CARTESIANDOMAIN_SPATIAL_INDEX_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+
+#include "../cleoconstants.hpp"
+#include "superdrops/kokkosaliases_sd.hpp"
+
+/* index of the (global) boundaries of the gridboxes in each dimension of a cartesian domain
+and of the slices the domain is decomposed into in each dimension. The bounds of the gridboxes
+in dimension d (for d = 0, 1, 2, corresponding to coord3, coord1, coord2) are sorted and stored
+contiguously in 'bounds' from bounds(offsets[d]) to bounds(offsets[d] + ndims[d]). Likewise the
+(global) index of the first gridbox of every slice in dimension d (followed by ndims[d]) are
+stored in 'slices' from slices(slice_offsets[d]) to slices(slice_offsets[d] + decomposition[d]).
+A coordinate is found in O(1) time in dimensions where gridboxes are uniformly spaced and in
+O(log(ndims[d])) time otherwise. Like gridbox bounds maps, lower bounds of gridboxes are inclusive
+and upper bounds are exclusive. If the local gridbox indexes are not in lexicographic order (e.g.
+they follow a Morton curve) 'local_ordering' gives the local index of the n'th gridbox of the
+local partition in lexicographic order, otherwise it is empty. Index may be in any memory space,
+e.g. in host memory for CartesianDecomposition and in device memory for CartesianMaps. */
+template <typename MemorySpace>
+struct CartesianSpatialIndex {
+  using viewd_bounds = Kokkos::View<double*, MemorySpace>;
+  using viewd_slices = Kokkos::View<size_t*, MemorySpace>;
+  using viewd_ordering = Kokkos::View<size_t*, MemorySpace>;
+
+  viewd_bounds bounds;           /**< bounds of gridboxes in each dimension (see offsets) */
+  viewd_slices slices;           /**< first gridbox of slices in each dimension (see offsets) */
+  viewd_ordering local_ordering; /**< local index of gridboxes in lexicographic order */
+
+  Kokkos::Array<size_t, 3> offsets;        /**< position in 'bounds' of each dimension */
+  Kokkos::Array<size_t, 3> slice_offsets;  /**< position in 'slices' of each dimension */
+  Kokkos::Array<size_t, 3> ndims;          /**< no. gridboxes in each dimension of domain */
+  Kokkos::Array<size_t, 3> decomposition;  /**< no. slices in each dimension of domain */
+  Kokkos::Array<size_t, 3> local_origin;   /**< first gridbox of local partition */
+  Kokkos::Array<size_t, 3> local_size;     /**< no. gridboxes in local partition */
+  Kokkos::Array<bool, 3> is_periodic;      /**< true = periodic, false = finite dimension */
+  Kokkos::Array<bool, 3> is_uniform;       /**< true if gridboxes are equally spaced */
+  Kokkos::Array<double, 3> inverse_widths; /**< 1 / width of gridboxes if is_uniform */
+  int my_rank;                             /**< rank of local process */
+
+  /* returns lower bound of domain in dimension d */
+  KOKKOS_INLINE_FUNCTION
+  double lower(const size_t d) const { return bounds(offsets[d]); }
+
+  /* returns upper bound of domain in dimension d */
+  KOKKOS_INLINE_FUNCTION
+  double upper(const size_t d) const { return bounds(offsets[d] + ndims[d]); }
+
+  /* returns false if coordinate is beyond a finite boundary of the domain in dimension d.
+  Otherwise returns true and, if the dimension is periodic and the coordinate is beyond the
+  boundary, corrects the coordinate to come in from the opposite side of the domain */
+  KOKKOS_INLINE_FUNCTION
+  bool correct_coordinate(const size_t d, double& coord) const {
+    const auto is_below = coord < lower(d);
+    const auto is_above = coord >= upper(d);
+    if (!is_periodic[d]) {
+      return !is_below && !is_above;
+    }
+
+    if (is_below) {
+      coord += upper(d) - lower(d);
+    } else if (is_above) {
+      coord -= upper(d) - lower(d);
+    }
+    return true;
+  }
+
+  /* returns (global) position in dimension d of the gridbox which bounds coord, assuming coord
+  is within the domain. Position is calculated for uniform gridboxes and otherwise found by binary
+  search of the gridbox bounds, i.e. for the gridbox with bounds(pos) <= coord < bounds(pos+1) */
+  KOKKOS_INLINE_FUNCTION
+  size_t gridbox_position(const size_t d, const double coord) const {
+    const auto b = offsets[d];
+    if (is_uniform[d]) {
+      auto pos = Kokkos::min(static_cast<size_t>((coord - lower(d)) * inverse_widths[d]),
+                             ndims[d] - 1);
+      if (pos > 0 && coord < bounds(b + pos)) {
+        --pos;  // correct for rounding error
+      } else if (pos + 1 < ndims[d] && coord >= bounds(b + pos + 1)) {
+        ++pos;  // correct for rounding error
+      }
+      return pos;
+    }
+
+    auto left = size_t{0};
+    auto right = ndims[d];
+    while (right - left > 1) {
+      const auto mid = left + (right - left) / 2;
+      if (coord < bounds(b + mid)) {
+        right = mid;
+      } else {
+        left = mid;
+      }
+    }
+    return left;
+  }
+
+  /* returns slice of domain in dimension d containing gridbox at (global) position pos */
+  KOKKOS_INLINE_FUNCTION
+  size_t slice_position(const size_t d, const size_t pos) const {
+    const auto s = slice_offsets[d];
+    auto left = size_t{0};
+    auto right = decomposition[d];
+    while (right - left > 1) {
+      const auto mid = left + (right - left) / 2;
+      if (pos < slices(s + mid)) {
+        right = mid;
+      } else {
+        left = mid;
+      }
+    }
+    return left;
+  }
+
+  /* returns the rank of the process which owns the gridbox at (global) positions 'pos' */
+  KOKKOS_INLINE_FUNCTION
+  int owner_process(const Kokkos::Array<size_t, 3>& pos) const {
+    const auto s0 = slice_position(0, pos[0]);
+    const auto s1 = slice_position(1, pos[1]);
+    const auto s2 = slice_position(2, pos[2]);
+    return static_cast<int>(s0 * (decomposition[1] * decomposition[2]) + s1 * decomposition[2] +
+                            s2);
+  }
+
+  /* returns the rank of the process which owns the gridbox with (global) index gbxindex, or -1
+  if gbxindex is out of the domain */
+  KOKKOS_INLINE_FUNCTION
+  int gridbox_owner_process(const size_t gbxindex) const {
+    if (gbxindex >= ndims[0] * ndims[1] * ndims[2]) {
+      return -1;
+    }
+    const auto pos = Kokkos::Array<size_t, 3>{gbxindex % ndims[0], (gbxindex / ndims[0]) % ndims[1],
+                                              gbxindex / (ndims[0] * ndims[1])};
+    return owner_process(pos);
+  }
+
+  /* returns (global) positions of gridbox bounding coordinates in each dimension, or false if
+  coordinates are beyond a finite boundary of the domain. Coordinates may be corrected, e.g. if
+  they are beyond a periodic boundary of the domain */
+  KOKKOS_INLINE_FUNCTION
+  bool bounding_gridbox_positions(double& coord3, double& coord1, double& coord2,
+                                  Kokkos::Array<size_t, 3>& pos) const {
+    if (!correct_coordinate(0, coord3) || !correct_coordinate(1, coord1) ||
+        !correct_coordinate(2, coord2)) {
+      return false;
+    }
+    pos[0] = gridbox_position(0, coord3);
+    pos[1] = gridbox_position(1, coord1);
+    pos[2] = gridbox_position(2, coord2);
+    return true;
+  }
+
+  /* returns (global) index of the gridbox which bounds the coordinates, or out of bounds gridbox
+  index if they are beyond a finite boundary of the domain. Coordinates may be corrected, e.g. if
+  they are beyond a periodic boundary of the domain */
+  KOKKOS_INLINE_FUNCTION
+  unsigned int global_bounding_gridbox_index(double& coord3, double& coord1, double& coord2) const {
+    auto pos = Kokkos::Array<size_t, 3>{};
+    if (!bounding_gridbox_positions(coord3, coord1, coord2, pos)) {
+      return LIMITVALUES::oob_gbxindex;
+    }
+    return static_cast<unsigned int>(pos[0] + ndims[0] * (pos[1] + ndims[1] * pos[2]));
+  }
+
+  /* returns local index of the gridbox which bounds the coordinates if the gridbox is owned by
+  this process. Otherwise returns out of bounds gridbox index if coordinates are beyond a finite
+  boundary of the domain, or (oob_gbxindex - 1 - rank) for the rank of the process which owns
+  the gridbox. Coordinates may be corrected, e.g. if they are beyond a periodic boundary */
+  KOKKOS_INLINE_FUNCTION
+  unsigned int local_bounding_gridbox_index(double& coord3, double& coord1, double& coord2) const {
+    auto pos = Kokkos::Array<size_t, 3>{};
+    if (!bounding_gridbox_positions(coord3, coord1, coord2, pos)) {
+      return LIMITVALUES::oob_gbxindex;
+    }
+
+    const auto owner = owner_process(pos);
+    if (owner != my_rank) {
+      return (LIMITVALUES::oob_gbxindex - 1) - owner;
+    }
+
+    const auto k = pos[0] - local_origin[0];
+    const auto i = pos[1] - local_origin[1];
+    const auto j = pos[2] - local_origin[2];
+    const auto n = k + local_size[0] * (i + local_size[1] * j);
+    return static_cast<unsigned int>(local_ordering.extent(0) > 0 ? local_ordering(n) : n);
+  }
+
+  /* returns copy of spatial index in memory space OtherSpace */
+  template <typename OtherSpace>
+  CartesianSpatialIndex<OtherSpace> create_copy() const {
+    auto copy = CartesianSpatialIndex<OtherSpace>{};
+    copy.bounds = Kokkos::create_mirror_view_and_copy(OtherSpace(), bounds);
+    copy.slices = Kokkos::create_mirror_view_and_copy(OtherSpace(), slices);
+    copy.local_ordering = Kokkos::create_mirror_view_and_copy(OtherSpace(), local_ordering);
+    copy.offsets = offsets;
+    copy.slice_offsets = slice_offsets;
+    copy.ndims = ndims;
+    copy.decomposition = decomposition;
+    copy.local_origin = local_origin;
+    copy.local_size = local_size;
+    copy.is_periodic = is_periodic;
+    copy.is_uniform = is_uniform;
+    copy.inverse_widths = inverse_widths;
+    copy.my_rank = my_rank;
+    return copy;
+  }
+};
+
+using spatial_indexh = CartesianSpatialIndex<HostSpace::memory_space>;
+/**< Spatial index with bounds in host memory */
+using spatial_indexd = CartesianSpatialIndex<ExecSpace::memory_space>;
+/**< Spatial index with bounds in device memory */
+
+#endif  // LIBS_CARTESIANDOMAIN_SPATIAL_INDEX_HPP_
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: cleo_driver.hpp
+ * Project: cleo_driver
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functions to assemble CLEO's super-droplet model (SDM) and the dynamics coupled to it from the
+ * "driver" (and other) parameters of a configuration file at runtime. Choices which alter the
+ * types of the SDM (collision kernel(s), terminal velocity formula, boundary conditions and coupled
+ * dynamics) are dispatched to a set of pre-instantiated template combinations so that no extra
+ * branches appear in SDM's kernels. Condensation and observers which are not chosen are given an
+ * interval of LIMITVALUES::uintmax so that they never act, as for CLEO's python bindings.
+ */
+
+#ifndef LIBS_CLEO_DRIVER_CLEO_DRIVER_HPP_
+#define LIBS_CLEO_DRIVER_CLEO_DRIVER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../cleoconstants.hpp"
+#include "cartesiandomain/cartesianmaps.hpp"
+#include "cartesiandomain/createcartesianmaps.hpp"
+#include "cartesiandomain/movement/cartesian_movement.hpp"
+#include "cleo_driver/sdm_from_config.hpp"
+#include "configuration/config.hpp"
+#include "coupldyn_cvode/cvodecomms.hpp"
+#include "coupldyn_cvode/cvodedynamics.hpp"
+#include "coupldyn_cvode/initgbxs_cvode.hpp"
+#include "coupldyn_fromfile/fromfile_cartesian_dynamics.hpp"
+#include "coupldyn_fromfile/fromfilecomms.hpp"
+#include "coupldyn_null/nulldynamics.hpp"
+#include "coupldyn_null/nulldyncomms.hpp"
+#include "gridboxes/boundary_conditions.hpp"
+#include "gridboxes/gridboxmaps.hpp"
+#include "gridboxes/sortsupers.hpp"
+#include "initialise/init_supers_from_binary.hpp"
+#include "initialise/initgbxsnull.hpp"
+#include "initialise/initialconditions.hpp"
+#include "initialise/timesteps.hpp"
+#include "observers/collect_data_for_simple_dataset.hpp"
+#include "observers/fused_gridboxes_observer.hpp"
+#include "observers/gbxindex_observer.hpp"
+#include "observers/massmoments_observer.hpp"
+#include "observers/nsupers_observer.hpp"
+#include "observers/observers.hpp"
+#include "observers/optional_observer.hpp"
+#include "observers/sdmmonitor/monitor_precipitation_observer.hpp"
+#include "observers/streamout_observer.hpp"
+#include "observers/superdrops_observer.hpp"
+#include "observers/sync_store_observer.hpp"
+#include "observers/thermo_observer.hpp"
+#include "observers/time_observer.hpp"
+#include "observers/totnsupers_observer.hpp"
+#include "observers/windvel_observer.hpp"
+#include "runcleo/coupleddynamics.hpp"
+#include "runcleo/couplingcomms.hpp"
+#include "runcleo/runcleo.hpp"
+#include "runcleo/sdmmethods.hpp"
+#include "superdrops/microphysicalprocess.hpp"
+#include "superdrops/terminalvelocity.hpp"
+
+/* returns interval in model timesteps for an interval given in seconds [s], or
+LIMITVALUES::uintmax (i.e. never on step) if interval <= 0.0 */
+inline unsigned int driver_interval(const double interval) {
+  if (interval <= 0.0) {
+    return LIMITVALUES::uintmax;
+  }
+  return realtime2step(interval);
+}
+
+inline GridboxMaps auto create_gbxmaps(const Config& config) {
+  check_lexicographic_gridbox_ordering(config.get_gridbox_ordering());
+  const auto gbxmaps = create_cartesian_maps(config.get_ngbxs(), config.get_nspacedims(),
+                                             config.get_grid_filename());
+  return gbxmaps;
+}
+
+template <typename Dataset>
+inline Observer auto create_gridboxes_observer(const unsigned int interval, Dataset& dataset,
+                                               const size_t maxchunk, const size_t ngbxs) {
+  const CollectDataForDataset<Dataset> auto thermo = CollectThermo(dataset, maxchunk, ngbxs);
+  const CollectDataForDataset<Dataset> auto windvel = CollectWindVel(dataset, maxchunk, ngbxs);
+  const CollectDataForDataset<Dataset> auto nsupers = CollectNsupers(dataset, maxchunk, ngbxs);
+
+  const CollectDataForDataset<Dataset> auto collect_gbxdata = nsupers >> windvel >> thermo;
+  return FusedGridboxesObserver(interval, dataset, collect_gbxdata);
+}
+
+/* Returns criteria for selecting the sample of superdroplets written by the superdrops observer
+from the (dimensional) parameters in the configuration. Empty ranges select any value. */
+inline SuperdropsSampleCriteria superdrops_sample_criteria(const Config& config) {
+  const auto params = config.get_superdrops_sample();
+
+  const auto dimless_range = [](const std::vector<double>& range, const double scale) {
+    if (range.empty()) {
+      return Kokkos::pair<double, double>{LIMITVALUES::llim, LIMITVALUES::ulim};
+    }
+    return Kokkos::pair<double, double>{range.at(0) / scale, range.at(1) / scale};
+  };
+
+  auto criteria = SuperdropsSampleCriteria{};
+  criteria.id_stride = params.id_stride;
+  criteria.id_fraction = params.id_fraction;
+  criteria.radius_range = dimless_range(params.radius_range, dlc::R0);
+  criteria.coord3_range = dimless_range(params.coord3_range, dlc::COORD0);
+  criteria.coord1_range = dimless_range(params.coord1_range, dlc::COORD0);
+  criteria.coord2_range = dimless_range(params.coord2_range, dlc::COORD0);
+  return criteria;
+}
+
+/* Returns observer of superdroplets which writes data for the sample of superdroplets selected by
+the configuration (by default all superdroplets) */
+template <typename Dataset, typename Store>
+inline Observer auto create_superdrops_observer(const Config& config, const unsigned int interval,
+                                                Dataset& dataset, Store& store,
+                                                const size_t maxchunk) {
+  CollectDataForDataset<Dataset> auto sdid = CollectSdId(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto sdgbxindex = CollectSdgbxindex(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto xi = CollectXi(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto radius = CollectRadius(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto msol = CollectMsol(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto coord3 = CollectCoord3(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto coord1 = CollectCoord1(dataset, maxchunk);
+  CollectDataForDataset<Dataset> auto coord2 = CollectCoord2(dataset, maxchunk);
+
+  const auto collect_sddata =
+      coord1 >> coord2 >> coord3 >> msol >> radius >> xi >> sdgbxindex >> sdid;
+  return SuperdropsObserver(interval, dataset, store, maxchunk, collect_sddata,
+                            superdrops_sample_criteria(config));
+}
+
+/* Returns observer which tells the store that an observation has ended every OBSTSTEP if the
+store can be told (e.g. PosixFSStore for its fsync policy), otherwise returns an observer which does
+nothing */
+template <typename Store>
+inline Observer auto create_store_observer(const Config& config, Store& store) {
+  if constexpr (SyncableStore<Store>) {
+    return SyncStoreObserver(driver_interval(config.get_timesteps().OBSTSTEP), store);
+  } else {
+    return NullObserver{};
+  }
+}
+
+/* Returns combination of all the observers of the generic driver, each with the interval given by
+the driver configuration. Observers not enabled by the configuration are not created (and so do not
+create arrays in the dataset), except for the gbxindex observer which always observes once at the
+start. Throws error if observers which write to arrays are enabled without the time observer. */
+template <typename Dataset, typename Store>
+inline Observer auto create_observer(const Config& config, Dataset& dataset, Store& store) {
+  const auto intervals = config.get_driver().observers;
+  const auto maxchunk = config.get_maxchunk();
+  const auto ngbxs = config.get_ngbxs();
+
+  const auto is_enabled = [](const double interval) { return interval > 0.0; };
+  const auto is_arrays = is_enabled(intervals.totnsupers) || is_enabled(intervals.massmoms) ||
+                         is_enabled(intervals.rainmassmoms) || is_enabled(intervals.gridboxes) ||
+                         is_enabled(intervals.superdrops) || is_enabled(intervals.precip);
+  if (is_arrays && !is_enabled(intervals.time)) {
+    throw std::invalid_argument("driver observers which write to arrays require time observer");
+  }
+
+  const Observer auto obs0 = optional_observer(is_enabled(intervals.streamout), [&]() {
+    return StreamOutObserver(driver_interval(intervals.streamout), &step2realtime);
+  });
+
+  const Observer auto obs1 = optional_observer(is_enabled(intervals.time), [&]() {
+    return TimeObserver(driver_interval(intervals.time), dataset, store, maxchunk,
+                        &step2dimlesstime);
+  });
+
+  const Observer auto obs2 = GbxindexObserver(dataset, store, maxchunk, ngbxs);
+
+  const Observer auto obs3 = optional_observer(is_enabled(intervals.totnsupers), [&]() {
+    return TotNsupersObserver(driver_interval(intervals.totnsupers), dataset, store, maxchunk);
+  });
+
+  const Observer auto obs4 = optional_observer(is_enabled(intervals.massmoms), [&]() {
+    return MassMomentsObserver(driver_interval(intervals.massmoms), dataset, store, maxchunk,
+                               ngbxs);
+  });
+
+  const Observer auto obs5 = optional_observer(is_enabled(intervals.rainmassmoms), [&]() {
+    return MassMomentsRaindropsObserver(driver_interval(intervals.rainmassmoms), dataset, store,
+                                        maxchunk, ngbxs);
+  });
+
+  const Observer auto obs6 = optional_observer(is_enabled(intervals.gridboxes), [&]() {
+    return create_gridboxes_observer(driver_interval(intervals.gridboxes), dataset, maxchunk,
+                                     ngbxs);
+  });
+
+  const Observer auto obs7 = optional_observer(is_enabled(intervals.superdrops), [&]() {
+    return create_superdrops_observer(config, driver_interval(intervals.superdrops), dataset,
+                                      store, maxchunk);
+  });
+
+  const Observer auto obs8 = optional_observer(
+      is_enabled(intervals.precip),
+      [&]() {
+        return MonitorPrecipitationObserver(driver_interval(intervals.precip), dataset, store,
+                                            maxchunk, ngbxs);
+      },
+      MonitorPrecipitation(0));
+
+  const Observer auto obs9 = create_store_observer(config, store);
+
+  return obs0 >> obs1 >> obs2 >> obs3 >> obs4 >> obs5 >> obs6 >> obs7 >> obs8 >> obs9;
+}
+
+template <typename Dataset, typename Store, MicrophysicalProcess Microphys, VelocityFormula TV,
+          BoundaryConditions<CartesianMaps> BCs>
+inline auto create_sdm(const Config& config, const Timesteps& tsteps, Dataset& dataset,
+                       Store& store, const Microphys microphys, const TV terminalv,
+                       const BCs boundary_conditions) {
+  const auto couplstep = (unsigned int)tsteps.get_couplstep();
+  const GridboxMaps auto gbxmaps = create_gbxmaps(config);
+  const MoveSupersInDomain movesupers =
+      create_movement(tsteps, gbxmaps, terminalv, boundary_conditions);
+  const Observer auto obs = create_observer(config, dataset, store);
+
+  return SDMMethods(couplstep, gbxmaps, microphys, movesupers, obs);
+}
+
+/* creates the dynamics of the type given in the configuration, the coupling between it and the
+SDM, and the initial conditions, and then runs CLEO (SDM coupled to the dynamics solver) */
+template <typename SDM>
+inline void run_coupled_cleo(const Config& config, const Timesteps& tsteps, const SDM& sdm) {
+  const auto type = config.get_driver().coupled_dynamics;
+  const auto couplstep = (unsigned int)tsteps.get_couplstep();
+  const auto t_end = (unsigned int)tsteps.get_t_end();
+  const auto initsupers = InitSupersFromBinary(config.get_initsupersfrombinary(), sdm.gbxmaps);
+  const auto sort_method = sort_supers_method(config.get_sort_supers_method());
+  const auto max_capacity = config.get_max_supers_capacity();
+
+  if (type == "null") {
+    CoupledDynamics auto coupldyn = NullDynamics(couplstep);
+    const CouplingComms<CartesianMaps, NullDynamics> auto comms = NullDynComms{};
+    const auto initgbxs = InitGbxsNull(sdm.gbxmaps.get_local_ngridboxes_hostcopy());
+    const InitialConditions auto initconds = InitConds(initsupers, initgbxs);
+
+    const RunCLEO runcleo(sdm, coupldyn, comms, sort_method, max_capacity);
+    runcleo(initconds, t_end);
+  } else if (type == "fromfile") {
+    const auto h_ndims = sdm.gbxmaps.get_global_ndims_hostcopy();
+    const std::array<size_t, 3> ndims({h_ndims(0), h_ndims(1), h_ndims(2)});
+    const auto nsteps = (unsigned int)(std::ceil(t_end / couplstep) + 1);
+
+    CoupledDynamics auto coupldyn =
+        FromFileDynamics(config.get_fromfiledynamics(), couplstep, ndims, nsteps);
+    const CouplingComms<CartesianMaps, FromFileDynamics> auto comms = FromFileComms{};
+    const auto initgbxs = InitGbxsNull(sdm.gbxmaps.get_local_ngridboxes_hostcopy());
+    const InitialConditions auto initconds = InitConds(initsupers, initgbxs);
+
+    const RunCLEO runcleo(sdm, coupldyn, comms, sort_method, max_capacity);
+    runcleo(initconds, t_end);
+  } else if (type == "cvode") {
+    CoupledDynamics auto coupldyn =
+        CvodeDynamics(config.get_cvodedynamics(), couplstep, &step2dimlesstime);
+    const CouplingComms<CartesianMaps, CvodeDynamics> auto comms = CvodeComms{};
+    const auto initgbxs = InitGbxsCvode(config.get_cvodedynamics());
+    const InitialConditions auto initconds = InitConds(initsupers, initgbxs);
+
+    const RunCLEO runcleo(sdm, coupldyn, comms, sort_method, max_capacity);
+    runcleo(initconds, t_end);
+  } else {
+    throw std::invalid_argument("unknown driver 'coupled_dynamics': " + type);
+  }
+}
+
+/* Assembles CLEO from the configuration and runs it. Each combination of collision kernel(s),
+terminal velocity formula, boundary conditions and coupled dynamics is a separate
+(pre-instantiated) template instantiation of CLEO, chosen at runtime by the driver
+configuration. */
+template <typename Dataset, typename Store>
+inline void run_cleo_driver(const Config& config, const Timesteps& tsteps, Dataset& dataset,
+                            Store& store) {
+  with_microphysics(config, tsteps, [&](const auto microphys) {
+    with_terminal_velocity(config, [&](const auto terminalv) {
+      with_boundary_conditions(config, [&](const auto boundary_conditions) {
+        /* CLEO Super-Droplet Model (excluding coupled dynamics solver) */
+        const SDMMethods sdm = create_sdm(config, tsteps, dataset, store, microphys, terminalv,
+                                          boundary_conditions);
+
+        /* Run CLEO (SDM coupled to dynamics solver) */
+        run_coupled_cleo(config, tsteps, sdm);
+      });
+    });
+  });
+}
+
+#endif  // LIBS_CLEO_DRIVER_CLEO_DRIVER_HPP_
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: main_cleo.cpp
+ * Project: cleo_driver
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * runs the CLEO super-droplet model (SDM) with microphysics, superdroplet motion, observers,
+ * boundary conditions and coupled dynamics all chosen by the configuration file at runtime.
+ * After make/compiling, execute for example via:
+ * ./libs/cleo_driver/cleo ../config.yaml
+ */
+
+#include <Kokkos_Core.hpp>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+#include "./cleo_driver.hpp"
+#include "configuration/communicator.hpp"
+#include "configuration/config.hpp"
+#include "initialise/timesteps.hpp"
+#include "zarr/configured_store.hpp"
+#include "zarr/simple_dataset.hpp"
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    throw std::invalid_argument("configuration file(s) not specified");
+  }
+
+  Kokkos::Timer kokkostimer;
+
+  /* Read input parameters from configuration file(s) */
+  const std::filesystem::path config_filename(argv[1]);  // path to configuration file
+  const Config config(config_filename);
+
+  /* Initialize Communicator here */
+  init_communicator init_comm(argc, argv, config);
+
+  /* Prevent generic driver from running with more than one MPI process */
+  const auto comm_size = init_communicator::get_comm_size();
+  if (comm_size > 1) {
+    throw std::invalid_argument(
+        "ERROR: The generic driver is not prepared to be run with more than one MPI process");
+  }
+
+  /* Initialise Kokkos parallel environment */
+  Kokkos::initialize(config.get_kokkos_initialization_settings());
+  {
+    Kokkos::print_configuration(std::cout);
+
+    /* Create timestepping parameters from configuration */
+    const Timesteps tsteps(config.get_timesteps());
+
+    /* Create Xarray dataset wit Zarr backend for writing output data to a store of the type
+    chosen by the configuration, then assemble CLEO as chosen by the configuration and run it */
+    with_configured_store(config, [&](auto& store) {
+      auto dataset = SimpleDataset(store, config.get_shard_nchunks(),
+                                   config.get_metadata_commit_nobs(),
+                                   config.get_crash_safe_metadata());
+      run_cleo_driver(config, tsteps, dataset, store);
+    });
+  }
+  Kokkos::finalize();
+
+  const auto ttot = double{kokkostimer.seconds()};
+  std::cout << "-----\n CLEO Total Program Duration: " << ttot << "s \n-----\n";
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: sdm_from_config.hpp
+ * Project: cleo_driver
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functions to create the microphysics and the movement of super-droplets of CLEO's super-droplet
+ * model (SDM) from the "driver" parameters of a configuration file at runtime. These need neither
+ * the coupled dynamics nor the observers of the generic driver, so executables which assemble the
+ * rest of CLEO themselves (e.g. benchmarks) can use them without depending on either.
+ */
+
+#ifndef LIBS_CLEO_DRIVER_SDM_FROM_CONFIG_HPP_
+#define LIBS_CLEO_DRIVER_SDM_FROM_CONFIG_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <stdexcept>
+#include <string>
+
+#include "../cleoconstants.hpp"
+#include "cartesiandomain/cartesianmaps.hpp"
+#include "cartesiandomain/movement/add_supers_to_domain.hpp"
+#include "cartesiandomain/movement/cartesian_motion.hpp"
+#include "cartesiandomain/movement/cartesian_movement.hpp"
+#include "configuration/config.hpp"
+#include "gridboxes/boundary_conditions.hpp"
+#include "initialise/timesteps.hpp"
+#include "superdrops/collisions/breakup.hpp"
+#include "superdrops/collisions/breakup_nfrags.hpp"
+#include "superdrops/collisions/coalbure.hpp"
+#include "superdrops/collisions/coalbure_flag.hpp"
+#include "superdrops/collisions/coalescence.hpp"
+#include "superdrops/collisions/collisions.hpp"
+#include "superdrops/collisions/golovinprob.hpp"
+#include "superdrops/collisions/longhydroprob.hpp"
+#include "superdrops/collisions/lowlistprob.hpp"
+#include "superdrops/condensation.hpp"
+#include "superdrops/microphysicalprocess.hpp"
+#include "superdrops/motion.hpp"
+#include "superdrops/terminalvelocity.hpp"
+
+template <VelocityFormula TV, BoundaryConditions<CartesianMaps> BCs>
+inline auto create_movement(const Timesteps& tsteps, const CartesianMaps& gbxmaps,
+                            const TV terminalv, const BCs boundary_conditions) {
+  const Motion<CartesianMaps> auto motion =
+      CartesianMotion(tsteps.get_motionstep(), &step2dimlesstime, terminalv);
+
+  return cartesian_movement(gbxmaps, motion, boundary_conditions);
+}
+
+/* Returns condensation microphysical process if it is enabled by the driver configuration,
+otherwise returns condensation with settings such that its on_step function never returns true.
+(Condensation is switched at runtime rather than by its type in order to halve the number of
+template instantiations of CLEO in the driver.) */
+inline MicrophysicalProcess auto create_condensation(const Config& config,
+                                                     const Timesteps& tsteps) {
+  const MicrophysicsFunc auto no_cond = DoCondensation(false, 0.0, 0, 0.0, 0.0, 0.0);
+  MicrophysicalProcess auto cond = ConstTstepMicrophysics(LIMITVALUES::uintmax, no_cond);
+  if (config.get_driver().enable_condensation) {
+    const auto c = config.get_condensation();
+    cond = Condensation(tsteps.get_condstep(), &step2dimlesstime, c.do_alter_thermo, c.maxniters,
+                        c.rtol, c.atol, c.MINSUBTSTEP, &realtime2dimless);
+  }
+  return cond;
+}
+
+/* calls 'func' with the microphysics chosen by the driver configuration, i.e. condensation (see
+create_condensation) combined with the collision microphysics named by 'collision_kernel':
+null = no collisions,
+long = collision-coalescence with Long's hydrodynamic kernel,
+golovin = collision-coalescence with Golovin's kernel,
+lowlist = collision-coalescence and collision-breakup with Low and List's kernels,
+szakallurbich, straub, testikstraub or constcoal = collision-coalescence, breakup and rebound with
+Long's hydrodynamic kernel and Szakall and Urbich's, Straub et al.'s, Testik and Straub's or a
+constant coalescence efficiency (see CoalBuReFlag) to decide the outcome of each collision. */
+template <typename Func>
+inline void with_microphysics(const Config& config, const Timesteps& tsteps, const Func func) {
+  const MicrophysicalProcess auto cond = create_condensation(config, tsteps);
+
+  const auto collstep = tsteps.get_collstep();
+  const auto sampling =
+      config.get_collisions().majorant_sampling ? PairSampling::majorant : PairSampling::direct;
+  const auto terminalv = RogersGKTerminalVelocity{};
+  const auto constnfrags = [&config]() {
+    return ConstNFrags(config.get_breakup().constnfrags.nfrags);
+  };
+  const auto coalbure = [&](const NFragments auto nfrags, const CoalBuReFlag auto flag) {
+    return CoalBuRe(collstep, &step2realtime, LongHydroProb(), nfrags, flag, sampling);
+  };
+
+  const auto kernel = config.get_driver().collision_kernel;
+  if (kernel == "null") {
+    func(cond);
+  } else if (kernel == "long") {
+    func(cond >> CollCoal(collstep, &step2realtime, LongHydroProb(), sampling));
+  } else if (kernel == "golovin") {
+    func(cond >> CollCoal(collstep, &step2realtime, GolovinProb(), sampling));
+  } else if (kernel == "lowlist") {
+    const MicrophysicalProcess auto coal =
+        CollCoal(collstep, &step2realtime, LowListCoalProb(terminalv), sampling);
+    const MicrophysicalProcess auto bu =
+        CollBu(collstep, &step2realtime, LowListBuProb(terminalv), constnfrags(), sampling);
+    func(cond >> coal >> bu);
+  } else if (kernel == "szakallurbich") {
+    func(cond >> coalbure(constnfrags(), SUCoalBuReFlag(terminalv)));
+  } else if (kernel == "straub") {
+    func(cond >> coalbure(CollisionKineticEnergyNFrags(terminalv), StraubCoalBuReFlag(terminalv)));
+  } else if (kernel == "testikstraub") {
+    func(cond >> coalbure(CollisionKineticEnergyNFrags(terminalv), TSCoalBuReFlag(terminalv)));
+  } else if (kernel == "constcoal") {
+    const auto coaleff = config.get_coalescence().constcoaleff.coaleff;
+    func(cond >> coalbure(CollisionKineticEnergyNFrags(terminalv), ConstCoalBuReFlag{coaleff}));
+  } else {
+    throw std::invalid_argument("unknown driver 'collision_kernel': " + kernel);
+  }
+}
+
+/* calls 'func' with the terminal velocity formula named in the driver configuration */
+template <typename Func>
+inline void with_terminal_velocity(const Config& config, const Func func) {
+  const auto name = config.get_driver().terminal_velocity;
+  if (name == "null") {
+    func(NullTerminalVelocity{});
+  } else if (name == "simmel") {
+    func(SimmelTerminalVelocity{});
+  } else if (name == "rogersyau") {
+    func(RogersYauTerminalVelocity{});
+  } else if (name == "rogersgk") {
+    func(RogersGKTerminalVelocity{});
+  } else {
+    throw std::invalid_argument("unknown driver 'terminal_velocity': " + name);
+  }
+}
+
+/* calls 'func' with the boundary conditions of the type given in the configuration */
+template <typename Func>
+inline void with_boundary_conditions(const Config& config, const Func func) {
+  const auto type = config.get_driver().boundary_conditions;
+  if (type == "null") {
+    func(NullBoundaryConditions{});
+  } else if (type == "addsuperstodomain") {
+    func(AddSupersToDomain(config.get_addsuperstodomain()));
+  } else {
+    throw std::invalid_argument("unknown driver 'boundary_conditions': " + type);
+  }
+}
+
+#endif  // LIBS_CLEO_DRIVER_SDM_FROM_CONFIG_HPP_
@@ -72,10 +72,13 @@ PYBIND11_MODULE(cleo_python_bindings, m) {
   /* superdroplets */
   pySupersInDomain(m);
   pycreate_supers_from_binary(m);
+  pysuperdrops_arrays(m);
+  pySuperdropsArrays(m);
 
   /* Gridboxes */
   pycreate_gbxs_cartesian_null(m);
   pyGridboxesDualView(m);
+  pygridboxes_state_arrays(m);
 
   /* maps */
   pyCartesianMaps(m);
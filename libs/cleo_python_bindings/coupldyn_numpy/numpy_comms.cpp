@@ -27,7 +27,7 @@ KOKKOS_FUNCTION void NumpyComms::receive_dynamics(const GbxMaps& gbxmaps,
   const size_t ngbxs(h_gbxs.extent(0));
 
   Kokkos::parallel_for("receive_dynamics", Kokkos::RangePolicy<HostSpace>(0, ngbxs),
-                       [=](const size_t ii) {
+                       [=, &numpydyn](const size_t ii) {
                          // for (size_t ii = 0; ii < ngbxs; ++ii) {
                          const auto idx = gbxmaps.local_to_global_gridbox_index(ii);
                          State& state(h_gbxs(ii).state);
@@ -26,7 +26,8 @@ void pyCartesianMaps(py::module& m) {
 
 void pycreate_cartesian_maps(py::module& m) {
   m.def("create_cartesian_maps", &create_cartesian_maps, "returns CartesianMaps instance",
-        py::arg("ngbxs"), py::arg("nspacedims"), py::arg("grid_filename"));
+        py::arg("ngbxs"), py::arg("nspacedims"), py::arg("grid_filename"),
+        py::arg("gridbox_ordering") = std::string("lexicographic"));
 }
 
 void pyAddSupersToDomain(py::module& m) {
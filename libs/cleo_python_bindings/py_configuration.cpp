@@ -24,6 +24,8 @@ void pyConfig(py::module& m) {
       .def(py::init<const std::filesystem::path>(), py::arg("config_filename"))
       .def("get_ngbxs", &Config::get_ngbxs)
       .def("get_nspacedims", &Config::get_nspacedims)
+      .def("get_sort_supers_method", &Config::get_sort_supers_method)
+      .def("get_max_supers_capacity", &Config::get_max_supers_capacity)
       .def("get_grid_filename", &Config::get_grid_filename)
       .def("get_addsuperstodomain", &Config::get_addsuperstodomain)
       .def("get_initsupersfrombinary", &Config::get_initsupersfrombinary)
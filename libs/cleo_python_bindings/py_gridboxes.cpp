@@ -18,15 +18,73 @@
 
 #include "./py_gridboxes.hpp"
 
+py::dict gridboxes_state_arrays(dualview_gbx gbxs, const bool writable);
+
 void pyNullBoundaryConditions(py::module& m) {
   py::class_<pyca::bcs_null>(m, "NullBoundaryConditions").def(py::init());
 }
 
 void pySupersInDomain(py::module& m) {
   py::class_<SupersInDomain>(m, "SupersInDomain")
-      .def(py::init<const viewd_supers, const unsigned int>());
+      .def(py::init<const viewd_supers, const unsigned int>())
+      .def("domain_nsupers", &SupersInDomain::domain_nsupers)
+      .def("get_capacity", &SupersInDomain::get_capacity)
+      .def("get_version", &SupersInDomain::get_version);
 }
 
 void pyGridboxesDualView(py::module& m) {
   py::class_<dualview_gbx>(m, "Gridboxes").def(py::init());
 }
+
+void pygridboxes_state_arrays(py::module& m) {
+  m.def("gridboxes_state_arrays", &gridboxes_state_arrays,
+        "returns dictionary of numpy arrays viewing states of gridboxes", py::arg("gbxs"),
+        py::arg("writable") = false);
+}
+
+py::dict gridboxes_state_arrays(dualview_gbx gbxs, const bool writable) {
+  /* Returns dictionary of (dimensionless) gridbox indexes and State variables of the gridboxes
+  as numpy arrays which view the host view of the gridboxes without copying. Host view is first
+  synced with device, and if writable is true it is marked as modified such that changes made via
+  the arrays are synced back to device before the next step of SDM. Arrays keep the memory they
+  view alive. Gridbox indexes are always read-only and velocities have shape (ngbxs, 2) for the
+  {lower, upper} face of each gridbox.
+  */
+  gbxs.sync_host();
+  if (writable) {
+    gbxs.modify_host();
+  }
+
+  const auto h_gbxs = gbxs.view_host();
+  const auto base = numpy_base_for_view(h_gbxs);
+  const auto n = size_t{h_gbxs.extent(0)};
+  const auto stride = size_t{h_gbxs.stride(0) * sizeof(Gridbox)};
+  const auto data = h_gbxs.data();
+
+  const auto gbx = Gridbox{};
+  const auto offset = [&gbx](const void* member) {
+    return static_cast<size_t>(reinterpret_cast<const char*>(member) -
+                               reinterpret_cast<const char*>(&gbx));
+  };
+  const auto& state = gbx.state;
+
+  auto arrays = py::dict();
+  arrays["gbxindex"] = numpy_view_of_member<unsigned int>(data, offset(&gbx.gbxindex.value), n,
+                                                          stride, base, false);
+  arrays["press"] =
+      numpy_view_of_member<double>(data, offset(&state.press), n, stride, base, writable);
+  arrays["temp"] =
+      numpy_view_of_member<double>(data, offset(&state.temp), n, stride, base, writable);
+  arrays["qvap"] =
+      numpy_view_of_member<double>(data, offset(&state.qvap), n, stride, base, writable);
+  arrays["qcond"] =
+      numpy_view_of_member<double>(data, offset(&state.qcond), n, stride, base, writable);
+  arrays["wvel"] =
+      numpy_view_of_member<double>(data, offset(&state.wvel), n, stride, base, writable, 2);
+  arrays["uvel"] =
+      numpy_view_of_member<double>(data, offset(&state.uvel), n, stride, base, writable, 2);
+  arrays["vvel"] =
+      numpy_view_of_member<double>(data, offset(&state.vvel), n, stride, base, writable, 2);
+
+  return arrays;
+}
@@ -23,6 +23,7 @@
 
 #include "../kokkosaliases.hpp"
 #include "./cleo_python_bindings_aliases.hpp"
+#include "./py_numpy_views.hpp"
 #include "gridboxes/boundary_conditions.hpp"
 #include "gridboxes/gridbox.hpp"
 #include "gridboxes/supersindomain.hpp"
@@ -36,4 +37,6 @@ void pySupersInDomain(py::module& m);
 
 void pyGridboxesDualView(py::module& m);
 
+void pygridboxes_state_arrays(py::module& m);
+
 #endif  // LIBS_CLEO_PYTHON_BINDINGS_PY_GRIDBOXES_HPP_
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: py_numpy_views.hpp
+ * Project: cleo_python_bindings
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Helpers for creating numpy arrays which view (i.e. do not copy) the members of structs stored
+ * in (host-accessible) Kokkos views, e.g. the attributes of superdroplets or the states of
+ * gridboxes, for python bindings.
+ */
+
+#ifndef LIBS_CLEO_PYTHON_BINDINGS_PY_NUMPY_VIEWS_HPP_
+#define LIBS_CLEO_PYTHON_BINDINGS_PY_NUMPY_VIEWS_HPP_
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace py = pybind11;
+
+/* returns capsule which owns a (reference counted) copy of the Kokkos view handle and so keeps
+the memory of the view alive for as long as any numpy array with the capsule as its base exists */
+template <typename ViewType>
+py::capsule numpy_base_for_view(const ViewType view) {
+  return py::capsule(new ViewType(view),
+                     [](void* v) { delete reinterpret_cast<ViewType*>(v); });
+}
+
+/* returns numpy array which views (without copying) a member of type T of each of the 'n' structs
+stored contiguously in memory starting at 'data'. The member is 'offset' bytes from the start of a
+struct of size 'stride' bytes. If ncomponents > 1 the member is itself contiguous array of
+ncomponents elements of type T (e.g. Kokkos::pair<double, double>) and the returned array has
+shape (n, ncomponents). Numpy array is read-only unless writable is true. */
+template <typename T>
+py::array numpy_view_of_member(const void* data, const size_t offset, const size_t n,
+                               const size_t stride, const py::capsule& base, const bool writable,
+                               const size_t ncomponents = 1) {
+  const auto ptr = reinterpret_cast<const std::byte*>(data) + offset;
+  auto shape = std::vector<py::ssize_t>{static_cast<py::ssize_t>(n)};
+  auto strides = std::vector<py::ssize_t>{static_cast<py::ssize_t>(stride)};
+  if (ncomponents > 1) {
+    shape.push_back(static_cast<py::ssize_t>(ncomponents));
+    strides.push_back(static_cast<py::ssize_t>(sizeof(T)));
+  }
+
+  auto array = py::array(py::dtype::of<T>(), shape, strides, ptr, base);
+  if (!writable) {
+    array.attr("setflags")(py::arg("write") = false);
+  }
+  return array;
+}
+
+#endif  // LIBS_CLEO_PYTHON_BINDINGS_PY_NUMPY_VIEWS_HPP_
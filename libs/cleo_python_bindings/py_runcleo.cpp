@@ -20,8 +20,15 @@
 #include "./py_runcleo.hpp"
 
 void pycreate_supers_from_binary(py::module& m) {
-  m.def("create_supers_from_binary", &create_supers<InitSupersFromBinary>,
-        "returns SupersInDomain instance", py::arg("sdic"), py::arg("gbxindex_max"));
+  m.def(
+      "create_supers_from_binary",
+      [](const InitSupersFromBinary& sdic, const unsigned int gbxindex_max,
+         const std::string& sort_method, const size_t max_capacity) {
+        return create_supers(sdic, gbxindex_max, sort_supers_method(sort_method), max_capacity);
+      },
+      "returns SupersInDomain instance", py::arg("sdic"), py::arg("gbxindex_max"),
+      py::arg("sort_method") = "counting_sort",
+      py::arg("max_capacity") = std::numeric_limits<size_t>::max());
 }
 
 void pycreate_gbxs_cartesian_null(py::module& m) {
@@ -45,10 +52,15 @@ void pyCartesianNullSDMMethods(py::module& m) {
       .def(
           "run_step",
           [](const pyca::sdm_cart_null& self, const unsigned int t_mdl,
-             const unsigned int t_mdl_next, const dualview_gbx gbxs, SupersInDomain& allsupers) {
+             const unsigned int t_mdl_next, dualview_gbx gbxs, SupersInDomain& allsupers) {
+            gbxs.sync_device();  // get device up to date with host
             self.run_step(t_mdl, t_mdl_next, gbxs.view_device(), allsupers);
+            gbxs.modify_device();  // mark device view of gbxs as modified
           },
-          py::arg("t_mdl"), py::arg("t_mdl_next"), py::arg("gbxs"), py::arg("allsupers"));
+          py::arg("t_mdl"), py::arg("t_mdl_next"), py::arg("gbxs"), py::arg("allsupers"))
+      .def("run_couplsteps", &run_sdm_couplsteps<pyca::sdm_cart_null>, py::arg("t_mdl"),
+           py::arg("ncouplsteps"), py::arg("gbxs"), py::arg("allsupers"), py::arg("coupldyn"),
+           py::arg("comms"), py::arg("on_couplstep") = py::none());
 }
 
 void pyCartesianSDMMethods(py::module& m) {
@@ -66,8 +78,13 @@ void pyCartesianSDMMethods(py::module& m) {
       .def(
           "run_step",
           [](const pyca::sdm_cart_all& self, const unsigned int t_mdl,
-             const unsigned int t_mdl_next, const dualview_gbx gbxs, SupersInDomain& allsupers) {
+             const unsigned int t_mdl_next, dualview_gbx gbxs, SupersInDomain& allsupers) {
+            gbxs.sync_device();  // get device up to date with host
             self.run_step(t_mdl, t_mdl_next, gbxs.view_device(), allsupers);
+            gbxs.modify_device();  // mark device view of gbxs as modified
           },
-          py::arg("t_mdl"), py::arg("t_mdl_next"), py::arg("gbxs"), py::arg("allsupers"));
+          py::arg("t_mdl"), py::arg("t_mdl_next"), py::arg("gbxs"), py::arg("allsupers"))
+      .def("run_couplsteps", &run_sdm_couplsteps<pyca::sdm_cart_all>, py::arg("t_mdl"),
+           py::arg("ncouplsteps"), py::arg("gbxs"), py::arg("allsupers"), py::arg("coupldyn"),
+           py::arg("comms"), py::arg("on_couplstep") = py::none());
 }
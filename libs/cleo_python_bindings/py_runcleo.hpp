@@ -22,11 +22,17 @@
 
 #include <pybind11/pybind11.h>
 
+#include <algorithm>
+#include <limits>
+#include <string>
+
 #include "../kokkosaliases.hpp"
 #include "./cleo_python_bindings_aliases.hpp"
 #include "cartesiandomain/cartesianmaps.hpp"
 #include "cartesiandomain/movement/add_supers_to_domain.hpp"
 #include "cartesiandomain/movement/cartesian_transport_across_domain.hpp"
+#include "coupldyn_numpy/numpy_comms.hpp"
+#include "coupldyn_numpy/numpy_dynamics.hpp"
 #include "gridboxes/boundary_conditions.hpp"
 #include "gridboxes/gridboxmaps.hpp"
 #include "gridboxes/movesupersindomain.hpp"
@@ -63,4 +69,57 @@ void pycreate_gbxs_cartesian_null(py::module& m);
 void pyCartesianNullSDMMethods(py::module& m);
 void pyCartesianSDMMethods(py::module& m);
 
+/*
+Runs SDM coupled to NumpyDynamics from t_mdl for ncouplsteps coupling steps and returns the model
+time reached (in model timesteps). Equivalent to calling receive_dynamics, at_start_step, run_step
+and send_dynamics from python in a loop, except that the GIL is released whilst SDM runs so that
+other python threads (e.g. a dynamical core) may run concurrently. If on_couplstep is not None, it
+is called (with the GIL held) as on_couplstep(t_mdl) at the start of every coupling step before the
+dynamics are received from coupldyn's numpy arrays, e.g. to fill them. Otherwise the (pre-filled)
+arrays are received as they are.
+*/
+template <typename SDMMethods>
+unsigned int run_sdm_couplsteps(const SDMMethods& sdm, unsigned int t_mdl,
+                                const unsigned int ncouplsteps, dualview_gbx gbxs,
+                                SupersInDomain& allsupers, NumpyDynamics& coupldyn,
+                                const NumpyComms& comms, const py::object& on_couplstep) {
+  auto t_end = t_mdl;
+  for (unsigned int n(0); n < ncouplsteps; ++n) {
+    t_end = sdm.next_couplstep(t_end);
+  }
+
+  while (t_mdl < t_end) {
+    const auto t_next = std::min(sdm.next_couplstep(t_mdl), sdm.obs.next_obs(t_mdl));
+    const auto is_couplstep = (t_mdl % sdm.get_couplstep() == 0);
+
+    if (is_couplstep) {
+      if (!on_couplstep.is_none()) {
+        on_couplstep(t_mdl);
+      }
+      gbxs.sync_host();
+      comms.receive_dynamics(sdm.gbxmaps, coupldyn, gbxs.view_host());
+      gbxs.modify_host();
+    }
+
+    coupldyn.run_step(t_mdl, t_next);
+
+    {
+      py::gil_scoped_release release;
+      gbxs.sync_device();
+      sdm.at_start_step(t_mdl, gbxs, allsupers);
+      sdm.run_step(t_mdl, t_next, gbxs.view_device(), allsupers);
+      gbxs.modify_device();
+    }
+
+    if (is_couplstep) {
+      gbxs.sync_host();
+      comms.send_dynamics(sdm.gbxmaps, gbxs.view_host(), coupldyn);
+    }
+
+    t_mdl = t_next;
+  }
+
+  return t_mdl;
+}
+
 #endif  // LIBS_CLEO_PYTHON_BINDINGS_PY_RUNCLEO_HPP_
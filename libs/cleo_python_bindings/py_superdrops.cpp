@@ -20,6 +20,8 @@
 
 pyca::micro_all create_microphysical_process(const Config& config, const Timesteps& tsteps);
 
+py::dict superdrops_arrays(const SupersInDomain& allsupers, const bool writable);
+
 void pyNullMicrophysicalProcess(py::module& m) {
   py::class_<pyca::micro_null>(m, "NullMicrophysicalProcess").def(py::init());
 }
@@ -37,6 +39,47 @@ void pycreate_microphysical_process(py::module& m) {
 
 void pyNullMotion(py::module& m) { py::class_<pyca::mo_null>(m, "NullMotion").def(py::init()); }
 
+void pysuperdrops_arrays(py::module& m) {
+  m.def("superdrops_arrays", &superdrops_arrays,
+        "returns dictionary of numpy arrays viewing attributes of superdroplets in domain",
+        py::arg("allsupers"), py::arg("writable") = false);
+}
+
+void pySuperdropsArrays(py::module& m) {
+  py::class_<SuperdropsArrays>(m, "SuperdropsArrays")
+      .def(py::init<const SupersInDomain&, const bool>(), py::keep_alive<1, 2>(),
+           py::arg("allsupers"), py::arg("writable") = false)
+      .def("__getitem__", &SuperdropsArrays::get_array)
+      .def("get_arrays", &SuperdropsArrays::get_arrays)
+      .def("is_current", &SuperdropsArrays::is_current);
+}
+
+SuperdropsArrays::SuperdropsArrays(const SupersInDomain& allsupers_, const bool writable_)
+    : allsupers(&allsupers_),
+      writable(writable_),
+      version(allsupers_.get_version()),
+      arrays(superdrops_arrays(allsupers_, writable_)) {}
+
+void SuperdropsArrays::update() {
+  if (!is_current()) {
+    arrays = superdrops_arrays(*allsupers, writable);
+    version = allsupers->get_version();
+  }
+}
+
+py::object SuperdropsArrays::get_array(const std::string& name) {
+  update();
+  if (!arrays.contains(name)) {
+    throw py::key_error("no superdroplet array called " + name);
+  }
+  return arrays[py::str(name)];
+}
+
+py::dict SuperdropsArrays::get_arrays() {
+  update();
+  return arrays;
+}
+
 pyca::micro_all create_microphysical_process(const Config& config, const Timesteps& tsteps) {
   /* Returns combined microphysical process which behaves like a null process unless
   settings for other processes are defined in config.
@@ -72,3 +115,48 @@ pyca::micro_all create_microphysical_process(const Config& config, const Timeste
   std::cout << "microphysical processes combined\n";
   return null >> cond >> colls;
 }
+
+py::dict superdrops_arrays(const SupersInDomain& allsupers, const bool writable) {
+  /* Returns dictionary of (dimensionless) attributes of the superdroplets in the domain as numpy
+  arrays. If superdroplets are in host-accessible memory (e.g. host-space builds) the arrays view
+  the superdroplets without copying, otherwise they view a host copy of the superdroplets. Arrays
+  keep the memory they view alive, however arrays are only valid until the superdroplets are next
+  sorted or reallocated (e.g. during a step of SDM), i.e. until allsupers.get_version() changes, so
+  should be re-obtained after each step (see SuperdropsArrays which does this automatically).
+
+  If writable is true, arrays can be used to modify the superdroplets. This requires superdroplets
+  in host-accessible memory. Superdroplet IDs are always read-only and there is no array of them if
+  superdroplets have no ID (i.e. Superdrop::IDType is EmptyID).
+  */
+  const auto d_supers = allsupers.domain_supers();
+  auto h_supers = Kokkos::create_mirror_view(d_supers);
+  if (h_supers.data() != d_supers.data()) {
+    if (writable) {
+      throw std::invalid_argument(
+          "writable superdroplet arrays require superdroplets in host-accessible memory");
+    }
+    Kokkos::deep_copy(h_supers, d_supers);
+  }
+
+  using FloatType = Superdrop::FloatType;
+  const auto base = numpy_base_for_view(h_supers);
+  const auto n = size_t{h_supers.extent(0)};
+  const auto stride = size_t{h_supers.stride(0) * sizeof(Superdrop)};
+  const auto data = h_supers.data();
+  const auto offs = Superdrop{}.get_member_offsets();
+
+  auto arrays = py::dict();
+  arrays["sdgbxindex"] = numpy_view_of_member<unsigned int>(data, offs.sdgbxindex, n, stride,
+                                                            base, writable);
+  arrays["coord3"] = numpy_view_of_member<double>(data, offs.coord3, n, stride, base, writable);
+  arrays["coord1"] = numpy_view_of_member<double>(data, offs.coord1, n, stride, base, writable);
+  arrays["coord2"] = numpy_view_of_member<double>(data, offs.coord2, n, stride, base, writable);
+  arrays["xi"] = numpy_view_of_member<uint64_t>(data, offs.xi, n, stride, base, writable);
+  arrays["radius"] = numpy_view_of_member<double>(data, offs.radius, n, stride, base, writable);
+  arrays["msol"] = numpy_view_of_member<FloatType>(data, offs.msol, n, stride, base, writable);
+  if (offs.sdId) {
+    arrays["sdId"] = numpy_view_of_member<size_t>(data, *offs.sdId, n, stride, base, false);
+  }
+
+  return arrays;
+}
@@ -23,10 +23,14 @@
 
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <string>
 
 #include "../cleoconstants.hpp"
 #include "./cleo_python_bindings_aliases.hpp"
+#include "./py_numpy_views.hpp"
 #include "configuration/config.hpp"
+#include "gridboxes/supersindomain.hpp"
 #include "initialise/timesteps.hpp"
 #include "superdrops/collisions/coalescence.hpp"
 #include "superdrops/collisions/collisions.hpp"
@@ -44,4 +48,34 @@ void pycreate_microphysical_process(py::module& m);
 
 void pyNullMotion(py::module& m);
 
+void pysuperdrops_arrays(py::module& m);
+void pySuperdropsArrays(py::module& m);
+
+/* numpy arrays viewing the attributes of the superdroplets in the domain (see superdrops_arrays).
+Arrays are re-created when they are accessed if the superdroplets have been sorted or reallocated
+since the arrays were last created, i.e. if the version of allsupers has changed. Arrays obtained
+by previous accesses are not updated and so should not be used after the superdroplets change. */
+class SuperdropsArrays {
+ private:
+  const SupersInDomain* allsupers; /**< superdroplets viewed by arrays (kept alive by python) */
+  bool writable;                   /**< true if arrays can be used to modify superdroplets */
+  size_t version;                  /**< version of allsupers when arrays were created */
+  py::dict arrays;                 /**< numpy arrays viewing superdroplet attributes */
+
+  /* re-create arrays if superdroplets have changed since they were created */
+  void update();
+
+ public:
+  SuperdropsArrays(const SupersInDomain& allsupers_, const bool writable_);
+
+  /* returns array for attribute called name, re-creating arrays first if necessary */
+  py::object get_array(const std::string& name);
+
+  /* returns dictionary of all arrays, re-creating arrays first if necessary */
+  py::dict get_arrays();
+
+  /* returns true if arrays (without being re-created) view the current superdroplets */
+  bool is_current() const { return version == allsupers->get_version(); }
+};
+
 #endif  // LIBS_CLEO_PYTHON_BINDINGS_PY_SUPERDROPS_HPP_
@@ -35,7 +35,10 @@ inline void pyFSStore(py::module& m) {
 }
 
 inline void pySimpleDataset(py::module& m) {
-  py::class_<SimpleDataset<FSStore>>(m, "SimpleDataset").def(py::init<FSStore&>());
+  py::class_<SimpleDataset<FSStore>>(m, "SimpleDataset")
+      .def(py::init<FSStore&>())
+      .def(py::init<FSStore&, size_t>())
+      .def(py::init<FSStore&, size_t, size_t, bool>());
 }
 
 #endif  // LIBS_CLEO_PYTHON_BINDINGS_PY_ZARR_HPP_
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: communication_metrics.cpp
+ * Project: configuration
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functionality for process-local record of MPI communication volume and time spent in MPI
+ * communication accumulated since the record was last reset.
+ */
+
+#include "configuration/communication_metrics.hpp"
+
+size_t communication_metrics::nsupers_sent = 0;
+size_t communication_metrics::nsupers_recv = 0;
+size_t communication_metrics::nbytes_sent = 0;
+size_t communication_metrics::nbytes_recv = 0;
+double communication_metrics::alltoall_time = 0.0;
+double communication_metrics::waitall_time = 0.0;
+double communication_metrics::gather_time = 0.0;
+
+/* add number of superdroplets and bytes sent to and received from other processes */
+void communication_metrics::add_sendrecv(const size_t nsent, const size_t nrecv,
+                                         const size_t bytes_sent, const size_t bytes_recv) {
+  nsupers_sent += nsent;
+  nsupers_recv += nrecv;
+  nbytes_sent += bytes_sent;
+  nbytes_recv += bytes_recv;
+}
+
+/* reset all metrics to zero */
+void communication_metrics::reset() {
+  nsupers_sent = 0;
+  nsupers_recv = 0;
+  nbytes_sent = 0;
+  nbytes_recv = 0;
+  alltoall_time = 0.0;
+  waitall_time = 0.0;
+  gather_time = 0.0;
+}
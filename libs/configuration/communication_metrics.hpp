@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: communication_metrics.hpp
+ * Project: configuration
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Header file for process-local record of MPI communication volume and time spent in MPI
+ * communication (e.g. sending/receiving superdroplets and collecting output data) accumulated
+ * since the record was last reset.
+ */
+
+#ifndef LIBS_CONFIGURATION_COMMUNICATION_METRICS_HPP_
+#define LIBS_CONFIGURATION_COMMUNICATION_METRICS_HPP_
+
+#include <cstddef>
+
+/**
+ * @brief Process-local (i.e. per MPI rank) record of communication volume and time spent in
+ * (potentially blocking) MPI calls since the record was last reset.
+ *
+ * Metrics are accumulated by the functions which communicate (e.g. sendrecv_supers and the
+ * CollectiveDataset gathers) at negligible cost using MPI_Wtime, and can be read and reset by an
+ * observer, e.g. the LoadImbalanceObserver.
+ */
+class communication_metrics {
+  static size_t nsupers_sent;   /**< no. superdroplets sent to other processes */
+  static size_t nsupers_recv;   /**< no. superdroplets received from other processes */
+  static size_t nbytes_sent;    /**< no. bytes of superdroplet data sent to other processes */
+  static size_t nbytes_recv;    /**< no. bytes of superdroplet data received */
+  static double alltoall_time;  /**< time spent in MPI_Alltoall of superdroplet counts [s] */
+  static double waitall_time;   /**< time blocked in MPI_Waitall for superdroplet exchange [s] */
+  static double gather_time;    /**< time spent gathering data for output [s] */
+
+ public:
+  static void add_sendrecv(const size_t nsent, const size_t nrecv, const size_t bytes_sent,
+                           const size_t bytes_recv);
+  static void add_alltoall_time(const double seconds) { alltoall_time += seconds; }
+  static void add_waitall_time(const double seconds) { waitall_time += seconds; }
+  static void add_gather_time(const double seconds) { gather_time += seconds; }
+  static void reset();
+
+  static size_t get_nsupers_sent() { return nsupers_sent; }
+  static size_t get_nsupers_recv() { return nsupers_recv; }
+  static size_t get_nbytes_sent() { return nbytes_sent; }
+  static size_t get_nbytes_recv() { return nbytes_recv; }
+  static double get_alltoall_time() { return alltoall_time; }
+  static double get_waitall_time() { return waitall_time; }
+  static double get_gather_time() { return gather_time; }
+};
+
+#endif  // LIBS_CONFIGURATION_COMMUNICATION_METRICS_HPP_
@@ -67,12 +67,24 @@ struct Config {
 
   size_t get_maxchunk() const { return required.outputdata.maxchunk; }
 
+  size_t get_shard_nchunks() const { return required.outputdata.shard_nchunks; }
+
+  size_t get_metadata_commit_nobs() const { return required.outputdata.metadata_commit_nobs; }
+
+  bool get_crash_safe_metadata() const { return required.outputdata.crash_safe_metadata; }
+
   size_t get_maxnsupers() const { return required.domain.maxnsupers; }
 
+  size_t get_max_supers_capacity() const { return required.domain.max_supers_capacity; }
+
   unsigned int get_nspacedims() const { return required.domain.nspacedims; }
 
   size_t get_ngbxs() const { return required.domain.ngbxs; }
 
+  std::string get_gridbox_ordering() const { return required.domain.gridbox_ordering; }
+
+  std::string get_sort_supers_method() const { return required.domain.sort_supers_method; }
+
   RequiredConfigParams::TimestepsParams get_timesteps() const { return required.timesteps; }
 
   Kokkos::InitializationSettings get_kokkos_initialization_settings() const {
@@ -93,6 +105,10 @@ struct Config {
     return optional.initsupersfrombinary;
   }
 
+  OptionalConfigParams::InitSupersSyntheticParams get_initsuperssynthetic() const {
+    return optional.initsuperssynthetic;
+  }
+
   OptionalConfigParams::CvodeDynamicsParams get_cvodedynamics() const {
     return optional.cvodedynamics;
   }
@@ -110,6 +126,18 @@ struct Config {
   OptionalConfigParams::PythonBindingsParams get_python_bindings() const {
     return optional.python_bindings;
   }
+
+  OptionalConfigParams::DriverParams get_driver() const { return optional.driver; }
+
+  OptionalConfigParams::StoreParams get_store() const { return optional.store; }
+
+  OptionalConfigParams::SuperdropsSampleParams get_superdrops_sample() const {
+    return optional.superdrops_sample;
+  }
+
+  OptionalConfigParams::BenchmarkParams get_benchmark() const { return optional.benchmark; }
+
+  OptionalConfigParams::EnsembleParams get_ensemble() const { return optional.ensemble; }
 };
 
 #endif  // LIBS_CONFIGURATION_CONFIG_HPP_
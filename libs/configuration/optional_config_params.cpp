@@ -46,6 +46,28 @@ OptionalConfigParams::OptionalConfigParams(const std::filesystem::path config_fi
   if (config["python_bindings"]) {
     set_python_bindings(config);
   }
+
+  /* type of coupled dynamics and boundary conditions are read for the driver even without a driver
+  section, e.g. so that the generic driver never ignores the coupled dynamics configured */
+  if (config["driver"] || config["coupled_dynamics"] || config["boundary_conditions"]) {
+    set_driver(config);
+  }
+
+  if (config["outputdata"] && config["outputdata"]["store"]) {
+    set_store(config);
+  }
+
+  if (config["outputdata"] && config["outputdata"]["superdrops_sample"]) {
+    set_superdrops_sample(config);
+  }
+
+  if (config["benchmark"]) {
+    set_benchmark(config);
+  }
+
+  if (config["ensemble"]) {
+    set_ensemble(config);
+  }
 }
 
 void OptionalConfigParams::set_kokkos_settings(const YAML::Node& config) {
@@ -115,6 +137,9 @@ void OptionalConfigParams::set_initsupers(const YAML::Node& config) {
   if (type == "frombinary") {
     initsupersfrombinary.set_params(config);
     initsupersfrombinary.print_params();
+  } else if (type == "synthetic") {
+    initsuperssynthetic.set_params(config);
+    initsuperssynthetic.print_params();
   } else {
     throw std::invalid_argument("unknown initsupers 'type': " + type);
   }
@@ -155,6 +180,31 @@ void OptionalConfigParams::set_python_bindings(const YAML::Node& config) {
   python_bindings.print_params();
 }
 
+void OptionalConfigParams::set_driver(const YAML::Node& config) {
+  driver.set_params(config);
+  driver.print_params();
+}
+
+void OptionalConfigParams::set_store(const YAML::Node& config) {
+  store.set_params(config);
+  store.print_params();
+}
+
+void OptionalConfigParams::set_superdrops_sample(const YAML::Node& config) {
+  superdrops_sample.set_params(config);
+  superdrops_sample.print_params();
+}
+
+void OptionalConfigParams::set_benchmark(const YAML::Node& config) {
+  benchmark.set_params(config);
+  benchmark.print_params();
+}
+
+void OptionalConfigParams::set_ensemble(const YAML::Node& config) {
+  ensemble.set_params(config);
+  ensemble.print_params();
+}
+
 void OptionalConfigParams::CondensationParams::set_params(const YAML::Node& config) {
   const YAML::Node node = config["microphysics"]["condensation"];
 
@@ -175,11 +225,14 @@ void OptionalConfigParams::CondensationParams::print_params() const {
 void OptionalConfigParams::CollisionsParams::set_params(const YAML::Node& config) {
   const YAML::Node node = config["microphysics"]["collisions"];
   seed = node["seed"].as<uint64_t>();
+  if (node["majorant_sampling"]) {
+    majorant_sampling = node["majorant_sampling"].as<bool>();
+  }
 }
 
 void OptionalConfigParams::CollisionsParams::print_params() const {
   std::cout << "\n-------- Collisions Configuration Parameters --------------"
-            << "\nseed: " << seed
+            << "\nseed: " << seed << "\nmajorant_sampling: " << majorant_sampling
             << "\n---------------------------------------------------------\n";
 }
 
@@ -230,6 +283,69 @@ void OptionalConfigParams::InitSupersFromBinaryParams::print_params() const {
             << "\n---------------------------------------------------------\n";
 }
 
+void OptionalConfigParams::InitSupersSyntheticParams::set_params(const YAML::Node& config) {
+  const YAML::Node node = config["initsupers"];
+
+  if (node["type"].as<std::string>() != "synthetic") {
+    throw std::runtime_error("configuration type must be 'synthetic'");
+  }
+
+  nspacedims = config["domain"]["nspacedims"].as<unsigned int>();
+  nsupers_per_gbx = node["nsupers_per_gbx"].as<size_t>();
+  NUMCONC = node["NUMCONC"].as<double>();
+  MINRADIUS = node["MINRADIUS"].as<double>();
+  MAXRADIUS = node["MAXRADIUS"].as<double>();
+  DRYRADIUS = node["DRYRADIUS"].as<double>();
+  seed = node["seed"].as<uint64_t>();
+
+  if (node["spectrum"]) {
+    spectrum = node["spectrum"].as<std::string>();
+  }
+
+  if (spectrum == "lognormal") {
+    GEOMEANS = node["GEOMEANS"].as<std::vector<double>>();
+    geosigmas = node["geosigmas"].as<std::vector<double>>();
+    if (node["modefracs"]) {
+      modefracs = node["modefracs"].as<std::vector<double>>();
+    } else {
+      modefracs = std::vector<double>(GEOMEANS.size(), 1.0 / GEOMEANS.size());
+    }
+    if (GEOMEANS.empty() || geosigmas.size() != GEOMEANS.size() ||
+        modefracs.size() != GEOMEANS.size()) {
+      throw std::invalid_argument(
+          "lognormal spectrum needs same (non-zero) number of GEOMEANS, geosigmas and modefracs");
+    }
+  } else if (spectrum == "exponential") {
+    VOLEXPR0 = node["VOLEXPR0"].as<double>();
+  } else {
+    throw std::invalid_argument("unknown synthetic super-droplet spectrum '" + spectrum +
+                                "', must be 'lognormal' or 'exponential'");
+  }
+
+  if (nsupers_per_gbx == 0 || MINRADIUS <= 0.0 || MAXRADIUS <= MINRADIUS) {
+    throw std::invalid_argument(
+        "synthetic super-droplets need nsupers_per_gbx > 0 and 0 < MINRADIUS < MAXRADIUS");
+  }
+}
+
+void OptionalConfigParams::InitSupersSyntheticParams::print_params() const {
+  std::cout << "\n-------- InitSupersSynthetic Configuration Parameters "
+               "--------------"
+            << "\nnspacedims: " << nspacedims << "\nnsupers_per_gbx: " << nsupers_per_gbx
+            << "\nspectrum: " << spectrum << "\nNUMCONC: " << NUMCONC;
+  if (spectrum == "lognormal") {
+    for (size_t m(0); m < GEOMEANS.size(); ++m) {
+      std::cout << "\nmode " << m << ": GEOMEAN: " << GEOMEANS.at(m)
+                << ", geosigma: " << geosigmas.at(m) << ", modefrac: " << modefracs.at(m);
+    }
+  } else {
+    std::cout << "\nVOLEXPR0: " << VOLEXPR0;
+  }
+  std::cout << "\nMINRADIUS: " << MINRADIUS << "\nMAXRADIUS: " << MAXRADIUS
+            << "\nDRYRADIUS: " << DRYRADIUS << "\nseed: " << seed
+            << "\n---------------------------------------------------------\n";
+}
+
 void OptionalConfigParams::FromFileDynamicsParams::set_params(const YAML::Node& config) {
   const YAML::Node node = config["coupled_dynamics"];
 
@@ -416,3 +532,243 @@ void OptionalConfigParams::PythonBindingsParams::print_params() const {
             << "\nenable_observers.precip: " << enable_observers.precip
             << "\n---------------------------------------------------------\n";
 }
+
+void OptionalConfigParams::DriverParams::set_params(const YAML::Node& config) {
+  if (config["coupled_dynamics"]) {
+    coupled_dynamics = config["coupled_dynamics"]["type"].as<std::string>();
+  }
+
+  if (config["boundary_conditions"]) {
+    boundary_conditions = config["boundary_conditions"]["type"].as<std::string>();
+  }
+
+  if (!config["driver"]) {
+    return;
+  }
+  const YAML::Node node = config["driver"];
+  const YAML::Node mphys_node = config["microphysics"];
+
+  if (node["terminal_velocity"]) {
+    terminal_velocity = node["terminal_velocity"].as<std::string>();
+  }
+
+  if (node["enable_condensation"]) {
+    enable_condensation = node["enable_condensation"].as<bool>();
+    if (enable_condensation && !(mphys_node && mphys_node["condensation"])) {
+      throw std::invalid_argument("condensation enabled but condensation parameters not set");
+    }
+  }
+
+  if (node["collision_kernel"]) {
+    collision_kernel = node["collision_kernel"].as<std::string>();
+    const auto is_breakup = collision_kernel == "lowlist" || collision_kernel == "szakallurbich";
+    if (is_breakup && !(mphys_node && mphys_node["breakup"])) {
+      throw std::invalid_argument(collision_kernel + " collisions but breakup parameters not set");
+    }
+    if (collision_kernel == "constcoal" && !(mphys_node && mphys_node["coalescence"])) {
+      throw std::invalid_argument("constcoal collisions but coalescence parameters not set");
+    }
+  }
+
+  if (node["observers"]) {
+    const YAML::Node obs_node = node["observers"];
+    if (obs_node["streamout"]) {
+      observers.streamout = obs_node["streamout"].as<double>();
+    }
+    if (obs_node["time"]) {
+      observers.time = obs_node["time"].as<double>();
+    }
+    if (obs_node["totnsupers"]) {
+      observers.totnsupers = obs_node["totnsupers"].as<double>();
+    }
+    if (obs_node["massmoms"]) {
+      observers.massmoms = obs_node["massmoms"].as<double>();
+    }
+    if (obs_node["rainmassmoms"]) {
+      observers.rainmassmoms = obs_node["rainmassmoms"].as<double>();
+    }
+    if (obs_node["gridboxes"]) {
+      observers.gridboxes = obs_node["gridboxes"].as<double>();
+    }
+    if (obs_node["superdrops"]) {
+      observers.superdrops = obs_node["superdrops"].as<double>();
+    }
+    if (obs_node["precip"]) {
+      observers.precip = obs_node["precip"].as<double>();
+    }
+  }
+}
+
+void OptionalConfigParams::DriverParams::print_params() const {
+  std::cout << "\n-------- Driver Configuration Parameters --------------"
+            << "\ncoupled_dynamics: " << coupled_dynamics
+            << "\nboundary_conditions: " << boundary_conditions
+            << "\nterminal_velocity: " << terminal_velocity
+            << "\nenable_condensation: " << enable_condensation
+            << "\ncollision_kernel: " << collision_kernel
+            << "\nobservers.streamout: " << observers.streamout
+            << "\nobservers.time: " << observers.time
+            << "\nobservers.totnsupers: " << observers.totnsupers
+            << "\nobservers.massmoms: " << observers.massmoms
+            << "\nobservers.rainmassmoms: " << observers.rainmassmoms
+            << "\nobservers.gridboxes: " << observers.gridboxes
+            << "\nobservers.superdrops: " << observers.superdrops
+            << "\nobservers.precip: " << observers.precip
+            << "\n---------------------------------------------------------\n";
+}
+
+void OptionalConfigParams::StoreParams::set_params(const YAML::Node& config) {
+  const YAML::Node node = config["outputdata"]["store"];
+
+  type = node["type"].as<std::string>();
+  if (type != "fsstore" && type != "posix" && type != "mmap" && type != "memory") {
+    throw std::invalid_argument("unknown store type '" + type +
+                                "', must be 'fsstore', 'posix', 'mmap' or 'memory'");
+  }
+
+  if (node["max_open_files"]) {
+    max_open_files = node["max_open_files"].as<size_t>();
+  }
+
+  if (node["preallocate"]) {
+    preallocate = node["preallocate"].as<bool>();
+  }
+
+  if (node["batch_nbytes"]) {
+    batch_nbytes = node["batch_nbytes"].as<size_t>();
+  }
+
+  if (node["fsync"]) {
+    fsync = node["fsync"].as<std::string>();
+  }
+
+  if (node["fsync_nobs"]) {
+    fsync_nobs = node["fsync_nobs"].as<unsigned int>();
+  }
+
+  if (node["memory_dump"]) {
+    memory_dump = node["memory_dump"].as<std::string>();
+    if (memory_dump != "directory" && memory_dump != "zip" && memory_dump != "none") {
+      throw std::invalid_argument("memory store dump must be 'directory', 'zip' or 'none'");
+    }
+  }
+}
+
+void OptionalConfigParams::StoreParams::print_params() const {
+  std::cout << "\n-------- Store Configuration Parameters --------------"
+            << "\ntype: " << type << "\nmax_open_files: " << max_open_files
+            << "\npreallocate: " << preallocate << "\nbatch_nbytes: " << batch_nbytes
+            << "\nfsync: " << fsync << "\nfsync_nobs: " << fsync_nobs
+            << "\nmemory_dump: " << memory_dump
+            << "\n---------------------------------------------------------\n";
+}
+
+void OptionalConfigParams::SuperdropsSampleParams::set_params(const YAML::Node& config) {
+  const YAML::Node node = config["outputdata"]["superdrops_sample"];
+
+  if (node["id_stride"]) {
+    id_stride = node["id_stride"].as<uint64_t>();
+  }
+
+  if (node["id_fraction"]) {
+    id_fraction = node["id_fraction"].as<double>();
+  }
+
+  const auto set_range = [&node](const std::string& key, std::vector<double>& range) {
+    if (node[key]) {
+      range = node[key].as<std::vector<double>>();
+      if (range.size() != 2) {
+        throw std::invalid_argument("superdrops_sample " + key + " must be [min, max]");
+      }
+    }
+  };
+  set_range("radius_range", radius_range);
+  set_range("coord3_range", coord3_range);
+  set_range("coord1_range", coord1_range);
+  set_range("coord2_range", coord2_range);
+}
+
+void OptionalConfigParams::SuperdropsSampleParams::print_params() const {
+  const auto range_str = [](const std::vector<double>& range) {
+    if (range.empty()) {
+      return std::string("any");
+    }
+    return "[" + std::to_string(range.at(0)) + ", " + std::to_string(range.at(1)) + ")";
+  };
+
+  std::cout << "\n-------- Superdroplets Sample Configuration Parameters --------------"
+            << "\nid_stride: " << id_stride << "\nid_fraction: " << id_fraction
+            << "\nradius_range: " << range_str(radius_range)
+            << "\ncoord3_range: " << range_str(coord3_range)
+            << "\ncoord1_range: " << range_str(coord1_range)
+            << "\ncoord2_range: " << range_str(coord2_range)
+            << "\n---------------------------------------------------------\n";
+}
+
+void OptionalConfigParams::BenchmarkParams::set_params(const YAML::Node& config) {
+  const YAML::Node node = config["benchmark"];
+
+  if (node["scaling"]) {
+    scaling = node["scaling"].as<std::string>();
+    if (scaling != "strong" && scaling != "weak") {
+      throw std::invalid_argument("benchmark scaling must be 'strong' or 'weak'");
+    }
+  }
+
+  ndims = node["ndims"].as<std::vector<size_t>>();
+  gbxsizes = node["gbxsizes"].as<std::vector<double>>();
+  if (ndims.size() != 3 || gbxsizes.size() != 3) {
+    throw std::invalid_argument("benchmark ndims and gbxsizes must be [coord3, coord1, coord2]");
+  }
+
+  P_init = node["P_init"].as<double>();
+  TEMP_init = node["TEMP_init"].as<double>();
+  relh_init = node["relh_init"].as<double>();
+  performance_filename = std::filesystem::path(node["performance_filename"].as<std::string>());
+}
+
+void OptionalConfigParams::BenchmarkParams::print_params() const {
+  std::cout << "\n-------- Benchmark Configuration Parameters --------------"
+            << "\nscaling: " << scaling << "\nndims: [" << ndims.at(0) << ", " << ndims.at(1)
+            << ", " << ndims.at(2) << "]"
+            << "\ngbxsizes: [" << gbxsizes.at(0) << ", " << gbxsizes.at(1) << ", "
+            << gbxsizes.at(2) << "]"
+            << "\nP_init: " << P_init << "\nTEMP_init: " << TEMP_init
+            << "\nrelh_init: " << relh_init << "\nperformance_filename: " << performance_filename
+            << "\n---------------------------------------------------------\n";
+}
+
+void OptionalConfigParams::EnsembleParams::set_params(const YAML::Node& config) {
+  const YAML::Node node = config["ensemble"];
+
+  nmembers = node["nmembers"].as<size_t>();
+  VOLUME = node["VOLUME"].as<double>();
+  if (nmembers == 0 || VOLUME <= 0.0) {
+    throw std::invalid_argument("ensemble needs nmembers > 0 and VOLUME > 0");
+  }
+
+  /* each member's initsupers parameters are those of the initsupers configuration with any
+  parameters given for the member replaced by the member's values */
+  if (node["members"]) {
+    for (const auto& member : node["members"]) {
+      auto memberconfig = YAML::Clone(config);
+      for (const auto& param : member) {
+        memberconfig["initsupers"][param.first.as<std::string>()] = param.second;
+      }
+      auto params = InitSupersSyntheticParams{};
+      params.set_params(memberconfig);
+      members.push_back(params);
+    }
+    if (members.size() != nmembers) {
+      throw std::invalid_argument("ensemble members must be given for every member (or none)");
+    }
+  }
+}
+
+void OptionalConfigParams::EnsembleParams::print_params() const {
+  std::cout << "\n-------- Ensemble Configuration Parameters --------------"
+            << "\nnmembers: " << nmembers << "\nVOLUME: " << VOLUME
+            << "\nmembers: "
+            << (members.empty() ? "same as initsupers" : "own initsupers for each member")
+            << "\n---------------------------------------------------------\n";
+}
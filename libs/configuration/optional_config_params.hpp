@@ -28,6 +28,7 @@
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace NaNVals {
 inline double dbl() { return std::numeric_limits<double>::signaling_NaN(); };
@@ -63,6 +64,15 @@ struct OptionalConfigParams {
 
   void set_python_bindings(const YAML::Node& config);
 
+  void set_driver(const YAML::Node& config);
+
+  void set_store(const YAML::Node& config);
+
+  void set_superdrops_sample(const YAML::Node& config);
+
+  void set_benchmark(const YAML::Node& config);
+  void set_ensemble(const YAML::Node& config);
+
   /*** Kokkos Initialization Parameters ***/
   struct KokkosSettings {
     bool is_default = true; /**< true = default kokkos initialization */
@@ -84,6 +94,7 @@ struct OptionalConfigParams {
     void set_params(const YAML::Node& config);
     void print_params() const;
     uint64_t seed = NaNVals::sizet(); /**< fixed seed for collision probability generator pool */
+    bool majorant_sampling = false;   /**< true = majorant (false = direct) sampling of pairs */
   } collisions;
 
   struct CoalescenceParams {
@@ -113,6 +124,23 @@ struct OptionalConfigParams {
     size_t initnsupers = NaNVals::sizet();     /**< initial no. of super-droplets to initialise */
   } initsupersfrombinary;
 
+  struct InitSupersSyntheticParams {
+    void set_params(const YAML::Node& config);
+    void print_params() const;
+    unsigned int nspacedims = NaNVals::uint(); /**< no. of spatial dimensions to model */
+    size_t nsupers_per_gbx = NaNVals::sizet(); /**< no. of super-droplets in each gridbox */
+    std::string spectrum = "lognormal";        /**< "lognormal" or "exponential" distribution */
+    double NUMCONC = NaNVals::dbl();           /**< number conc. of real droplets [m^-3] */
+    std::vector<double> GEOMEANS{};            /**< geometric mean radius of lognormal modes [m] */
+    std::vector<double> geosigmas{};           /**< geometric standard deviation of modes */
+    std::vector<double> modefracs{};           /**< fraction of NUMCONC in each lognormal mode */
+    double VOLEXPR0 = NaNVals::dbl();          /**< radius of mean volume of exponential dist [m] */
+    double MINRADIUS = NaNVals::dbl();         /**< minimum radius of super-droplets [m] */
+    double MAXRADIUS = NaNVals::dbl();         /**< maximum radius of super-droplets [m] */
+    double DRYRADIUS = NaNVals::dbl();         /**< dry radius of super-droplets (for msol) [m] */
+    uint64_t seed = NaNVals::sizet();          /**< seed for super-droplets' random attributes */
+  } initsuperssynthetic;
+
   /*** Coupled Dynamics Parameters ***/
   struct FromFileDynamicsParams {
     void set_params(const YAML::Node& config);
@@ -193,6 +221,75 @@ struct OptionalConfigParams {
       bool precip = false;
     } enable_observers; /**< true for set of booleans in struct enables various observers */
   } python_bindings;
+
+  /** Generic CLEO Driver Parameters */
+  struct DriverParams {
+    void set_params(const YAML::Node& config);
+    void print_params() const;
+    std::string coupled_dynamics = "null";    /**< type of dynamics coupled to SDM */
+    std::string boundary_conditions = "null"; /**< type of boundary conditions of domain */
+    std::string terminal_velocity = "null";   /**< formula for terminal velocity of superdroplets */
+    bool enable_condensation = false;         /**< true enables condensation in microphysics */
+    std::string collision_kernel = "null";    /**< kernel(s) for collisions (null = none) */
+    struct Observers {
+      double streamout = 0.0;
+      double time = 0.0;
+      double totnsupers = 0.0;
+      double massmoms = 0.0;
+      double rainmassmoms = 0.0;
+      double gridboxes = 0.0;
+      double superdrops = 0.0;
+      double precip = 0.0;
+    } observers; /**< interval [s] of each observer, observer disabled if interval <= 0.0 */
+  } driver;
+
+  /** Output Data Store Parameters */
+  struct StoreParams {
+    void set_params(const YAML::Node& config);
+    void print_params() const;
+    std::string type = "fsstore";          /**< "fsstore", "posix", "mmap" or "memory" */
+    size_t max_open_files = 64;            /**< max. no. files kept open/mapped by store */
+    bool preallocate = false;              /**< true = posix store preallocates files */
+    size_t batch_nbytes = 1048576;         /**< max. bytes batched by posix store */
+    std::string fsync = "end";             /**< posix store fsync: "never", "end" or "every" */
+    unsigned int fsync_nobs = 1;           /**< observations between "every" fsync */
+    std::string memory_dump = "directory"; /**< memory store dump: "directory", "zip", "none" */
+  } store;
+
+  /** Superdroplets Sample Output Parameters */
+  struct SuperdropsSampleParams {
+    void set_params(const YAML::Node& config);
+    void print_params() const;
+    uint64_t id_stride = 1;             /**< sample superdroplets with sdId % id_stride == 0 */
+    double id_fraction = 1.0;           /**< sample (approx.) this fraction of sdIds */
+    std::vector<double> radius_range{}; /**< [min, max) radius of sample [m] (empty = any) */
+    std::vector<double> coord3_range{}; /**< [min, max) coord3 of sample [m] (empty = any) */
+    std::vector<double> coord1_range{}; /**< [min, max) coord1 of sample [m] (empty = any) */
+    std::vector<double> coord2_range{}; /**< [min, max) coord2 of sample [m] (empty = any) */
+  } superdrops_sample;
+
+  /** Scaling Benchmark Parameters */
+  struct BenchmarkParams {
+    void set_params(const YAML::Node& config);
+    void print_params() const;
+    using fspath = std::filesystem::path;
+    std::string scaling = "strong";         /**< "strong" (fixed domain) or "weak" (per rank) */
+    std::vector<size_t> ndims{1, 1, 1};     /**< no. gridboxes in [coord3, coord1, coord2] */
+    std::vector<double> gbxsizes{};         /**< [coord3, coord1, coord2] gridbox sizes [m] */
+    double P_init = NaNVals::dbl();         /**< initial (uniform) pressure [Pa] */
+    double TEMP_init = NaNVals::dbl();      /**< initial (uniform) temperature [K] */
+    double relh_init = NaNVals::dbl();      /**< initial (uniform) relative humidity (%) */
+    fspath performance_filename = fspath(); /**< filename for timings of each stage */
+  } benchmark;
+
+  /** Box Model Ensemble Parameters */
+  struct EnsembleParams {
+    void set_params(const YAML::Node& config);
+    void print_params() const;
+    size_t nmembers = NaNVals::sizet(); /**< no. of members (i.e. independent box models) */
+    double VOLUME = NaNVals::dbl();     /**< volume of each member's box [m^3] */
+    std::vector<InitSupersSyntheticParams> members{}; /**< (optional) initsupers of each member */
+  } ensemble;
 };
 
 #endif  // LIBS_CONFIGURATION_OPTIONAL_CONFIG_PARAMS_HPP_
@@ -35,11 +35,32 @@ RequiredConfigParams::RequiredConfigParams(const std::filesystem::path config_fi
   outputdata.setup_filename = fspath_from_yaml(node, "setup_filename");
   outputdata.zarrbasedir = fspath_from_yaml(node, "zarrbasedir");
   outputdata.maxchunk = node["maxchunk"].as<size_t>();
+  if (node["shard_nchunks"]) {
+    outputdata.shard_nchunks = node["shard_nchunks"].as<size_t>();
+  }
+  if (node["metadata_commit_nobs"]) {
+    outputdata.metadata_commit_nobs = node["metadata_commit_nobs"].as<size_t>();
+    if (outputdata.metadata_commit_nobs == 0) {
+      throw std::invalid_argument("metadata_commit_nobs must be greater than 0");
+    }
+  }
+  if (node["crash_safe_metadata"]) {
+    outputdata.crash_safe_metadata = node["crash_safe_metadata"].as<bool>();
+  }
 
   node = config["domain"];
   domain.nspacedims = node["nspacedims"].as<unsigned int>();
   domain.ngbxs = node["ngbxs"].as<size_t>();
   domain.maxnsupers = node["maxnsupers"].as<size_t>();
+  if (node["max_supers_capacity"]) {
+    domain.max_supers_capacity = node["max_supers_capacity"].as<size_t>();
+  }
+  if (node["gridbox_ordering"]) {
+    domain.gridbox_ordering = node["gridbox_ordering"].as<std::string>();
+  }
+  if (node["sort_supers_method"]) {
+    domain.sort_supers_method = node["sort_supers_method"].as<std::string>();
+  }
 
   node = config["timesteps"];
   timesteps.CONDTSTEP = node["CONDTSTEP"].as<double>();
@@ -58,8 +79,15 @@ void RequiredConfigParams::print_params() const {
             << "\ngrid_filename : " << inputfiles.grid_filename
             << "\nsetup_filename : " << outputdata.setup_filename
             << "\nzarrbasedir : " << outputdata.zarrbasedir
-            << "\nmaxchunk : " << outputdata.maxchunk << "\nnspacedims : " << domain.nspacedims
+            << "\nmaxchunk : " << outputdata.maxchunk
+            << "\nshard_nchunks : " << outputdata.shard_nchunks
+            << "\nmetadata_commit_nobs : " << outputdata.metadata_commit_nobs
+            << "\ncrash_safe_metadata : " << outputdata.crash_safe_metadata
+            << "\nnspacedims : " << domain.nspacedims
             << "\nngbxs : " << domain.ngbxs << "\nmaxnsupers : " << domain.maxnsupers
+            << "\nmax_supers_capacity : " << domain.max_supers_capacity
+            << "\ngridbox_ordering : " << domain.gridbox_ordering
+            << "\nsort_supers_method : " << domain.sort_supers_method
             << "\nCONDTSTEP : " << timesteps.CONDTSTEP << "\nCOLLTSTEP : " << timesteps.COLLTSTEP
             << "\nMOTIONTSTEP : " << timesteps.MOTIONTSTEP
             << "\nCOUPLTSTEP : " << timesteps.COUPLTSTEP << "\nOBSTSTEP : " << timesteps.OBSTSTEP
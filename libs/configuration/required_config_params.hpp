@@ -25,6 +25,7 @@
 #include <filesystem>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 #include <string>
 
 /**
@@ -49,12 +50,18 @@ struct RequiredConfigParams {
     std::filesystem::path setup_filename; /**< filename to copy model setup to */
     std::filesystem::path zarrbasedir;    /**< name of base directory of zarr output */
     size_t maxchunk;                      /**< maximum number of elements in zarr array chunks */
+    size_t shard_nchunks = 0; /**< no. chunks in each shard of zarr arrays (0 = no sharding) */
+    size_t metadata_commit_nobs = 1;  /**< no. writes to zarr arrays between shape commits */
+    bool crash_safe_metadata = false; /**< true = write data before each commit of shape */
   } outputdata;
 
   struct DomainParams {
     unsigned int nspacedims; /**< no. of spatial dimensions to model */
     size_t ngbxs;            /**< total number of Gbxs */
-    size_t maxnsupers;       /**< maximum number of SDs */
+    size_t maxnsupers;       /**< initial capacity for SDs (grows on demand) */
+    size_t max_supers_capacity = std::numeric_limits<size_t>::max(); /**< ceiling on capacity */
+    std::string gridbox_ordering = "lexicographic"; /**< "lexicographic" or "morton" */
+    std::string sort_supers_method = "counting_sort"; /**< "counting_sort" or "inplace" */
   } domain;
 
   struct TimestepsParams {
@@ -32,6 +32,26 @@ bool cfl_criterion(const double gridstep, const double sdstep) {
   return (Kokkos::abs(sdstep) <= Kokkos::abs(gridstep));
 }
 
+/* returns the largest Courant number, C = |delta[X]| / gridstep, of
+the z, x and y (3,1,2) directions, where the gridstep for each direction
+is calculated from the gridbox boundaries map. Motion satisfies the
+cfl criteria if C =< 1 */
+template <GridboxMaps GbxMaps>
+KOKKOS_INLINE_FUNCTION double courant_number(const GbxMaps& gbxmaps, const unsigned int gbxindex,
+                                             const double delta3, const double delta1,
+                                             const double delta2) {
+  double gridstep(gbxmaps.coord3bounds(gbxindex).second - gbxmaps.coord3bounds(gbxindex).first);
+  double courant(Kokkos::abs(delta3 / gridstep));
+
+  gridstep = gbxmaps.coord1bounds(gbxindex).second - gbxmaps.coord1bounds(gbxindex).first;
+  courant = Kokkos::fmax(Kokkos::abs(delta1 / gridstep), courant);
+
+  gridstep = gbxmaps.coord2bounds(gbxindex).second - gbxmaps.coord2bounds(gbxindex).first;
+  courant = Kokkos::fmax(Kokkos::abs(delta2 / gridstep), courant);
+
+  return courant;
+}
+
 /* returns false if any of z, x or y (3,1,2) directions
   do not meet their cfl criterion. For each direction,
   Criterion is C = delta[X] / gridstep =< 1 where the
@@ -50,7 +70,9 @@ KOKKOS_INLINE_FUNCTION bool cfl_criteria(const GbxMaps& gbxmaps, const unsigned
   cfl = (cfl_criterion(gridstep, delta2) && cfl);
 
   if (!cfl) {
-    Kokkos::abort("CFL criteria for superdrop motion not met. Consider reducing sdmotion timestep");
+    Kokkos::abort(
+        "CFL criteria for superdrop motion not met. Consider reducing sdmotion timestep "
+        "or increasing the maximum number of motion sub-steps");
   }
 
   return cfl;
@@ -26,6 +26,7 @@
 
 #include "../cleoconstants.hpp"
 #include "../kokkosaliases.hpp"
+#include "configuration/communicator.hpp"
 #include "gridboxes/boundary_conditions.hpp"
 #include "gridboxes/gridbox.hpp"
 #include "gridboxes/gridboxmaps.hpp"
@@ -39,6 +40,20 @@
 namespace dlc = dimless_constants;
 namespace KCS = KokkosCleoSettings;
 
+/*
+concept for a type of Motion which can split a motion step into a number of (adaptively chosen)
+equal sub-steps, e.g. to satisfy the CFL criteria in each sub-step.
+*/
+template <typename M, typename GbxMaps>
+concept SubsteppingMotion =
+    Motion<M, GbxMaps> && requires(M m, const unsigned int u, const GbxMaps& gbxmaps,
+                                   const viewd_constgbx d_gbxs,
+                                   const subviewd_constsupers domainsupers) {
+      { m.get_nsubsteps(gbxmaps, d_gbxs, domainsupers) } -> std::convertible_to<unsigned int>;
+      { m.check_nsubsteps(u) };
+      { m.substep_motion(u) } -> std::same_as<M>;
+    };
+
 /*
 MoveSupersInGridboxesFunctor struct encapsulates superdroplet motion so that parallel loop
 functors only captures motion and not other members of MoveSupersInDomain coincidentally
@@ -52,12 +67,29 @@ struct MoveSupersInGridboxesFunctor {
   const subviewd_supers domainsupers;
   const SDMMo mo;
 
+  /*
+   * returns contribution of a superdroplet to the precipitation through the bottom boundary,
+   * 'lowerlim', of its gridbox (before division by the gridbox's area), i.e. the volume of water
+   * in the superdroplet if it has moved below lowerlim, otherwise zero.
+   */
+  KOKKOS_INLINE_FUNCTION
+  static double precipitation_volume(const double lowerlim, const Superdrop& drop) {
+    if (drop.get_coord3() < lowerlim) {
+      return drop.condensate_mass() * drop.get_xi() / dlc::Rho_l;
+    }
+    return 0.0;
+  }
+
   /*
    * enact steps (1) and (2) movement of superdroplets for 1 gridbox:
    * (1) update their spatial coords according to type of sdmotion. (device)
    * (2) update their sdgbxindex accordingly (device).
    *
-   * Kokkos::parallel_for([...]) is equivalent to:
+   * In the same pass over the superdroplets the precipitation through the bottom boundary of the
+   * gridbox is reduced among the team (rather than accumulated via atomics for each
+   * superdroplet) and then given to the monitor.
+   *
+   * Kokkos::parallel_reduce([...]) is equivalent to:
    * for (size_t kk(0); kk < supers.extent(0); ++kk) {[...]}
    * when in serial
    */
@@ -65,19 +97,28 @@ struct MoveSupersInGridboxesFunctor {
   void move_supers_in_gbx(const TeamMember& team_member, const unsigned int gbxindex,
                           const State& state, const subviewd_supers supers) const {
     const size_t nsupers(supers.extent(0));
+    const auto lowerlim = gbxmaps.coord3bounds(gbxindex).first;
     auto& _sdmotion = this->sdmotion;
     auto& _gbxmaps = this->gbxmaps;
-    auto& _mo = this->mo;
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, nsupers),
-                         [=, &_sdmotion, &_gbxmaps, &_mo](const size_t kk) {
-                           /* step (1) */
-                           _sdmotion.superdrop_coords(gbxindex, _gbxmaps, state, supers(kk));
 
-                           _mo.monitor_precipitation(team_member, gbxindex, _gbxmaps, supers(kk));
+    auto totprecip = double{0.0};
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team_member, nsupers),
+        [=, &_sdmotion, &_gbxmaps](const size_t kk, double& precip) {
+          /* step (1) */
+          _sdmotion.superdrop_coords(gbxindex, _gbxmaps, state, supers(kk));
 
-                           /* step (2) */
-                           _sdmotion.superdrop_gbx(gbxindex, _gbxmaps, supers(kk));
-                         });
+          precip += precipitation_volume(lowerlim, supers(kk));
+
+          /* step (2) */
+          _sdmotion.superdrop_gbx(gbxindex, _gbxmaps, supers(kk));
+        },
+        totprecip);
+
+    if (totprecip > 0.0) {
+      totprecip /= gbxmaps.get_gbxarea(gbxindex);
+    }
+    mo.monitor_precipitation(team_member, totprecip);
   }
 
   /*
@@ -92,16 +133,24 @@ struct MoveSupersInGridboxesFunctor {
   }
 };
 
-struct EffectOnHydrometeorStatesFunctor {
+/*
+EffectOfMotionFunctor struct encapsulates the effects of superdroplet motion on gridboxes after
+superdroplets have been moved between gridboxes. For each gridbox a single pass over its
+superdroplets (with a team-local reduction) is used to both update the hydrometeor mass(es) of the
+gridbox's state and to feed the monitor of motion.
+*/
+template <SDMMonitor SDMMo>
+struct EffectOfMotionFunctor {
   const viewd_gbx d_gbxs; /** view of gridboxes on device. */
   const subviewd_constsupers
       domainsupers; /**view on device of all superdroplets in all gridboxes. */
+  const SDMMo mo;   /**< monitor of motion */
 
   struct EffectOnQcondFunctor {
     const double totmass_cond; /**< liquid mass in parcel volume 'dm' */
 
     /*
-     * operator for functor in effect_on_hydrometeor_states function called in
+     * operator for functor in effect_of_motion function called in
      * parallel (Single PerTeam Policy) in order to change qcond of state
      */
     KOKKOS_INLINE_FUNCTION void operator()(State& state) const {
@@ -113,8 +162,9 @@ struct EffectOnHydrometeorStatesFunctor {
   };
 
   /*
-   * operator for functor in effect_on_hydrometeor_states function called in
-   * parallel loop over gridboxes in order to change hydrometeor mass(es) of each state
+   * operator for functor in effect_of_motion function called in parallel loop over gridboxes in
+   * order to change hydrometeor mass(es) of each state and monitor the superdroplets in each
+   * gridbox whilst they are (likely) still in cache
    */
   KOKKOS_INLINE_FUNCTION void operator()(const TeamMember& team_member) const {
     const auto ii = team_member.league_rank();
@@ -132,6 +182,8 @@ struct EffectOnHydrometeorStatesFunctor {
 
     const auto functor = EffectOnQcondFunctor{totmass_cond};
     Kokkos::single(Kokkos::PerTeam(team_member), functor, d_gbxs(ii).state);
+
+    mo.monitor_motion(team_member, supers);
   }
 };
 
@@ -187,10 +239,17 @@ class MoveSupersInDomain {
   template <SDMMonitor SDMMo>
   void move_supers_in_gridboxes(const GbxMaps& gbxmaps, const viewd_gbx d_gbxs,
                                 const subviewd_supers domainsupers, const SDMMo mo) const {
+    move_supers_in_gridboxes(sdmotion, gbxmaps, d_gbxs, domainsupers, mo);
+  }
+
+  /* as above but with given motion, e.g. for one sub-step of sdmotion */
+  template <SDMMonitor SDMMo>
+  void move_supers_in_gridboxes(const M& motion, const GbxMaps& gbxmaps, const viewd_gbx d_gbxs,
+                                const subviewd_supers domainsupers, const SDMMo mo) const {
     Kokkos::Profiling::ScopedRegion region("sdm_movement_move_in_gridboxes");
 
     const size_t ngbxs(d_gbxs.extent(0));
-    const auto functor = MoveSupersInGridboxesFunctor<GbxMaps, M, SDMMo>{sdmotion, gbxmaps, d_gbxs,
+    const auto functor = MoveSupersInGridboxesFunctor<GbxMaps, M, SDMMo>{motion, gbxmaps, d_gbxs,
                                                                          domainsupers, mo};
     Kokkos::parallel_for("move_supers_in_gridboxes", TeamPolicy(ngbxs, KCS::team_size), functor);
   }
@@ -231,11 +290,11 @@ class MoveSupersInDomain {
   (3) move superdroplets between gridboxes (host)
   (4) apply domain boundary conditions (host and/or device)
   */
-  SupersInDomain move_superdrops_in_domain(const unsigned int t_sdm, const GbxMaps& gbxmaps,
+  SupersInDomain move_superdrops_in_domain(const M& motion, const GbxMaps& gbxmaps,
                                            viewd_gbx d_gbxs, SupersInDomain& allsupers,
                                            const SDMMonitor auto mo) const {
     /* steps (1 - 2) */
-    move_supers_in_gridboxes(gbxmaps, d_gbxs, allsupers.domain_supers(), mo);
+    move_supers_in_gridboxes(motion, gbxmaps, d_gbxs, allsupers.domain_supers(), mo);
 
     /* step (3) */
     allsupers = move_supers_between_gridboxes(gbxmaps, d_gbxs, allsupers);
@@ -248,22 +307,64 @@ class MoveSupersInDomain {
     return allsupers;
   }
 
+  /* returns number of sub-steps required for motion step, which is the same on every process.
+  Number is checked against the motion's limit only after it is reduced over all processes so that
+  if it exceeds the limit every process throws an error */
+  unsigned int get_nsubsteps(const GbxMaps& gbxmaps, const viewd_constgbx d_gbxs,
+                             const subviewd_constsupers domainsupers) const
+    requires SubsteppingMotion<M, GbxMaps>
+  {
+    auto nsubsteps = static_cast<unsigned int>(
+        sdmotion.get_nsubsteps(gbxmaps, d_gbxs, domainsupers));
+
+    if (init_communicator::get_comm_size() > 1) {
+      MPI_Allreduce(MPI_IN_PLACE, &nsubsteps, 1, MPI_UNSIGNED, MPI_MAX,
+                    init_communicator::get_communicator());
+    }
+    sdmotion.check_nsubsteps(nsubsteps);
+
+    return nsubsteps;
+  }
+
+  /* enact movement of superdroplets throughout domain, if possible splitting the motion step into
+  sub-steps which each perform steps (1) - (4) of moving superdroplets throughout the domain */
+  SupersInDomain move_superdrops_in_domain(const unsigned int t_sdm, const GbxMaps& gbxmaps,
+                                           viewd_gbx d_gbxs, SupersInDomain& allsupers,
+                                           const SDMMonitor auto mo) const {
+    if constexpr (SubsteppingMotion<M, GbxMaps>) {
+      const auto nsubsteps = get_nsubsteps(gbxmaps, d_gbxs, allsupers.domain_supers_readonly());
+      mo.monitor_motion_substeps(nsubsteps);
+
+      if (nsubsteps > 1) {
+        const auto submotion = sdmotion.substep_motion(nsubsteps);
+        for (unsigned int s(0); s < nsubsteps; ++s) {
+          allsupers = move_superdrops_in_domain(submotion, gbxmaps, d_gbxs, allsupers, mo);
+        }
+        return allsupers;
+      }
+    }
+
+    return move_superdrops_in_domain(sdmotion, gbxmaps, d_gbxs, allsupers, mo);
+  }
+
   /**
    * @brief Applies the effect of superdroplet motion on the States of all the gridboxes
-   * in the domain.
+   * in the domain and monitors the motion.
    *
    * Superdroplets moving between gridboxes affects the sum of the mass of hydrometeors
    * in the state of each gridbox (hence qcond). Function loops over gridboxes to
    * sum mass of hydrometeors in each one and uses this result to update each gridbox's state.
+   * Monitoring of motion is fused into the same parallel loop over gridboxes so that
+   * superdroplets are only read once (see EffectOfMotionFunctor).
    */
-  void effect_on_hydrometeor_states(const viewd_gbx d_gbxs,
-                                    const subviewd_constsupers domainsupers) const {
-    Kokkos::Profiling::ScopedRegion region("sdm_movement_effect_on_hydrometeor_states");
+  template <SDMMonitor SDMMo>
+  void effect_of_motion(const viewd_gbx d_gbxs, const subviewd_constsupers domainsupers,
+                        const SDMMo mo) const {
+    Kokkos::Profiling::ScopedRegion region("sdm_movement_effect_of_motion");
 
     const size_t ngbxs(d_gbxs.extent(0));
-    const auto functor = EffectOnHydrometeorStatesFunctor{d_gbxs, domainsupers};
-    Kokkos::parallel_for("effect_on_hydrometeor_states", TeamPolicy(ngbxs, KCS::team_size),
-                         functor);
+    const auto functor = EffectOfMotionFunctor<SDMMo>{d_gbxs, domainsupers, mo};
+    Kokkos::parallel_for("effect_of_motion", TeamPolicy(ngbxs, KCS::team_size), functor);
   }
 
  public:
@@ -293,8 +394,7 @@ class MoveSupersInDomain {
                           SupersInDomain& allsupers, const SDMMonitor auto mo) const {
     if (sdmotion.on_step(t_sdm)) {
       allsupers = move_superdrops_in_domain(t_sdm, gbxmaps, d_gbxs, allsupers, mo);
-      effect_on_hydrometeor_states(d_gbxs, allsupers.domain_supers_readonly());
-      mo.monitor_motion(d_gbxs, allsupers.domain_supers_readonly());
+      effect_of_motion(d_gbxs, allsupers.domain_supers_readonly(), mo);
     }
 
     return allsupers;
@@ -149,6 +149,23 @@ struct PredCorr {
            const TV i_terminalv)
       : delt(int2time(motionstep)), terminalv(i_terminalv) {}
 
+  /* copy of predcorr with timestep reduced to 1/nsubsteps of the original timestep */
+  PredCorr(const PredCorr& predcorr, const unsigned int nsubsteps)
+      : delt(predcorr.delt / nsubsteps), terminalv(predcorr.terminalv) {}
+
+  /* returns the Courant number of the change in a superdroplet's coordinates
+  from a forward timestep of motion using the predictor-corrector method without
+  changing the superdroplet's coordinates */
+  KOKKOS_FUNCTION
+  double courant_number(const unsigned int gbxindex, const GbxMaps& gbxmaps, const State& state,
+                        const Superdrop& drop) const {
+    const auto delta3 = delta_coord3(gbxindex, gbxmaps, state, drop);
+    const auto delta1 = delta_coord1(gbxindex, gbxmaps, state, drop);
+    const auto delta2 = delta_coord2(gbxindex, gbxmaps, state, drop);
+
+    return ::courant_number(gbxmaps, gbxindex, delta3, delta1, delta2);
+  }
+
   /* operator for use in the "superdrop_coords" function of the PredCorrMotion struct.
   Operator uses predictor-corrector method to return the change in
   a superdroplet's coordinates from a forward timestep of motion using the
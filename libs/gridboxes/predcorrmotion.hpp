@@ -23,31 +23,122 @@
 #define LIBS_GRIDBOXES_PREDCORRMOTION_HPP_
 
 #include <Kokkos_Core.hpp>
+#include <cmath>
 #include <functional>
+#include <stdexcept>
+#include <string>
 
 #include "../cleoconstants.hpp"
+#include "../kokkosaliases.hpp"
+#include "gridboxes/gridbox.hpp"
 #include "gridboxes/predcorr.hpp"
 #include "superdrops/superdrop.hpp"
 #include "superdrops/terminalvelocity.hpp"
 
+namespace KCS = KokkosCleoSettings;
+
 /*
 satisfies motion concept for motion of a superdroplet using a predictor-corrector method with
 a constant timestep ("interval") to update a superdroplet's coordinates and then updating it's
 sdgbxindex using the appropriate templated type
 
 Special case: If timestep interval is largest possible unsigned integer, on_step never returns true.
+
+If max_nsubsteps > 1, the motion is adaptively split into (up to max_nsubsteps) equal sub-steps
+such that no superdroplet moves further than the width of its gridbox in one sub-step, i.e. such
+that the CFL criteria is met. If the CFL criteria cannot be met with max_nsubsteps sub-steps an
+error is thrown. Default max_nsubsteps = 1 means there is no sub-stepping and motion aborts if the
+CFL criteria is not met.
 */
 template <GridboxMaps GbxMaps, VelocityFormula TV, typename CheckBounds>
 struct PredCorrMotion {
   const unsigned int interval;  // integer timestep for movement
   PredCorr<GbxMaps, TV> predcorr;
   CheckBounds check_bounds;
+  unsigned int max_nsubsteps;  // hard limit on number of sub-steps of one motion step
 
   PredCorrMotion(const unsigned int motionstep, const std::function<double(unsigned int)> int2time,
-                 const TV i_terminalv, CheckBounds i_check_bounds)
+                 const TV i_terminalv, CheckBounds i_check_bounds,
+                 const unsigned int i_max_nsubsteps = 1)
       : interval(motionstep),
         predcorr(interval, int2time, i_terminalv),
-        check_bounds(i_check_bounds) {}
+        check_bounds(i_check_bounds),
+        max_nsubsteps(i_max_nsubsteps) {
+    if (max_nsubsteps == 0) {
+      throw std::invalid_argument("maximum number of motion sub-steps must be at least 1");
+    }
+  }
+
+  /* copy of motion with timestep for change in superdroplet coordinates reduced to 1/nsubsteps */
+  PredCorrMotion(const PredCorrMotion& motion, const unsigned int nsubsteps)
+      : interval(motion.interval),
+        predcorr(motion.predcorr, nsubsteps),
+        check_bounds(motion.check_bounds),
+        max_nsubsteps(motion.max_nsubsteps) {}
+
+  /**
+   * @brief Returns the number of equal sub-steps the motion step must be split into for every
+   * superdroplet in the domain to satisfy the CFL criteria in each sub-step.
+   *
+   * Number of sub-steps is the ceiling of the largest Courant number of any superdroplet in the
+   * domain (or 1 if max_nsubsteps = 1 since then sub-stepping is not allowed). Number is not
+   * limited to max_nsubsteps so that it can be reduced over all processes before it is checked
+   * (see check_nsubsteps).
+   *
+   * @param gbxmaps The gridbox maps.
+   * @param d_gbxs The view of gridboxes on device.
+   * @param domainsupers The view of superdroplets in the domain on device.
+   * @return The number of sub-steps of the motion step.
+   */
+  unsigned int get_nsubsteps(const GbxMaps& gbxmaps, const viewd_constgbx d_gbxs,
+                             const subviewd_constsupers domainsupers) const {
+    if (max_nsubsteps == 1) {
+      return 1;
+    }
+
+    const size_t ngbxs(d_gbxs.extent(0));
+    const auto _predcorr = predcorr;
+    auto maxcourant = double{0.0};
+    Kokkos::parallel_reduce(
+        "motion_courant_number", TeamPolicy(ngbxs, KCS::team_size),
+        KOKKOS_LAMBDA(const TeamMember& team_member, double& courant) {
+          const auto ii = team_member.league_rank();
+          const auto& gbx(d_gbxs(ii));
+          const auto supers = gbx.supersingbx.readonly(domainsupers);
+          const size_t nsupers(supers.extent(0));
+
+          auto gbxcourant = double{0.0};
+          Kokkos::parallel_reduce(
+              Kokkos::TeamThreadRange(team_member, nsupers),
+              [&](const size_t kk, double& c) {
+                const auto ck =
+                    _predcorr.courant_number(gbx.get_gbxindex(), gbxmaps, gbx.state, supers(kk));
+                c = Kokkos::fmax(c, ck);
+              },
+              Kokkos::Max<double>(gbxcourant));
+
+          Kokkos::single(Kokkos::PerTeam(team_member),
+                         [&]() { courant = Kokkos::fmax(courant, gbxcourant); });
+        },
+        Kokkos::Max<double>(maxcourant));
+
+    return static_cast<unsigned int>(std::fmax(std::ceil(maxcourant), 1.0));
+  }
+
+  /* throws error if number of sub-steps required for motion step exceeds max_nsubsteps */
+  void check_nsubsteps(const unsigned int nsubsteps) const {
+    if (nsubsteps > max_nsubsteps) {
+      const auto err = std::string("CFL criteria for superdrop motion requires ") +
+                       std::to_string(nsubsteps) + " sub-steps but maximum is " +
+                       std::to_string(max_nsubsteps) + ". Consider reducing sdmotion timestep";
+      throw std::runtime_error(err);
+    }
+  }
+
+  /* returns copy of motion for one of nsubsteps equal sub-steps of the motion step */
+  PredCorrMotion substep_motion(const unsigned int nsubsteps) const {
+    return PredCorrMotion(*this, nsubsteps);
+  }
 
   KOKKOS_INLINE_FUNCTION
   unsigned int next_step(const unsigned int t_sdm) const {
@@ -21,7 +21,9 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Sort.hpp>
 #include <Kokkos_StdAlgorithms.hpp>
+#include <limits>
 #include <stdexcept>
+#include <string>
 
 #include "../kokkosaliases.hpp"
 #include "superdrops/superdrop.hpp"
@@ -86,24 +88,123 @@ struct CountingSortFunctor {
   }
 };
 
+/* Functor used in parallel regions of SortSupersBySdgbxindex inplace_sort (see below). A
+superdroplet is misplaced if its position in totsupers is outside of the range of positions of
+its bucket (i.e. its gridbox or outside of the domain) given by cumlcounts. Every misplaced
+superdroplet leaves a hole in the range of some other bucket, and the number of holes in the range
+of a bucket equals the number of misplaced superdroplets which belong to it. */
+struct InplaceSortFunctor {
+  size_t gbxindex_max;
+  viewd_supers totsupers;
+  viewd_counts cumlcounts;
+  viewd_supers staging;
+
+  /* returns bucket of superdroplet at position kk of totsupers */
+  KOKKOS_INLINE_FUNCTION
+  size_t bucket(const size_t kk) const {
+    return _get_count_position(totsupers(kk).get_sdgbxindex(), gbxindex_max, cumlcounts);
+  }
+
+  /* returns true if superdroplet at position kk of totsupers is not in the range of its bucket */
+  KOKKOS_INLINE_FUNCTION
+  bool is_misplaced(const size_t kk) const {
+    const auto bb = bucket(kk);
+    const auto end = (bb + 1 < cumlcounts.extent(0)) ? cumlcounts(bb + 1) : totsupers.extent(0);
+    return kk < cumlcounts(bb) || kk >= end;
+  }
+
+  /* copies the ss'th misplaced superdroplet into staging */
+  KOKKOS_INLINE_FUNCTION
+  void stage(const size_t kk, size_t& ss, const bool is_final) const {
+    if (is_misplaced(kk)) {
+      if (is_final) {
+        staging(ss) = totsupers(kk);
+      }
+      ++ss;
+    }
+  }
+
+  /* fills the ss'th hole (i.e. position of the ss'th misplaced superdroplet) with the ss'th
+  superdroplet in staging once it has been sorted. Holes are in order of their position and hence
+  grouped by the bucket whose range they are in, so the sorted staged superdroplets of each bucket
+  fill the holes in its range. Each call only reads and then writes totsupers(kk) */
+  KOKKOS_INLINE_FUNCTION
+  void unstage(const size_t kk, size_t& ss, const bool is_final) const {
+    if (is_misplaced(kk)) {
+      if (is_final) {
+        totsupers(kk) = staging(ss);
+      }
+      ++ss;
+    }
+  }
+};
+
+/* Method used by SortSupersBySdgbxindex to move superdroplets into their sorted order:
+counting_sort = (parallel) copy of superdroplets into a second view of superdroplets which then
+replaces the original view, i.e. the sorted superdroplets are returned in a different view.
+inplace = (parallel) permutation of superdroplets within the original view via a staging view
+which only holds the superdroplets which are not already within the range of their gridbox,
+i.e. the sorted superdroplets are returned in the original view.
+*/
+enum class SortSupersMethod { counting_sort, inplace };
+
+/* returns method for sorting superdroplets given its name, "counting_sort" or "inplace" */
+inline SortSupersMethod sort_supers_method(const std::string& name) {
+  if (name == "counting_sort") {
+    return SortSupersMethod::counting_sort;
+  } else if (name == "inplace") {
+    return SortSupersMethod::inplace;
+  }
+  throw std::invalid_argument("unknown method for sorting superdroplets '" + name + "'");
+}
+
 /* Counting sort algorithm to (stable) sort superdroplets inside the domain by sdgbxindex.
 Gridbox indexes are assumed to run from 0 to gbxindex_max so that Superdroplets inside the
 domain have 0 <= sdgbxindex <= gbxindex_max. Superdroplets outside of the domain
-(i.e. sdgbxindex > gbxindex_max) are not guarenteed to be sorted. */
+(i.e. sdgbxindex > gbxindex_max) are not guarenteed to be sorted. Superdroplets are moved into
+their sorted order either by copying them into a temporary view (SortSupersMethod::counting_sort)
+or by moving only the superdroplets which are not already within the range of positions of their
+gridbox via a (smaller) staging view (SortSupersMethod::inplace). */
 struct SortSupersBySdgbxindex {
  public:
   size_t gbxindex_max;          /**< maximum gbxindex of in-domain superdroplets */
+  SortSupersMethod method;      /**< method for moving superdroplets into sorted order */
   viewd_counts counts;          /**< number of superdroplets in each gridbox + outside of domain */
   scatterviewd_counts s_counts; /**< scatter view for atomics/duplicate ops with counts */
   viewd_counts cumlcounts;      /**< cumulative version of counts */
   viewd_supers totsupers_tmp;   /**< temporary view of superdroplets used by sorting algorithm */
 
-  SortSupersBySdgbxindex(const size_t gbxindex_max_, const size_t ntotsupers)
+  SortSupersBySdgbxindex(const size_t gbxindex_max_, const size_t ntotsupers,
+                         const SortSupersMethod method_ = SortSupersMethod::counting_sort)
       : gbxindex_max(gbxindex_max_),
+        method(method_),
         counts("counts", gbxindex_max + 1),
         s_counts(counts),
         cumlcounts("cumlcounts", gbxindex_max + 1),
-        totsupers_tmp("totsupers_tmp", ntotsupers) {}
+        totsupers_tmp("totsupers_tmp", method == SortSupersMethod::inplace ? 0 : ntotsupers) {}
+
+  /* (re)allocate totsupers_tmp if its size does not match totsupers, e.g. because the capacity of
+  the totsupers view has grown or shrunk since the last sort. E.g. freeing memory of a larger
+  totsupers_tmp after the totsupers view has been shrunk. If method is inplace, the staging views
+  are only shrunk if they are larger than totsupers (see resize_staging). */
+  void resize_totsupers_tmp(const viewd_constsupers totsupers) {
+    if (method == SortSupersMethod::inplace) {
+      resize_staging(0, totsupers.extent(0));
+    } else if (totsupers_tmp.extent(0) != totsupers.extent(0)) {
+      Kokkos::realloc(totsupers_tmp, totsupers.extent(0));
+    }
+  }
+
+  /* (re)allocate totsupers_tmp for staging nstaged superdroplets (if method is inplace). Staging
+  view only grows, unless it is larger than totsupers (e.g. because the totsupers view has been
+  shrunk), and is never larger than totsupers. */
+  void resize_staging(const size_t nstaged, const size_t ntotsupers) {
+    if (totsupers_tmp.extent(0) < nstaged || totsupers_tmp.extent(0) > ntotsupers) {
+      const auto capacity = Kokkos::min(Kokkos::max(nstaged, 2 * totsupers_tmp.extent(0)),
+                                        ntotsupers);
+      Kokkos::realloc(Kokkos::WithoutInitializing, totsupers_tmp, capacity);
+    }
+  }
 
   /* a precedes b if its sdgbxindex is smaller */
   struct SortComparator {
@@ -192,12 +293,56 @@ struct SortSupersBySdgbxindex {
     return totsupers_tmp;
   }
 
+  /* Sorts superdroplets in-place by sdgbxindex, i.e. returned view is the same totsupers view given
+  as argument. Only superdroplets which are not already within the range of positions of their
+  bucket (i.e. gridbox or outside of domain) given by cumlcounts are moved: they are copied (in
+  parallel) into a staging view (totsupers_tmp), sorted there by sdgbxindex, and then copied back
+  into the holes they left in totsupers. Extra memory is therefore proportional to the number of
+  superdroplets which are not within the range of their bucket, e.g. because they or others have
+  changed gridbox since the last sort, and never exceeds that of counting_sort. Superdroplets
+  which are not moved keep their order. */
+  viewd_supers inplace_sort(const viewd_supers totsupers) {
+    const auto ntotsupers = size_t{totsupers.extent(0)};
+    cumlcounts = create_cumlcounts(totsupers);
+
+    auto functor = InplaceSortFunctor{gbxindex_max, totsupers, cumlcounts, totsupers_tmp};
+    auto nstaged = size_t{0};
+    Kokkos::parallel_reduce(
+        "inplace_sort_count", Kokkos::RangePolicy<ExecSpace>(0, ntotsupers),
+        KOKKOS_LAMBDA(const size_t kk, size_t& n) { n += functor.is_misplaced(kk); }, nstaged);
+    if (nstaged == 0) {
+      return totsupers;
+    }
+    resize_staging(nstaged, ntotsupers);
+    functor.staging = totsupers_tmp;
+    Kokkos::parallel_scan(
+        "inplace_sort_stage", Kokkos::RangePolicy<ExecSpace>(0, ntotsupers),
+        KOKKOS_LAMBDA(const size_t kk, size_t& ss, const bool is_final) {
+          functor.stage(kk, ss, is_final);
+        });
+
+    Kokkos::sort(ExecSpace(), Kokkos::subview(totsupers_tmp, kkpair_size_t{0, nstaged}),
+                 SortComparator{});
+
+    Kokkos::parallel_scan(
+        "inplace_sort_unstage", Kokkos::RangePolicy<ExecSpace>(0, ntotsupers),
+        KOKKOS_LAMBDA(const size_t kk, size_t& ss, const bool is_final) {
+          functor.unstage(kk, ss, is_final);
+        });
+
+    return totsupers;
+  }
+
   /* Counting sort algorithm to (stable) sort superdroplets inside the domain by sdgbxindex.
   Superdrops in totsupers may change (e.g. sdgbxindex may be set to LIMITVALUES::oob_gbxindex) and
   returned view may not be the same totsupers view given as argument. Superdroplets outside of the
   domain (i.e. sdgbxindex > gbxindex_max) are not guarenteed to be sorted. */
   viewd_supers operator()(const viewd_supers totsupers) {
+    if (method == SortSupersMethod::inplace) {
+      return inplace_sort(totsupers);
+    }
     cumlcounts = create_cumlcounts(totsupers);
+    resize_totsupers_tmp(totsupers);
     const auto sorted_supers = counting_sort(totsupers);
     totsupers_tmp = totsupers;  // fail-safe reset totsupers_tmp
     return sorted_supers;
@@ -218,7 +363,11 @@ struct SortSupersBySdgbxindex {
     const kkpair_size_t oobrefs = Kokkos::make_pair(domainrefs.second, totsupers.extent(0));
     const auto oob_supers = Kokkos::subview(totsupers, oobrefs);
 
+    if (method == SortSupersMethod::inplace) {
+      return inplace_sort(totsupers);
+    }
     cumlcounts = create_cumlcounts(totsupers);
+    resize_totsupers_tmp(totsupers);
     const auto sorted_supers = counting_sort(d_gbxs, domainsupers, oob_supers);
     totsupers_tmp = totsupers;  // fail-safe reset totsupers_tmp
     return sorted_supers;
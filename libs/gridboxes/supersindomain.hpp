@@ -22,48 +22,117 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Pair.hpp>
 #include <Kokkos_StdAlgorithms.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
 
+#include "../cleoconstants.hpp"
 #include "gridboxes/findrefs.hpp"
 #include "gridboxes/sortsupers.hpp"
 #include "superdrops/kokkosaliases_sd.hpp"
 
+/* Returns superdroplets view reallocated to have given capacity (i.e. extent). The first
+min(capacity, supers.extent(0)) superdroplets are copied into the new view and superdroplets in any
+additional memory have sdgbxindex = LIMITVALUES::oob_gbxindex (i.e. are out of bounds of the
+domain). */
+inline viewd_supers resize_supers_capacity(viewd_supers supers, const size_t capacity) {
+  const auto old_capacity = size_t{supers.extent(0)};
+  Kokkos::resize(supers, capacity);
+  if (capacity > old_capacity) {
+    Kokkos::parallel_for(
+        "init_new_supers", Kokkos::RangePolicy<ExecSpace>(old_capacity, capacity),
+        KOKKOS_LAMBDA(const size_t kk) { supers(kk).set_sdgbxindex(LIMITVALUES::oob_gbxindex); });
+  }
+
+  return supers;
+}
+
+/* Returns superdroplets view with capacity (i.e. extent) for at least nsupers superdroplets. If
+supers is too small it is reallocated with its capacity grown geometrically (i.e. at least doubled)
+but not beyond max_capacity, see resize_supers_capacity. Throws error if nsupers > max_capacity. */
+inline viewd_supers grow_supers_capacity(viewd_supers supers, const size_t nsupers,
+                                         const size_t max_capacity) {
+  const auto capacity = size_t{supers.extent(0)};
+  if (nsupers <= capacity) {
+    return supers;
+  }
+
+  if (nsupers > max_capacity) {
+    const auto err = std::string(
+        "number of superdroplets (" + std::to_string(nsupers) +
+        ") exceeds maximum capacity of superdroplets' view (" + std::to_string(max_capacity) + ")");
+    throw std::runtime_error(err);
+  }
+
+  const auto new_capacity = std::min(std::max(nsupers, 2 * capacity), max_capacity);
+  return resize_supers_capacity(supers, new_capacity);
+}
+
 /* Struct which handles the references to identify the chunk of memory containing super-droplets
 occupying domain (i.e. within any of the gridboxes on a single node), e.g. through std::span or
 Kokkos::subview). Gridbox indexes are assumed to run from 0 to gbxindex_max so that Superdroplets
 inside the domain have 0 <= sdgbxindex <= gbxindex_max. Struct also contains menthods to sort
-and reassign the superdroplet view used to store superdroplets in the domain. */
+and reassign the superdroplet view used to store superdroplets in the domain. The capacity of the
+view grows on demand (see reserve) up to max_capacity, and shrinks again (but never below its
+initial capacity) if the superdroplets in the domain occupy less than a quarter of it. */
 struct SupersInDomain {
  private:
   Kokkos::pair<unsigned int, unsigned int> gbxindex_range; /**< {min, max} gbxindex of domain */
   viewd_supers totsupers;   /**< view of all superdrops (both in and out of bounds of domain) */
   kkpair_size_t domainrefs; /**< position in view of (first, last) superdrop that occupies domain */
   SortSupersBySdgbxindex sort_by_sdgbxindex; /**< method to sort view of superdrops by sdgbxindex */
+  size_t min_capacity; /**< initial capacity of totsupers, below which it is never shrunk */
+  size_t max_capacity; /**< ceiling on capacity of totsupers when it grows */
+  size_t version;      /**< incremented every time totsupers is sorted or reallocated */
 
   /* Assign superdroplets view used to store superdroplets in the domain and update the domainrefs
   for identifying the subview which contains in-domain superdroplets. Gridbox indexes are assumed
   to start at 0, meaning superdroplets inside the domain are those with
-  0 <= sdgbxindex <= gbxindex_range.second (= gbxindex_max). */
+  0 <= sdgbxindex <= gbxindex_range.second (= gbxindex_max). Increments version because
+  (sub)views of the previous totsupers may no longer view the same superdroplets. */
   void set_totsupers_domainrefs(const viewd_supers totsupers_) {
     totsupers = totsupers_;
     domainrefs = find_domainrefs(ExecSpace(), totsupers, gbxindex_range.second);
+    ++version;
+  }
+
+  /* Shrink capacity of (sorted) totsupers to max(2 * domain_nsupers, min_capacity) if superdroplets
+  in the domain occupy less than a quarter of it, e.g. after a large number of superdroplets have
+  been removed from the domain. New capacity is never less than the end of the in domain
+  superdroplets, and out of domain superdroplets beyond the new capacity are discarded. */
+  void shrink_capacity() {
+    const auto capacity = size_t{totsupers.extent(0)};
+    const auto nsupers = domain_nsupers();
+    if (capacity > min_capacity && 4 * nsupers < capacity) {
+      const auto new_capacity = std::max({2 * nsupers, size_t{domainrefs.second}, min_capacity});
+      set_totsupers_domainrefs(resize_supers_capacity(totsupers, new_capacity));
+    }
   }
 
  public:
   /* Assigns and sorts view for superdroplets, then identifies in-domain superdroplets.
   Gridbox indexes are assumed to start at 0, meaning superdroplets inside the domain are
-  those with 0 <= sdgbxindex <= gbxindex_range.second (= gbxindex_max). */
-  explicit SupersInDomain(const viewd_supers totsupers_, const unsigned int gbxindex_max)
+  those with 0 <= sdgbxindex <= gbxindex_range.second (= gbxindex_max). Superdroplets are
+  sorted using the given sort method (see SortSupersMethod), e.g. in-place sorting avoids
+  storing a second (temporary) view of all the superdroplets. Initial capacity for superdroplets is
+  the extent of the given view, which may grow up to max_capacity (unlimited by default). */
+  explicit SupersInDomain(const viewd_supers totsupers_, const unsigned int gbxindex_max,
+                          const SortSupersMethod sort_method = SortSupersMethod::counting_sort,
+                          const size_t max_capacity_ = std::numeric_limits<size_t>::max())
       : gbxindex_range({0, gbxindex_max}),
         totsupers(totsupers_),
         domainrefs({0, 0}),
-        sort_by_sdgbxindex(SortSupersBySdgbxindex(gbxindex_range.second, totsupers.extent(0))) {
+        sort_by_sdgbxindex(
+            SortSupersBySdgbxindex(gbxindex_range.second, totsupers.extent(0), sort_method)),
+        min_capacity(totsupers_.extent(0)),
+        max_capacity(std::max(max_capacity_, size_t{totsupers_.extent(0)})),
+        version(0) {
     auto sorted_supers = sort_by_sdgbxindex(totsupers_);
     set_totsupers_domainrefs(sorted_supers);
   }
 
-  viewd_supers get_totsupers() const {
-    return totsupers;
-  }  // TODO(CB): replace with appending SDs func which could resize(?)
+  viewd_supers get_totsupers() const { return totsupers; }
 
   /* read-only means superdrops in the totsupers view are const */
   viewd_constsupers get_totsupers_readonly() const { return totsupers; }
@@ -80,14 +149,38 @@ struct SupersInDomain {
   /* returns the total number of all the superdrops in the domain (excluding out of bounds ones) */
   size_t domain_nsupers() const { return domainrefs.second - domainrefs.first; }
 
+  /* returns current capacity (i.e. extent) of view for superdroplets */
+  size_t get_capacity() const { return totsupers.extent(0); }
+
+  /* returns ceiling on capacity of view for superdroplets */
+  size_t get_max_capacity() const { return max_capacity; }
+
+  /* returns number of times superdroplets have been sorted or reallocated, e.g. to check whether
+  a (sub)view of superdroplets obtained previously still views the same superdroplets */
+  size_t get_version() const { return version; }
+
+  /* ensure totsupers has capacity for at least nsupers superdroplets, growing it geometrically if
+  necessary (see grow_supers_capacity). Superdroplets (and hence domainrefs) keep their positions in
+  the view, but the view itself may be reallocated so previously obtained (sub)views of totsupers
+  become invalid. */
+  void reserve(const size_t nsupers) {
+    if (nsupers > totsupers.extent(0)) {
+      set_totsupers_domainrefs(grow_supers_capacity(totsupers, nsupers, max_capacity));
+    }
+  }
+
   /* returns true if superdrops in view are sorted by their sdgbxindexes in ascending order */
   bool is_sorted() const { return sort_by_sdgbxindex.is_sorted(totsupers); }
 
   /* sort superdroplets by sdgbxindex and then (re-)set the totsupers view and the refs for the
-  superdroplets that are within the domain (sdgbxindex within gbxindex_range for a given node) */
+  superdroplets that are within the domain (sdgbxindex within gbxindex_range for a given node).
+  Capacity of totsupers may be shrunk after sorting (see shrink_capacity) in which case the
+  temporary view(s) used for sorting are shrunk to match it. */
   viewd_supers sort_totsupers(const viewd_constgbx d_gbxs) {
     auto sorted_supers = sort_by_sdgbxindex(totsupers, d_gbxs, domainrefs);
     set_totsupers_domainrefs(sorted_supers);
+    shrink_capacity();
+    sort_by_sdgbxindex.resize_totsupers_tmp(totsupers);
     return totsupers;
   }
 
@@ -47,6 +47,37 @@ GbxBoundsFromBinary::GbxBoundsFromBinary(const size_t ngbxs, const unsigned int
   is_nspacedims_compatible(nspacedims);
 }
 
+/* creates gridbox indexes and boundaries for a uniform grid with ndims gridboxes in the
+[coord3, coord1, coord2] dimensions, each gridbox having the same (dimensionless) size in
+each dimension given by gbxsizes. Grid starts at 0.0 in all dimensions and gridbox indexes
+are in order of gbxidx = k + ndims[0] * (i + ndims[1] * j) for the kth, ith and jth gridbox
+in the coord3, coord1 and coord2 dimensions */
+GbxBoundsFromBinary::GbxBoundsFromBinary(const std::vector<size_t>& ndims,
+                                         const std::array<double, 3> gbxsizes,
+                                         const unsigned int nspacedims)
+    : ndims(ndims) {
+  if (ndims.size() != 3) {
+    throw std::invalid_argument("ndims must be number of gridboxes in 3 dimensions");
+  }
+
+  const auto ngbxs = get_ngbxs();
+  gbxidxs.reserve(ngbxs);
+  gbxbounds.reserve(6 * ngbxs);
+  for (size_t j(0); j < ndims.at(2); ++j) {
+    for (size_t i(0); i < ndims.at(1); ++i) {
+      for (size_t k(0); k < ndims.at(0); ++k) {
+        gbxidxs.push_back(static_cast<unsigned int>(k + ndims.at(0) * (i + ndims.at(1) * j)));
+        gbxbounds.insert(gbxbounds.end(),
+                         {k * gbxsizes.at(0), (k + 1) * gbxsizes.at(0), i * gbxsizes.at(1),
+                          (i + 1) * gbxsizes.at(1), j * gbxsizes.at(2), (j + 1) * gbxsizes.at(2)});
+      }
+    }
+  }
+
+  is_ngbxs_compatible(ngbxs);
+  is_nspacedims_compatible(nspacedims);
+}
+
 /* Throws error if ngbxs is not consistent with
 number of gridboxes from gridfile as calculated
 via the get_ngbxs() function */
@@ -153,8 +184,13 @@ bool GbxBoundsFromBinary::check_3Dmodel_gbxbounds() const {
 
 /* returns distance (number of hops) from start of
 gbxidxs vector to position where gbxidx matches idx
-(ie. *it = idx) */
+(ie. *it = idx). Gridboxes are usually in order of their
+index so position idx is checked first before searching */
 size_t GbxBoundsFromBinary::find_idx_in_gbxidxs(const unsigned int idx) const {
+  if (idx < gbxidxs.size() && gbxidxs[idx] == idx) {
+    return idx;
+  }
+
   auto it(std::find(gbxidxs.begin(), gbxidxs.end(), idx));  // iterator to idx
   size_t pos(std::distance(gbxidxs.begin(), it));           // distance from start of gbxidxs to idx
 
@@ -61,6 +61,13 @@ struct GbxBoundsFromBinary {
   GbxBoundsFromBinary(const size_t ngbxs, const unsigned int nspacedims,
                       const std::filesystem::path grid_filename);
 
+  /* creates gridbox indexes and boundaries for a uniform grid with ndims gridboxes in the
+  [coord3, coord1, coord2] dimensions, each gridbox having the same (dimensionless) size in
+  each dimension given by gbxsizes. Grid starts at 0.0 in all dimensions. E.g. to generate a
+  domain without a gridfile (for example for benchmarking) */
+  GbxBoundsFromBinary(const std::vector<size_t>& ndims, const std::array<double, 3> gbxsizes,
+                      const unsigned int nspacedims);
+
   /* returns coord3 {lower, upper} gridbox bounds
   from position in gbxbounds vector which corresponds
   to position in gbxidxs where gbxidx = idx */
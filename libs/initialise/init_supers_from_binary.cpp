@@ -65,13 +65,17 @@ void InitSupersFromBinary::trim_nonlocal_superdrops(InitSupersData& initdata) co
   int my_rank;
   my_rank = init_communicator::get_comm_rank();
 
-  if (gbxmaps.get_total_global_ngridboxes() == gbxmaps.get_local_ngridboxes_hostcopy()) return;
+  const auto& decomposition = gbxmaps.get_domain_decomposition();
+  if (gbxmaps.get_total_global_ngridboxes() == gbxmaps.get_local_ngridboxes_hostcopy() &&
+      decomposition.get_gridbox_ordering() == "lexicographic") {
+    return;
+  }
 
   // Go through all superdrops and resets the values of the non-local ones
   auto gbxindex = size_t{0};
   for (size_t superdrop_index = 0; superdrop_index < initdata.sdgbxindexes.size();) {
     gbxindex = initdata.sdgbxindexes[superdrop_index];
-    if (my_rank != gbxmaps.get_domain_decomposition().get_gridbox_owner_process(gbxindex)) {
+    if (my_rank != decomposition.get_gridbox_owner_process(gbxindex)) {
       // resets superdrops which are in gridboxes not owned by this process
       initdata.sdgbxindexes[superdrop_index] = LIMITVALUES::oob_gbxindex;
       initdata.xis[superdrop_index] = std::numeric_limits<uint64_t>::signaling_NaN();
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: init_supers_synthetic.cpp
+ * Project: initialise
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * functionality for generating initial conditions for super-droplets (rather than reading them
+ * from a binary file) by sampling a droplet size distribution in every gridbox of the domain.
+ */
+
+#include "initialise/init_supers_synthetic.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "cartesiandomain/cartesian_decomposition.hpp"
+
+InitSupersSynthetic::InitSupersSynthetic(const Params& config, const GbxBoundsFromBinary& gfb,
+                                         const CartesianMaps& gbxmaps)
+    : InitSupersSynthetic(config, gfb, gbxmaps, {}) {}
+
+InitSupersSynthetic::InitSupersSynthetic(const Params& config, const GbxBoundsFromBinary& gfb,
+                                         const CartesianMaps& gbxmaps,
+                                         const std::vector<Params>& gbxparams)
+    : params(config), gfb(gfb), gbxmaps(gbxmaps), gbxparams(gbxparams) {
+  if (!gbxparams.empty() && gbxparams.size() != gfb.get_ngbxs()) {
+    throw std::invalid_argument("synthetic super-droplets' parameters must be given for every "
+                                "gridbox (or none)");
+  }
+
+  auto allparams = gbxparams;
+  allparams.push_back(params);
+  for (const auto& p : allparams) {
+    if (p.spectrum == "lognormal" && p.GEOMEANS.size() > SyntheticDistribution::MAXMODES) {
+      throw std::invalid_argument("synthetic super-droplets' lognormal spectrum has more than " +
+                                  std::to_string(SyntheticDistribution::MAXMODES) + " modes");
+    }
+    if (p.nsupers_per_gbx != params.nsupers_per_gbx) {
+      throw std::invalid_argument("synthetic super-droplets must have the same nsupers_per_gbx "
+                                  "in every gridbox");
+    }
+  }
+}
+
+/* returns droplet size distribution for given parameters in the form used by the functor, i.e.
+with logarithms of radii and NUMCONC scaled for sampling nsupers_per_gbx super-droplets uniformly
+in ln(r) in a (dimensionless) volume */
+SyntheticDistribution InitSupersSynthetic::distribution(const Params& p) const {
+  auto dist = SyntheticDistribution{};
+  dist.seed = p.seed;
+  dist.lnrmin = std::log(p.MINRADIUS);
+  dist.lnrspan = std::log(p.MAXRADIUS) - dist.lnrmin;
+  dist.dryradius = p.DRYRADIUS / dlc::R0;
+  dist.numconc = p.NUMCONC * dlc::VOL0 * dist.lnrspan / p.nsupers_per_gbx;
+
+  dist.is_exponential = (p.spectrum == "exponential");
+  dist.lnvolexpr0 = dist.is_exponential ? std::log(p.VOLEXPR0) : 0.0;
+  dist.nmodes = dist.is_exponential ? 0 : p.GEOMEANS.size();
+  for (size_t m(0); m < dist.nmodes; ++m) {
+    dist.lngeomeans[m] = std::log(p.GEOMEANS.at(m));
+    dist.lnsigmas[m] = std::log(p.geosigmas.at(m));
+    dist.modefracs[m] = p.modefracs.at(m);
+  }
+
+  return dist;
+}
+
+/* returns (global) indexes of gridboxes owned by this process in order of their local index */
+std::vector<size_t> InitSupersSynthetic::local_gbxindexes() const {
+  const auto& decomposition = gbxmaps.get_domain_decomposition();
+  const auto origin = decomposition.get_local_partition_origin();
+  const auto size = decomposition.get_local_partition_size();
+
+  auto gbxindexes = std::vector<size_t>(gbxmaps.get_local_ngridboxes_hostcopy());
+  for (size_t j(0); j < size[2]; ++j) {
+    for (size_t i(0); i < size[1]; ++i) {
+      for (size_t k(0); k < size[0]; ++k) {
+        const auto idx =
+            get_index_from_coordinates(gfb.ndims, origin[0] + k, origin[1] + i, origin[2] + j);
+        gbxindexes.at(gbxmaps.global_to_local_gbxindex(idx)) = idx;
+      }
+    }
+  }
+
+  return gbxindexes;
+}
+
+/* returns functor for generating super-droplets in gridboxes owned by this process. Copies the
+(global) index, bounds and droplet size distribution of every local gridbox into device memory. */
+GenSyntheticSuperdrop InitSupersSynthetic::superdrop_generator() const {
+  const auto gbxindexes = local_gbxindexes();
+  const auto ngbxs = gbxindexes.size();
+
+  auto gen = GenSyntheticSuperdrop{};
+  gen.gbxindexes = GenSyntheticSuperdrop::viewd_gbxindexes("synthetic_gbxindexes", ngbxs);
+  gen.gbxbounds = GenSyntheticSuperdrop::viewd_gbxbounds("synthetic_gbxbounds", ngbxs);
+  gen.gbxdists = GenSyntheticSuperdrop::viewd_gbxdists("synthetic_gbxdists", ngbxs);
+
+  gen.nsupers = params.nsupers_per_gbx;
+  gen.nspacedims = params.nspacedims;
+
+  const auto configdist = distribution(params);
+  auto h_gbxindexes = Kokkos::create_mirror_view(gen.gbxindexes);
+  auto h_gbxbounds = Kokkos::create_mirror_view(gen.gbxbounds);
+  auto h_gbxdists = Kokkos::create_mirror_view(gen.gbxdists);
+  for (size_t ii(0); ii < ngbxs; ++ii) {
+    const auto idx = static_cast<unsigned int>(gbxindexes.at(ii));
+    const auto c3bs = gfb.get_coord3gbxbounds(idx);
+    const auto c1bs = gfb.get_coord1gbxbounds(idx);
+    const auto c2bs = gfb.get_coord2gbxbounds(idx);
+    h_gbxindexes(ii) = gbxindexes.at(ii);
+    h_gbxdists(ii) = gbxparams.empty() ? configdist : distribution(gbxparams.at(idx));
+    h_gbxbounds(ii, 0) = c3bs.first;
+    h_gbxbounds(ii, 1) = c3bs.second;
+    h_gbxbounds(ii, 2) = c1bs.first;
+    h_gbxbounds(ii, 3) = c1bs.second;
+    h_gbxbounds(ii, 4) = c2bs.first;
+    h_gbxbounds(ii, 5) = c2bs.second;
+  }
+  Kokkos::deep_copy(gen.gbxindexes, h_gbxindexes);
+  Kokkos::deep_copy(gen.gbxbounds, h_gbxbounds);
+  Kokkos::deep_copy(gen.gbxdists, h_gbxdists);
+
+  return gen;
+}
+
+/* generates super-droplets in every gridbox owned by this process in parallel directly in
+'totsupers' view in device memory, which must have size get_maxnsupers(). The kk'th super-droplet
+in the view is the (kk % nsupers_per_gbx)'th super-droplet of the (kk / nsupers_per_gbx)'th
+local gridbox, so super-droplets are already ordered by their gridbox indexes. */
+void InitSupersSynthetic::initialise_supers_on_device(const viewd_supers totsupers) const {
+  if (totsupers.extent(0) != get_maxnsupers()) {
+    throw std::invalid_argument("size of view for synthetic super-droplets must be maxnsupers");
+  }
+
+  const auto gen = superdrop_generator();
+  Kokkos::parallel_for(
+      "initialise_supers_on_device", Kokkos::RangePolicy<ExecSpace>(0, totsupers.extent(0)),
+      KOKKOS_LAMBDA(const size_t kk) { totsupers(kk) = gen(kk); });
+}
+
+/* return InitSupersData generated for super-droplets in every gridbox owned by this process.
+Super-droplets are generated (in parallel) and then copied into host memory so data is identical
+to the super-droplets created by initialise_supers_on_device. Also checks that the data created
+has the expected sizes. */
+InitSupersData InitSupersSynthetic::fetch_data() const {
+  auto totsupers = viewd_supers("synthetic_supers", get_maxnsupers());
+  initialise_supers_on_device(totsupers);
+  const auto h_totsupers = Kokkos::create_mirror_view_and_copy(HostSpace(), totsupers);
+
+  auto initdata = InitSupersData{};
+  initdata.solutes.at(0) = SoluteProperties{};
+  for (size_t kk(0); kk < h_totsupers.extent(0); ++kk) {
+    const auto& drop = h_totsupers(kk);
+    initdata.sdgbxindexes.push_back(drop.get_sdgbxindex());
+    initdata.radii.push_back(drop.get_radius());
+    initdata.msols.push_back(drop.get_msol());
+    initdata.xis.push_back(drop.get_xi());
+    initdata.sdIds.push_back(drop.sdId);
+
+    switch (params.nspacedims) {
+      case 3:  // 3-D model
+        initdata.coord2s.push_back(drop.get_coord2());
+        [[fallthrough]];
+      case 2:  // 3-D or 2-D model
+        initdata.coord1s.push_back(drop.get_coord1());
+        [[fallthrough]];
+      case 1:  // 3-D, 2-D or 1-D model
+        initdata.coord3s.push_back(drop.get_coord3());
+    }
+  }
+
+  check_initdata_sizes(initdata, get_maxnsupers(), params.nspacedims);
+
+  return initdata;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: init_supers_synthetic.hpp
+ * Project: initialise
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * struct for generating initial conditions for super-droplets (rather than reading them from a
+ * binary file) by sampling a droplet size distribution in every gridbox of the domain. Struct
+ * can be used by InitConds struct as SuperdropInitConds type and generates super-droplets
+ * directly in device memory when used by create_supers.
+ */
+
+#ifndef LIBS_INITIALISE_INIT_SUPERS_SYNTHETIC_HPP_
+#define LIBS_INITIALISE_INIT_SUPERS_SYNTHETIC_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include "../cleoconstants.hpp"
+#include "cartesiandomain/cartesianmaps.hpp"
+#include "configuration/optional_config_params.hpp"
+#include "initialise/gbx_bounds_from_binary.hpp"
+#include "initialise/init_all_supers_from_binary.hpp"
+#include "initialise/initialconditions.hpp"
+#include "superdrops/collisions/urbg.hpp"
+#include "superdrops/kokkosaliases_sd.hpp"
+#include "superdrops/superdrop.hpp"
+
+namespace dlc = dimless_constants;
+
+/* parameters of the droplet size distribution sampled by GenSyntheticSuperdrop in a gridbox */
+struct SyntheticDistribution {
+  static constexpr size_t MAXMODES = 4; /**< maximum number of modes of lognormal spectrum */
+
+  uint64_t seed;       /**< seed for super-droplets' random attributes */
+  double numconc;      /**< NUMCONC * VOL0 * lnrspan / nsupers */
+  double lnrmin;       /**< ln(MINRADIUS [m]) */
+  double lnrspan;      /**< ln(MAXRADIUS / MINRADIUS) */
+  double dryradius;    /**< (dimensionless) dry radius of super-droplets */
+  bool is_exponential; /**< true = exponential spectrum, false = lognormal modes */
+  double lnvolexpr0;   /**< ln(VOLEXPR0 [m]) of exponential spectrum */
+  size_t nmodes;       /**< no. of modes of lognormal spectrum */
+
+  Kokkos::Array<double, MAXMODES> lngeomeans; /**< ln(GEOMEAN [m]) of lognormal modes */
+  Kokkos::Array<double, MAXMODES> lnsigmas;   /**< ln(geosigma) of lognormal modes */
+  Kokkos::Array<double, MAXMODES> modefracs;  /**< fraction of NUMCONC in lognormal modes */
+
+  /* returns number of real droplets per unit ln(r) per unit volume normalised by NUMCONC */
+  KOKKOS_INLINE_FUNCTION
+  double lnr_distribution(const double lnr) const {
+    if (is_exponential) {
+      const auto x = Kokkos::exp(3.0 * (lnr - lnvolexpr0));
+      return 3.0 * x * Kokkos::exp(-x);
+    }
+
+    auto dist = double{0.0};
+    for (size_t m(0); m < nmodes; ++m) {
+      const auto z = (lnr - lngeomeans[m]) / lnsigmas[m];
+      dist += modefracs[m] * Kokkos::exp(-0.5 * z * z) /
+              (Kokkos::sqrt(2.0 * std::numbers::pi) * lnsigmas[m]);
+    }
+    return dist;
+  }
+};
+
+/* functor which generates the kk'th super-droplet for InitSupersSynthetic on host or device.
+Every random number is a hash of the gridbox's seed, the (global) index of the super-droplet's
+gridbox, the super-droplet's position in its gridbox and the attribute being sampled (i.e. the
+generator is counter-based), so super-droplets are independent of the number of threads and
+processes and of the order in which they are generated. */
+struct GenSyntheticSuperdrop {
+  using viewd_gbxindexes = Kokkos::View<size_t*>;
+  using viewd_gbxbounds = Kokkos::View<double* [6]>;
+  using viewd_gbxdists = Kokkos::View<SyntheticDistribution*>;
+
+  viewd_gbxindexes gbxindexes;    /**< (global) index of each gridbox in order of local index */
+  viewd_gbxbounds gbxbounds;      /**< (dimless) [coord3, coord1, coord2] bounds of gridboxes */
+  viewd_gbxdists gbxdists;        /**< droplet size distribution in each gridbox */
+  Superdrop::IDType::Gen sdIdgen; /**< for super-droplets' IDs from their (global) position */
+
+  size_t nsupers;          /**< no. of super-droplets in each gridbox */
+  unsigned int nspacedims; /**< no. of spatial dimensions of model */
+
+  /* returns number uniformly distributed in [0, 1) for the stream'th attribute of the n'th
+  super-droplet in local gridbox ii */
+  KOKKOS_INLINE_FUNCTION
+  double uniform_01(const size_t ii, const size_t n, const uint64_t stream) const {
+    const auto counter = splitmix64(gbxindexes(ii) ^ splitmix64(n * 4 + stream));
+    const auto key = splitmix64(gbxdists(ii).seed ^ counter);
+    constexpr double twoPow53 = 9007199254740992.0;
+    return static_cast<double>(key >> 11) / twoPow53;
+  }
+
+  /* returns coordinate uniformly distributed between the lower and upper bounds at positions
+  b and b + 1 of the bounds of local gridbox ii */
+  KOKKOS_INLINE_FUNCTION
+  double coord(const size_t ii, const size_t b, const size_t n, const uint64_t stream) const {
+    const auto lower = gbxbounds(ii, b);
+    const auto upper = gbxbounds(ii, b + 1);
+    return lower + uniform_01(ii, n, stream) * (upper - lower);
+  }
+
+  /* returns the n'th super-droplet in local gridbox ii where kk = ii * nsupers + n. The
+  super-droplet's radius is sampled uniformly in ln(r) and its multiplicity is weighted by the
+  droplet size distribution (and is at least 1). Coordinates are uniformly distributed in the
+  gridbox for the dimensions of the model (and 0.0 otherwise). */
+  KOKKOS_INLINE_FUNCTION
+  Superdrop operator()(const size_t kk) const {
+    const auto ii = kk / nsupers;
+    const auto n = kk % nsupers;
+    const auto gbxindex = gbxindexes(ii);
+    const auto& dist = gbxdists(ii);
+
+    const auto lnr = dist.lnrmin + uniform_01(ii, n, 0) * dist.lnrspan;
+    const auto radius = Kokkos::exp(lnr) / dlc::R0;
+    const auto vol = (gbxbounds(ii, 1) - gbxbounds(ii, 0)) * (gbxbounds(ii, 3) - gbxbounds(ii, 2)) *
+                     (gbxbounds(ii, 5) - gbxbounds(ii, 4));
+    const auto nreal = dist.numconc * vol * dist.lnr_distribution(lnr);
+    const auto xi = Kokkos::fmax(Kokkos::round(nreal), 1.0);
+    const auto dry = Kokkos::fmin(dist.dryradius, radius);
+    const auto msol = 4.0 * std::numbers::pi * dlc::Rho_sol * dry * dry * dry / 3.0;
+
+    auto coords312 = Kokkos::Array<double, 3>{0.0, 0.0, 0.0};
+    switch (nspacedims) {
+      case 3:  // 3-D model
+        coords312[2] = coord(ii, 4, n, 3);
+        [[fallthrough]];
+      case 2:  // 3-D or 2-D model
+        coords312[1] = coord(ii, 2, n, 2);
+        [[fallthrough]];
+      case 1:  // 3-D, 2-D or 1-D model
+        coords312[0] = coord(ii, 0, n, 1);
+    }
+
+    auto idgen = sdIdgen;
+    const auto sdId = idgen.set(static_cast<unsigned int>(gbxindex * nsupers + n));
+    const auto attrs =
+        SuperdropAttrs(SoluteProperties{}, static_cast<uint64_t>(xi), radius, msol, true);
+
+    return Superdrop(static_cast<unsigned int>(ii), coords312[0], coords312[1], coords312[2],
+                     attrs, sdId);
+  }
+};
+
+/* struct containing functions which return data for the initial conditions needed to create
+superdroplets e.g. via the CreateSupers struct. Data is generated for nsupers_per_gbx
+super-droplets in each gridbox owned by this process, with radii sampled uniformly in ln(r)
+between MINRADIUS and MAXRADIUS and multiplicities weighted so that they represent a lognormal
+(with up to SyntheticDistribution::MAXMODES modes) or exponential (in volume) droplet size
+distribution with number concentration NUMCONC. Super-droplets' coordinates are uniformly
+distributed within their gridbox. Super-droplets are generated in parallel by a
+GenSyntheticSuperdrop functor, either directly into a view in device memory (see
+initialise_supers_on_device) or on host for fetch_data. Optionally, the parameters of the
+droplet size distribution (e.g. seed, NUMCONC, GEOMEANS) can be given for each gridbox
+individually, e.g. for an ensemble of independent box models. */
+struct InitSupersSynthetic {
+ private:
+  using Params = OptionalConfigParams::InitSupersSyntheticParams;
+  Params params;                  /**< droplet size distribution etc. */
+  const GbxBoundsFromBinary& gfb; /**< hook to (dimensionless) bounds of all gridboxes in domain */
+  const CartesianMaps& gbxmaps;   /**< hook to get to gridbox maps for current cartesian domain */
+  std::vector<Params> gbxparams;  /**< (optional) params for each gridbox in global index order */
+
+  /* returns droplet size distribution for given parameters (for the functor) */
+  SyntheticDistribution distribution(const Params& p) const;
+
+  /* returns (global) indexes of gridboxes owned by this process */
+  std::vector<size_t> local_gbxindexes() const;
+
+  /* returns functor for generating super-droplets in gridboxes owned by this process */
+  GenSyntheticSuperdrop superdrop_generator() const;
+
+ public:
+  InitSupersSynthetic(const Params& config, const GbxBoundsFromBinary& gfb,
+                      const CartesianMaps& gbxmaps);
+
+  /* as for constructor above but with the parameters of the droplet size distribution for every
+  gridbox in the domain (in order of global gridbox index) instead of those of the configuration.
+  If gbxparams is empty the configuration is used for all gridboxes. The number of super-droplets
+  per gridbox and the number of spatial dimensions are always those of the configuration. */
+  InitSupersSynthetic(const Params& config, const GbxBoundsFromBinary& gfb,
+                      const CartesianMaps& gbxmaps, const std::vector<Params>& gbxparams);
+
+  auto get_maxnsupers() const {
+    return params.nsupers_per_gbx * gbxmaps.get_local_ngridboxes_hostcopy();
+  }
+
+  auto get_nspacedims() const { return params.nspacedims; }
+
+  /* generates super-droplets in every gridbox owned by this process in parallel directly in
+  'totsupers' view in device memory, which must have size get_maxnsupers(). */
+  void initialise_supers_on_device(const viewd_supers totsupers) const;
+
+  /* return InitSupersData generated for super-droplets in every gridbox owned by this process.
+  Also checks that the data created has the expected sizes. */
+  InitSupersData fetch_data() const;
+};
+
+#endif  // LIBS_INITIALISE_INIT_SUPERS_SYNTHETIC_HPP_
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: initgbxs_uniform.hpp
+ * Project: initialise
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * struct for initial conditions of gridboxes' states which are the same in every gridbox,
+ * e.g. for a domain generated without any input files
+ */
+
+#ifndef LIBS_INITIALISE_INITGBXS_UNIFORM_HPP_
+#define LIBS_INITIALISE_INITGBXS_UNIFORM_HPP_
+
+#include <utility>
+#include <vector>
+
+#include "../cleoconstants.hpp"
+#include "superdrops/thermodynamic_equations.hpp"
+
+namespace dlc = dimless_constants;
+
+/* struct containing functions which return data
+for the initial conditions needed to create
+gridboxes e.g. via the create_gbxs function where
+all gridboxes are initially the same and at rest */
+struct InitGbxsUniform {
+ private:
+  size_t ngbxs;
+  double press_i;    // initial (dimless) pressure
+  double temp_i;     // initial (dimless) temperature
+  double relh_init;  // initial relative humidity (%)
+
+ public:
+  /* initial conditions for ngbxs gridboxes with pressure, P_init [Pa], temperature,
+  TEMP_init [K] and relative humidity, relh_init [%] */
+  InitGbxsUniform(const size_t ngbxs, const double P_init, const double TEMP_init,
+                  const double relh_init)
+      : ngbxs(ngbxs),
+        press_i(P_init / dlc::P0),
+        temp_i(TEMP_init / dlc::TEMP0),
+        relh_init(relh_init) {}
+
+  size_t get_ngbxs() const { return ngbxs; }
+
+  std::vector<double> press() const { return std::vector<double>(ngbxs, press_i); }
+
+  std::vector<double> temp() const { return std::vector<double>(ngbxs, temp_i); }
+
+  /* vapour mass mixing ratio, 'qvap', for all gbxs
+  given by temp_i, press_i and relh_init */
+  std::vector<double> qvap() const {
+    const auto vapp = double{saturation_pressure(temp_i) * relh_init / 100.0};
+    const auto qvap_i = double{dlc::Mr_ratio * vapp / (press_i - vapp)};
+
+    return std::vector<double>(ngbxs, qvap_i);
+  }
+
+  std::vector<double> qcond() const { return std::vector<double>(ngbxs, 0.0); }
+
+  std::vector<std::pair<double, double>> wvel() const {
+    return std::vector<std::pair<double, double>>(ngbxs, {0.0, 0.0});
+  }
+
+  std::vector<std::pair<double, double>> uvel() const {
+    return std::vector<std::pair<double, double>>(ngbxs, {0.0, 0.0});
+  }
+
+  std::vector<std::pair<double, double>> vvel() const {
+    return std::vector<std::pair<double, double>>(ngbxs, {0.0, 0.0});
+  }
+};
+
+#endif  // LIBS_INITIALISE_INITGBXS_UNIFORM_HPP_
@@ -56,6 +56,11 @@ using viewd_counts = Kokkos::View<size_t*>; /**< View in device memory for sorti
 /**< Scatter view for abstracted use of atomics/duplicates when computing sums for viewd_counts */
 using scatterviewd_counts = Kokkos::Experimental::ScatterView<size_t*>;
 
+/* Sampling Superdrops */
+using viewd_indexes = Kokkos::View<size_t*>; /**< View in device memory of superdroplet indexes */
+using viewd_constindexes = Kokkos::View<const size_t*>;
+/**< View in device memory of const superdroplet indexes (e.g. of a sample of superdroplets) */
+
 namespace KokkosCleoSettings {
 constexpr auto team_size = Kokkos::AUTO();
 /**< configurable number threads per team for hierarchical parallelism over superdroplets */
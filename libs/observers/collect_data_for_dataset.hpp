@@ -86,6 +86,18 @@ struct CombinedCollectDataForDataset {
     }
   };
 
+  struct GatherFunctor {
+    CollectData1::GatherFunctor a_functor;
+    CollectData2::GatherFunctor b_functor;
+
+    /* Functor operator to gather each element in parallel in Kokkos Range Policy */
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_t nn) const {
+      a_functor(nn);
+      b_functor(nn);
+    }
+  };
+
   /**
    * @brief Constructs a CombinedCollectDataForDataset object.
    *
@@ -98,6 +110,13 @@ struct CombinedCollectDataForDataset {
     return Functor(a, b, d_gbxs, d_supers);
   }
 
+  GatherFunctor get_gather_functor(const viewd_constgbx d_gbxs,
+                                   const subviewd_constsupers d_supers,
+                                   const viewd_constindexes d_indexes) const {
+    return GatherFunctor{a.get_gather_functor(d_gbxs, d_supers, d_indexes),
+                         b.get_gather_functor(d_gbxs, d_supers, d_indexes)};
+  }
+
   template <typename Dataset>
   void write_to_arrays(const Dataset& dataset) const {
     a.write_to_arrays(dataset);
@@ -126,6 +145,12 @@ struct CombinedCollectDataForDataset {
     a.reallocate_views(sz);
     b.reallocate_views(sz);
   }
+
+  template <typename Pack>
+  void pack_views(Pack& pack) const {
+    a.pack_views(pack);
+    b.pack_views(pack);
+  }
 };
 
 /* struct satifying CollectDataForDataset and does nothing */
@@ -143,6 +168,11 @@ struct NullCollectDataForDataset {
     return Functor{};
   }
 
+  Functor get_gather_functor(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                             const viewd_constindexes d_indexes) const {
+    return Functor{};
+  }
+
   template <typename Dataset>
   void write_to_arrays(const Dataset& dataset) const {}
 
@@ -156,6 +186,9 @@ struct NullCollectDataForDataset {
   void write_ragged_arrayshapes(const Dataset& dataset) const {}
 
   void reallocate_views(const size_t sz) const {}
+
+  template <typename Pack>
+  void pack_views(Pack& pack) const {}
 };
 
 #endif  // LIBS_OBSERVERS_COLLECT_DATA_FOR_DATASET_HPP_
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: dsd_observer.cpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functionality to bin superdroplets into radius bins in each gridbox in parallel
+ */
+
+#include "./dsd_observer.hpp"
+
+/**
+ * @brief Returns the radius bin of a (dimensionless) radius, or nbins if radius is outside of the
+ * range of the bins.
+ *
+ * Since bins are evenly spaced in log(radius) the bin is calculated directly from log(radius) and
+ * then corrected for rounding error using the bin edges such that a radius is in bin bb if
+ * edges(bb) <= radius < edges(bb+1).
+ *
+ * @param radius The (dimensionless) radius of a superdroplet.
+ * @return The index of the bin containing the radius, or nbins if no bin contains it.
+ */
+KOKKOS_FUNCTION
+size_t DSDFunc::radius_bin(const double radius) const {
+  if (!(radius >= d_edges(0) && radius < d_edges(nbins))) {
+    return nbins;
+  }
+
+  auto bb = Kokkos::min(static_cast<size_t>((Kokkos::log(radius) - logr0) * inv_dlogr), nbins - 1);
+  if (bb > 0 && radius < d_edges(bb)) {
+    --bb;  // correct for rounding error
+  } else if (bb + 1 < nbins && radius >= d_edges(bb + 1)) {
+    ++bb;  // correct for rounding error
+  }
+  return bb;
+}
+
+/**
+ * @brief Performs binning of the superdroplets in a single gridbox into radius bins by
+ * calculating the bin of each superdroplet and then adding it to the histogram(s) of the gridbox.
+ *
+ * Kokkos::parallel_for over superdroplets with a TeamThreadRange is equivalent in serial to:
+ * for (size_t kk(0); kk < supers.extent(0); ++kk){[...]}. The cost is therefore independent of
+ * the number of bins. Superdroplets in the same gridbox may be in the same bin and so histograms
+ * are incremented atomically. Histograms are rows of the [gbxindex, bin] views for the gridbox's
+ * global index, and must be zero before binning.
+ *
+ * @param team_member The Kokkos team member.
+ * @param d_gbxs The view of gridboxes on device.
+ * @param d_supers The view of superdroplets on device.
+ */
+KOKKOS_FUNCTION
+void DSDFunc::operator()(const TeamMember& team_member, const viewd_constgbx d_gbxs,
+                         const subviewd_constsupers d_supers) const {
+  const auto ii = team_member.league_rank();
+  const auto supers = d_gbxs(ii).supersingbx.readonly(d_supers);
+  const size_t nsupers(supers.extent(0));
+  const auto is_number = (d_number.extent(0) > 0);
+  const auto is_mass = (d_mass.extent(0) > 0);
+  const auto row = d_global_gbxindex(ii) * nbins;
+
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, nsupers), [&, this](const size_t kk) {
+    const auto& drop(supers(kk));
+    const auto bb = radius_bin(drop.get_radius());
+    if (bb < nbins) {
+      if (is_number) {
+        Kokkos::atomic_add(&d_number(row + bb), static_cast<uint64_t>(drop.get_xi()));
+      }
+      if (is_mass) {
+        Kokkos::atomic_add(&d_mass(row + bb), static_cast<double>(drop.get_xi()) * drop.mass());
+      }
+    }
+  });
+}
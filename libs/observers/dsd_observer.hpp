@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: dsd_observer.hpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Observer to output the droplet size distribution in each gridbox, binned on device into
+ * logarithmically spaced radius bins, to 3-D arrays in a dataset at the start of each observation
+ * timestep.
+ */
+
+#ifndef LIBS_OBSERVERS_DSD_OBSERVER_HPP_
+#define LIBS_OBSERVERS_DSD_OBSERVER_HPP_
+
+#include <mpi.h>
+
+#include <Kokkos_Core.hpp>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../cleoconstants.hpp"
+#include "../kokkosaliases.hpp"
+#include "configuration/communicator.hpp"
+#include "gridboxes/gridbox.hpp"
+#include "gridboxes/gridboxmaps.hpp"
+#include "observers/consttstep_observer.hpp"
+#include "observers/observers.hpp"
+#include "superdrops/sdmmonitor.hpp"
+#include "superdrops/superdrop.hpp"
+#include "zarr/buffer.hpp"
+#include "zarr/xarray_zarr_array.hpp"
+#include "zarr/zarr_array.hpp"
+
+namespace KCS = KokkosCleoSettings;
+namespace dlc = dimless_constants;
+
+/**
+ * @brief Weighting(s) of the droplet size distribution output by the DSD observer.
+ *
+ * "number" sums the multiplicity (xi) of superdroplets in each bin and "mass" sums their total
+ * mass (xi * mass).
+ */
+enum class DSDWeighting : unsigned int { number = 1, mass = 2, number_and_mass = 3 };
+
+/**
+ * @brief Functor to bin the superdroplets of a gridbox into radius bins within a Kokkos team
+ * policy loop over gridboxes.
+ *
+ * Superdroplets are assigned to threads of a team and the bin of each superdroplet is calculated
+ * directly from its radius (bins are evenly spaced in log(radius)), so the cost of binning is
+ * independent of the number of bins. Histograms have a row for every gridbox of the whole domain
+ * and gridboxes are binned into the row of their global index.
+ */
+struct DSDFunc {
+  size_t nbins;                            /**< number of radius bins */
+  double logr0;                            /**< log of lower edge of smallest bin */
+  double inv_dlogr;                        /**< 1 / width of bins in log(radius) */
+  Kokkos::View<double*> d_edges;           /**< (dimensionless) radius bin edges on device */
+  Kokkos::View<size_t*> d_global_gbxindex; /**< global index of each local gridbox */
+  Kokkos::View<uint64_t*> d_number;        /**< [gbxindex, bin] number histogram */
+  Kokkos::View<double*> d_mass;            /**< [gbxindex, bin] mass histogram */
+
+  /**
+   * @brief Returns bin of (dimensionless) radius, or nbins if radius is outside range of bins.
+   */
+  KOKKOS_FUNCTION
+  size_t radius_bin(const double radius) const;
+
+  /**
+   * @brief Fill [gbxindex, bin] histograms of gridbox given by team member's league rank.
+   *
+   * @param team_member The Kokkos team member.
+   * @param d_gbxs The view of gridboxes on device.
+   * @param d_supers The view of superdroplets on device.
+   */
+  KOKKOS_FUNCTION
+  void operator()(const TeamMember& team_member, const viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers) const;
+};
+
+/**
+ * @class DoDSDObs
+ * @brief Template class for functionality to observe the droplet size distribution in each
+ * gridbox at the start of each timestep and write it to 3-D Zarr arrays in an Xarray dataset.
+ *
+ * The distribution is binned on device into nbins logarithmically spaced radius bins between rmin
+ * and rmax (superdroplets outside this range are not counted) and only the [time, gbxindex,
+ * radius_bins] histogram(s) are copied to host and written to the dataset. Also writes the
+ * geometric centre of each bin to a "radius_bins" coordinate array.
+ *
+ * With more than one MPI process each process bins its own gridboxes into the rows of their
+ * global index and the histograms of all processes are summed onto process 0 by MPI_Reduce, which
+ * alone writes them to the dataset. Dataset must therefore be a SimpleDataset because collecting
+ * data for a CollectiveDataset assumes the innermost dimension of an array is "gbxindex".
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store which dataset writes to.
+ */
+template <typename Dataset, typename Store>
+class DoDSDObs {
+ private:
+  Dataset& dataset; /**< dataset to write droplet size distribution to */
+  DSDFunc dsdfunc;  /**< functor to bin superdroplets in each gridbox */
+  std::shared_ptr<XarrayZarrArray<Store, uint64_t>> xzarr_number; /**< array for number dsd */
+  std::shared_ptr<XarrayZarrArray<Store, float>> xzarr_mass;      /**< array for mass dsd */
+  bool is_writer; /**< true if process writes to the dataset (i.e. process 0) */
+
+  /**
+   * @brief Returns nbins+1 (dimensionless) radius bin edges evenly spaced in log(radius).
+   *
+   * @param rmin Lower edge of smallest bin [m].
+   * @param rmax Upper edge of largest bin [m].
+   * @param nbins Number of radius bins.
+   */
+  static Kokkos::View<double*> create_bin_edges(const double rmin, const double rmax,
+                                                const size_t nbins) {
+    if (!(rmin > 0.0 && rmax > rmin && nbins > 0)) {
+      throw std::invalid_argument("DSD bins require 0 < rmin < rmax and nbins > 0");
+    }
+
+    auto d_edges = Kokkos::View<double*>("d_edges", nbins + 1);
+    auto h_edges = Kokkos::create_mirror_view(d_edges);
+    const auto logr0 = std::log(rmin / dlc::R0);
+    const auto dlogr = (std::log(rmax / dlc::R0) - logr0) / nbins;
+    for (size_t bb(0); bb < nbins + 1; ++bb) {
+      h_edges(bb) = std::exp(logr0 + bb * dlogr);
+    }
+    Kokkos::deep_copy(d_edges, h_edges);
+
+    return d_edges;
+  }
+
+  /**
+   * @brief Returns view on device of the global index of each gridbox of the local process.
+   *
+   * @param gbxmaps Maps of the gridboxes of the domain.
+   */
+  template <GridboxMaps GbxMaps>
+  static Kokkos::View<size_t*> create_global_gbxindexes(const GbxMaps& gbxmaps) {
+    const auto ngbxs = gbxmaps.get_local_ngridboxes_hostcopy();
+    auto d_global = Kokkos::View<size_t*>("d_global_gbxindex", ngbxs);
+    auto h_global = Kokkos::create_mirror_view(d_global);
+    for (size_t ii(0); ii < ngbxs; ++ii) {
+      h_global(ii) = gbxmaps.local_to_global_gridbox_index(ii);
+    }
+    Kokkos::deep_copy(d_global, h_global);
+
+    return d_global;
+  }
+
+  /**
+   * @brief Create and write "radius_bins" coordinate array with geometric centre of each bin.
+   */
+  void write_bin_centres() const {
+    auto xzarr = dataset.template create_coordinate_array<double>("radius_bins", "micro-m",
+                                                                  dlc::R0 * 1e6, dsdfunc.nbins,
+                                                                  dsdfunc.nbins);
+    const auto h_edges = Kokkos::create_mirror_view_and_copy(HostSpace(), dsdfunc.d_edges);
+    auto h_centres = Buffer<double>::viewh_buffer("h_centres", dsdfunc.nbins);
+    for (size_t bb(0); bb < dsdfunc.nbins; ++bb) {
+      h_centres(bb) = std::sqrt(h_edges(bb) * h_edges(bb + 1));
+    }
+    if (is_writer) {
+      dataset.write_to_array(xzarr, h_centres);
+      dataset.write_arrayshape(xzarr);
+    }
+  }
+
+  /**
+   * @brief Create 3-D [time, gbxindex, radius_bins] array for a droplet size distribution.
+   */
+  template <typename T>
+  std::shared_ptr<XarrayZarrArray<Store, T>> create_dsd_array(const std::string_view name,
+                                                              const std::string_view units,
+                                                              const double scale_factor,
+                                                              const size_t maxchunk,
+                                                              const size_t ngbxs) const {
+    const auto chunkshape = good3Dchunkshape(maxchunk, ngbxs, dsdfunc.nbins);
+    const auto dimnames = std::vector<std::string>{"time", "gbxindex", "radius_bins"};
+    return std::make_shared<XarrayZarrArray<Store, T>>(
+        dataset.template create_array<T>(name, units, scale_factor, chunkshape, dimnames));
+  }
+
+  /**
+   * @brief Copy histogram from device to host and, if there is more than one MPI process, sum
+   * the histograms of all processes onto process 0.
+   */
+  template <typename T>
+  Kokkos::View<T*, HostSpace> reduce_histogram(const Kokkos::View<T*> d_hist,
+                                               const MPI_Datatype datatype) const {
+    const auto h_hist = Kokkos::create_mirror_view_and_copy(HostSpace(), d_hist);
+    if (init_communicator::get_comm_size() == 1) {
+      return h_hist;
+    }
+
+    auto h_global = Kokkos::View<T*, HostSpace>("h_global", is_writer ? h_hist.extent(0) : 0);
+    MPI_Reduce(h_hist.data(), h_global.data(), static_cast<int>(h_hist.extent(0)), datatype,
+               MPI_SUM, 0, init_communicator::get_communicator());
+    return h_global;
+  }
+
+  /**
+   * @brief Bin superdroplets in every gridbox in parallel and then write histogram(s) to the
+   * array(s) in the dataset.
+   *
+   * @param d_gbxs View of gridboxes on device.
+   * @param d_supers View of superdrops on device.
+   */
+  void at_start_step(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    const size_t ngbxs(d_gbxs.extent(0));
+    const auto functor = dsdfunc;
+    Kokkos::deep_copy(functor.d_number, 0);
+    Kokkos::deep_copy(functor.d_mass, 0.0);
+    Kokkos::parallel_for(
+        "dsd_observer", TeamPolicy(ngbxs, KCS::team_size),
+        KOKKOS_LAMBDA(const TeamMember& team_member) { functor(team_member, d_gbxs, d_supers); });
+
+    if (xzarr_number) {
+      const auto h_number = reduce_histogram<uint64_t>(dsdfunc.d_number, MPI_UINT64_T);
+      if (is_writer) {
+        dataset.write_to_array(xzarr_number, h_number);
+      }
+    }
+    if (xzarr_mass) {
+      const auto h_mass = reduce_histogram<double>(dsdfunc.d_mass, MPI_DOUBLE);
+      if (is_writer) {
+        auto h_data = Buffer<float>::viewh_buffer("h_data", h_mass.extent(0));
+        for (size_t hh(0); hh < h_mass.extent(0); ++hh) {
+          h_data(hh) = static_cast<float>(h_mass(hh));  // conversion from double to float
+        }
+        dataset.write_to_array(xzarr_mass, h_data);
+      }
+    }
+  }
+
+ public:
+  /**
+   * @brief Constructor for DoDSDObs.
+   *
+   * @param dataset Dataset to write droplet size distribution to.
+   * @param store Store which dataset writes to.
+   * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+   * @param gbxmaps Maps of the gridboxes of the domain.
+   * @param rmin Lower edge of smallest radius bin [m].
+   * @param rmax Upper edge of largest radius bin [m].
+   * @param nbins Number of logarithmically spaced radius bins.
+   * @param weighting Whether to output number and/or mass distribution.
+   */
+  template <GridboxMaps GbxMaps>
+  DoDSDObs(Dataset& dataset, Store& store, const size_t maxchunk, const GbxMaps& gbxmaps,
+           const double rmin, const double rmax, const size_t nbins,
+           const DSDWeighting weighting)
+      : dataset(dataset),
+        dsdfunc{nbins,
+                std::log(rmin / dlc::R0),
+                nbins / (std::log(rmax / dlc::R0) - std::log(rmin / dlc::R0)),
+                create_bin_edges(rmin, rmax, nbins),
+                create_global_gbxindexes(gbxmaps),
+                Kokkos::View<uint64_t*>("d_number", 0),
+                Kokkos::View<double*>("d_mass", 0)},
+        xzarr_number(nullptr),
+        xzarr_mass(nullptr),
+        is_writer(init_communicator::get_comm_rank() == 0) {
+    const auto ngbxs = gbxmaps.get_total_global_ngridboxes();
+
+    write_bin_centres();
+
+    const auto wgt = static_cast<unsigned int>(weighting);
+    if (wgt & static_cast<unsigned int>(DSDWeighting::number)) {
+      Kokkos::realloc(dsdfunc.d_number, ngbxs * nbins);
+      xzarr_number = create_dsd_array<uint64_t>("dsd_number", "", 1, maxchunk, ngbxs);
+    }
+    if (wgt & static_cast<unsigned int>(DSDWeighting::mass)) {
+      Kokkos::realloc(dsdfunc.d_mass, ngbxs * nbins);
+      xzarr_mass = create_dsd_array<float>("dsd_mass", "g", dlc::MASS0grams, maxchunk, ngbxs);
+    }
+  }
+
+  /**
+   * @brief Destructor for DoDSDObs.
+   */
+  ~DoDSDObs() {
+    if (!is_writer) {
+      return;
+    }
+    if (xzarr_number) {
+      dataset.write_arrayshape(xzarr_number);
+    }
+    if (xzarr_mass) {
+      dataset.write_arrayshape(xzarr_mass);
+    }
+  }
+
+  /**
+   * @brief Placeholder for before timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void before_timestepping(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    std::cout << "observer includes droplet size distribution observer\n";
+  }
+
+  /**
+   * @brief Placeholder for after timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void after_timestepping() const {}
+
+  /**
+   * @brief Adapter to call at start step function which bins superdroplets and writes the
+   * droplet size distribution(s) to the arrays in the dataset.
+   *
+   * @param t_mdl Current model timestep.
+   * @param d_gbxs View of gridboxes on device.
+   * @param d_supers View of superdrops on device.
+   */
+  void at_start_step(const unsigned int t_mdl, const viewd_constgbx d_gbxs,
+                     const subviewd_constsupers d_supers) const {
+    at_start_step(d_gbxs, d_supers);
+  }
+
+  /**
+   * @brief Get null monitor for SDM processes from observer.
+   *
+   * @return monitor 'mo' of the observer that does nothing
+   */
+  SDMMonitor auto get_sdmmonitor() const { return NullSDMMonitor{}; }
+};
+
+/**
+ * @brief Constructs an observer which writes the droplet size distribution in each gridbox,
+ * binned into nbins logarithmically spaced radius bins between rmin and rmax, at the start of each
+ * observation timestep to 3-D arrays with a constant observation timestep "interval".
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store for dataset.
+ * @param interval Observation timestep.
+ * @param dataset Dataset to write data to.
+ * @param store Store which dataset writes to.
+ * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+ * @param gbxmaps Maps of the gridboxes of the domain.
+ * @param rmin Lower edge of smallest radius bin [m].
+ * @param rmax Upper edge of largest radius bin [m].
+ * @param nbins Number of radius bins.
+ * @param weighting Whether to output number and/or mass distribution.
+ * @return Constructed type satisfying observer concept.
+ */
+template <typename Dataset, typename Store, GridboxMaps GbxMaps>
+inline Observer auto DSDObserver(const unsigned int interval, Dataset& dataset, Store& store,
+                                 const size_t maxchunk, const GbxMaps& gbxmaps, const double rmin,
+                                 const double rmax, const size_t nbins,
+                                 const DSDWeighting weighting = DSDWeighting::number_and_mass) {
+  return ConstTstepObserver(interval, DoDSDObs<Dataset, Store>(dataset, store, maxchunk, gbxmaps,
+                                                               rmin, rmax, nbins, weighting));
+}
+
+#endif  // LIBS_OBSERVERS_DSD_OBSERVER_HPP_
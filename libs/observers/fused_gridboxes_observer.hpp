@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: fused_gridboxes_observer.hpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Observer to collect many variables from each gridbox (e.g. thermodynamics, wind velocities,
+ * number of superdroplets and mass moments) in a single parallel loop over gridboxes into a single
+ * pack of data which is then copied from device to host once per observation.
+ */
+
+#ifndef LIBS_OBSERVERS_FUSED_GRIDBOXES_OBSERVER_HPP_
+#define LIBS_OBSERVERS_FUSED_GRIDBOXES_OBSERVER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+
+#include "../kokkosaliases.hpp"
+#include "observers/collect_data_for_dataset.hpp"
+#include "observers/generic_collect_data.hpp"
+#include "observers/observers.hpp"
+#include "observers/parallel_write_data.hpp"
+#include "observers/write_to_dataset_observer.hpp"
+
+/**
+ * @brief Contiguous pack of data in host memory (and its mirror on device) which is sliced into
+ * the views used by (many) types satisfying the CollectDataForDataset concept to collect data, so
+ * that all their data can be copied from device to host with a single deep copy.
+ *
+ * Pack is made in two passes. First the views to pack are bound to the pack in order to sum the
+ * total size of the pack, then the pack is allocated and the views are bound again in the same
+ * order, this time being replaced by (unmanaged) slices of the pack. Slices are aligned to 8 bytes.
+ */
+class DataPack {
+ private:
+  using viewh_pack = Kokkos::View<uint64_t*, HostSpace>; /**< type of view of pack on host */
+  using mirrorviewd_pack = Kokkos::View<uint64_t*, HostSpace::array_layout, ExecSpace>;
+  /**< type of mirror view of pack on device */
+
+  viewh_pack h_pack;       /**< view of pack on host */
+  mirrorviewd_pack d_pack; /**< mirror view of pack on device */
+  size_t nwords;           /**< number of 8 byte words in pack (bound so far) */
+  bool is_allocated;       /**< true if pack has been allocated (i.e. is on second pass) */
+
+ public:
+  DataPack() : h_pack("h_pack", 0), d_pack("d_pack", 0), nwords(0), is_allocated(false) {}
+
+  /**
+   * @brief Allocates the pack with the size counted on the first pass of binding views and
+   * resets the count to start the second pass of binding.
+   */
+  void allocate() {
+    h_pack = viewh_pack("h_pack", nwords);
+    d_pack = Kokkos::create_mirror_view(ExecSpace(), h_pack);
+    nwords = 0;
+    is_allocated = true;
+  }
+
+  /**
+   * @brief Binds views for collecting data to the next slice of the pack.
+   *
+   * On the first pass increments the size of the pack by the size of the views. On the second
+   * pass (after allocation) replaces the views with unmanaged views of the slice of the pack.
+   *
+   * @tparam Store The type of the data store of the Xarray.
+   * @tparam T The type of the data.
+   * @param ptr Pointer to struct with Xarray and views to collect data for it.
+   */
+  template <typename Store, typename T>
+  void bind(std::shared_ptr<XarrayAndViews<Store, T>> ptr) {
+    using viewh_data = typename XarrayAndViews<Store, T>::viewh_data;
+    using mirrorviewd_data = typename XarrayAndViews<Store, T>::mirrorviewd_data;
+    static_assert(alignof(T) <= sizeof(uint64_t), "data type is over-aligned for pack");
+
+    const size_t size(ptr->h_data.extent(0));
+    const size_t offset = nwords;
+    nwords += (size * sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    if (is_allocated) {
+      ptr->h_data = viewh_data(reinterpret_cast<T*>(h_pack.data() + offset), size);
+      ptr->d_data = mirrorviewd_data(reinterpret_cast<T*>(d_pack.data() + offset), size);
+      ptr->is_packed = true;
+    }
+  }
+
+  /**
+   * @brief Deep copies the whole pack from device to host.
+   */
+  void copy_to_host() const { Kokkos::deep_copy(h_pack, d_pack); }
+};
+
+/**
+ * @brief Concept for types satisfying CollectDataForDataset which can also bind all their views
+ * for collecting data to a DataPack.
+ */
+template <typename CDD, typename Dataset>
+concept PackableCollectDataForDataset =
+    CollectDataForDataset<CDD, Dataset> && requires(CDD cdd, DataPack& pack) {
+      { cdd.pack_views(pack) } -> std::same_as<void>;
+    };
+
+/**
+ * @brief Struct for "ParallelWriteData" (see write_to_dataset_observer.hpp) to collect data from
+ * gridboxes in a single loop with a Kokkos team policy into a single pack of data and then write
+ * that data to arrays in a dataset.
+ *
+ * Equivalent to ParallelWriteGridboxes with a ParallelGridboxesTeamPolicyFunc, except the views
+ * of all the variables collected are slices of one DataPack, which is copied from device to host
+ * with one deep copy before the variables are written to their arrays. Variables usually
+ * collected in a range policy over gridboxes (e.g. thermodynamics) are collected by one
+ * member of each team.
+ *
+ * @tparam Dataset The type dataset used to write data to a store.
+ * @tparam CollectData Object satisfying the PackableCollectDataForDataset concept for the given
+ * dataset.
+ */
+template <typename Dataset, PackableCollectDataForDataset<Dataset> CollectData>
+class ParallelWriteFusedGridboxes {
+ private:
+  const Dataset& dataset;         /**< Dataset to write data to. */
+  CollectData collect_data;       /**< Object to collect data from gridboxes. */
+  std::shared_ptr<DataPack> pack; /**< Pack of data for all the variables */
+
+ public:
+  /**
+   * @brief Constructs a new ParallelWriteFusedGridboxes object and packs the views of
+   * collect_data into a single DataPack.
+   *
+   * @param dataset The dataset to write data to.
+   * @param collect_data The object satisfying the PackableCollectDataForDataset concept.
+   */
+  ParallelWriteFusedGridboxes(const Dataset& dataset, CollectData collect_data)
+      : dataset(dataset), collect_data(collect_data), pack(std::make_shared<DataPack>()) {
+    collect_data.pack_views(*pack);  // first pass to count size of pack
+    pack->allocate();
+    collect_data.pack_views(*pack);  // second pass to bind views to slices of pack
+  }
+
+  /**
+   * @brief Destructor for the ParallelWriteFusedGridboxes class.
+   */
+  ~ParallelWriteFusedGridboxes() { collect_data.write_arrayshapes(dataset); }
+
+  /**
+   * @brief Collects data from gridboxes in one parallel loop with a team policy, copies the pack
+   * of all that data to the host in one deep copy, and then writes each variable's slice of the
+   * pack to its array in the dataset.
+   *
+   * Kokkos::parallel_for([...]) is equivalent in serial to:
+   * for (size_t ii(0); ii < d_gbxs.extent(0); ++ii){[...]}.
+   *
+   * @param d_gbxs The view of gridboxes in device memory.
+   * @param d_supers The view of superdroplets in device memory.
+   */
+  void operator()(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    const auto functor = collect_data.get_functor(d_gbxs, d_supers);
+    ParallelGridboxesTeamPolicyFunc{}(functor, d_gbxs);
+    pack->copy_to_host();
+    collect_data.write_to_arrays(dataset);
+  }
+};
+
+/**
+ * @brief Constructs an observer to write many variables from gridboxes to arrays in a dataset at a
+ * constant time interval using a single team policy loop over the gridboxes and a single copy of
+ * the data from device to host.
+ *
+ * The variables are those collected by collect_data, e.g. a combination (see
+ * CombinedCollectDataForDataset) of thermodynamics, wind velocities, number of superdroplets
+ * and mass moments. Data written is identical to the data written by the equivalent separate
+ * observers of each variable.
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam CollectData Type satisfying the PackableCollectDataForDataset concept.
+ * @param interval Constant timestep interval.
+ * @param dataset Dataset to write data to.
+ * @param collect_data Object to collect data from gridboxes.
+ * @return Constructed observer.
+ */
+template <typename Dataset, PackableCollectDataForDataset<Dataset> CollectData>
+inline Observer auto FusedGridboxesObserver(const unsigned int interval, const Dataset& dataset,
+                                            CollectData collect_data) {
+  const auto parallel_write = ParallelWriteFusedGridboxes(dataset, collect_data);
+  return WriteToDatasetObserver(interval, parallel_write);
+}
+
+#endif  // LIBS_OBSERVERS_FUSED_GRIDBOXES_OBSERVER_HPP_
@@ -45,6 +45,7 @@ struct XarrayAndViews {
   XarrayZarrArray<Store, T> xzarr; /**< Xarray with Zarr backend to write h_data to */
   viewh_data h_data;               /**< view on host used to collect some data for the Xarray */
   mirrorviewd_data d_data;         /**< mirror view of h_data on device */
+  bool is_packed = false; /**< true if views are slices of a DataPack (see fused observer) */
 
   /**
    * @brief Constructs a new XarrayAndViews object.
@@ -105,6 +106,47 @@ class GenericCollectData {
      */
     KOKKOS_INLINE_FUNCTION
     void operator()(const size_t nn) const { ffunc(nn, d_gbxs, d_supers, d_data); }
+
+    /**
+     * @brief Adapter from signature of Kokkos::parallel_for with a team policy over gridboxes to
+     * call to FunctorFunc type for collecting data into d_data from one gridbox (i.e. for
+     * nn = league rank), e.g. so that data from gridboxes can be collected in the same loop as
+     * data which requires a team policy.
+     *
+     * @param team_member The Kokkos team member.
+     */
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const TeamMember& team_member) const {
+      const size_t nn = team_member.league_rank();
+      Kokkos::single(Kokkos::PerTeam(team_member), [&, this]() { (*this)(nn); });
+    }
+  };
+
+  /**
+   * @brief Generic wrapper to use FunctorFunc type to gather data from the superdroplets at the
+   * given indexes into a view in device memory during a Kokkos::parallel_for loop with a range
+   * policy, e.g. to collect data from only a sample of superdroplets without copying them.
+   *
+   * FunctorFunc must have an operator with signature
+   * operator()(nn, kk, d_gbxs, d_supers, d_data) which collects data from superdroplet kk into
+   * element nn of d_data.
+   */
+  struct GatherFunctor {
+    using mirrorviewd_data = XarrayAndViews<Store, T>::mirrorviewd_data;
+    FunctorFunc ffunc;             /**< functor to collect data into d_data during parallel loop */
+    viewd_constgbx d_gbxs;         /**< view of gridboxes on device */
+    subviewd_constsupers d_supers; /**< view of superdroplets on device */
+    viewd_constindexes d_indexes;  /**< indexes of superdroplets to collect data from */
+    mirrorviewd_data d_data;       /**< mirror view on device for data to collect */
+
+    /**
+     * @brief Adapter from signature of Kokkos::parallel_for with a range policy to call to
+     * FunctorFunc type for collecting data into d_data(nn) from superdroplet d_indexes(nn).
+     *
+     * @param nn The index of the data element.
+     */
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_t nn) const { ffunc(nn, d_indexes(nn), d_gbxs, d_supers, d_data); }
   };
 
   /* Constructor to initialize GenericCollectData given functor function-like object,
@@ -137,6 +179,20 @@ class GenericCollectData {
     return Functor(ffunc, d_gbxs, d_supers, ptr->d_data);
   }
 
+  /**
+   * @brief Returns the functor for gathering data from the superdroplets at the given indexes.
+   *
+   * @param d_gbxs The view of gridboxes on device.
+   * @param d_supers The view of superdroplets on device.
+   * @param d_indexes The indexes of the superdroplets (in d_supers) to collect data from.
+   * @return The functor object to use during a Kokkos:parallel_for range policy loop over indexes.
+   */
+  GatherFunctor get_gather_functor(const viewd_constgbx d_gbxs,
+                                   const subviewd_constsupers d_supers,
+                                   const viewd_constindexes d_indexes) const {
+    return GatherFunctor{ffunc, d_gbxs, d_supers, d_indexes, ptr->d_data};
+  }
+
   /**
    * @brief Reallocates the views with a new size.
    *
@@ -148,17 +204,30 @@ class GenericCollectData {
   void reallocate_views(const size_t size) const {
     Kokkos::realloc(ptr->h_data, size);
     Kokkos::realloc(ptr->d_data, size);
+    ptr->is_packed = false;
+  }
+
+  /**
+   * @brief Binds the views to slices of a pack of data (see DataPack).
+   *
+   * @param pack The pack of data.
+   */
+  template <typename Pack>
+  void pack_views(Pack& pack) const {
+    pack.bind(ptr);
   }
 
   /**
    * @brief Deep copies data for an array from the device view to the host and then writes it to an
-   * array in the dataset.
+   * array in the dataset. If the views are packed, the pack is assumed to have already been copied.
    *
    * @param dataset The dataset to write data to.
    */
   template <typename Dataset>
   void write_to_arrays(const Dataset& dataset) const {
-    Kokkos::deep_copy(ptr->h_data, ptr->d_data);
+    if (!ptr->is_packed) {
+      Kokkos::deep_copy(ptr->h_data, ptr->d_data);
+    }
     dataset.write_to_array(ptr->xzarr, ptr->h_data);
   }
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: load_imbalance_observer.hpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Observer to output the minimum, maximum and mean over all MPI processes of the number of
+ * superdroplets on each process, the volume of superdroplet data sent between processes and the
+ * time spent in MPI communication (since the previous observation) to arrays in a dataset at the
+ * start of each observation timestep.
+ */
+
+#ifndef LIBS_OBSERVERS_LOAD_IMBALANCE_OBSERVER_HPP_
+#define LIBS_OBSERVERS_LOAD_IMBALANCE_OBSERVER_HPP_
+
+#include <mpi.h>
+
+#include <Kokkos_Core.hpp>
+#include <array>
+#include <concepts>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../kokkosaliases.hpp"
+#include "configuration/communication_metrics.hpp"
+#include "configuration/communicator.hpp"
+#include "gridboxes/gridbox.hpp"
+#include "observers/consttstep_observer.hpp"
+#include "observers/observers.hpp"
+#include "superdrops/sdmmonitor.hpp"
+#include "zarr/xarray_zarr_array.hpp"
+
+/**
+ * @class DoLoadImbalanceObs
+ * @brief Template class for functionality to observe the load (im)balance between MPI processes
+ * at the start of each timestep and write the minimum, maximum and mean over all processes of
+ * each metric to Zarr arrays in an Xarray dataset.
+ *
+ * Metrics are: the number of superdroplets in each process's domain, the number of superdroplets
+ * and bytes of superdroplet data sent to other processes, and the time spent in MPI_Alltoall and
+ * blocked in MPI_Waitall whilst exchanging superdroplets and in MPI gathers for output data. All
+ * but the number of superdroplets are accumulated since the previous observation. For the
+ * CollectiveDataset only process 0 writes the reduced metrics.
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store which dataset writes to.
+ */
+template <typename Dataset, typename Store>
+class DoLoadImbalanceObs {
+ private:
+  static constexpr size_t nmetrics = 6;
+  static constexpr std::array<const char*, nmetrics> names = {
+      "rank_nsupers",       "rank_nsupers_sent", "rank_nbytes_sent",
+      "rank_alltoall_time", "rank_waitall_time", "rank_gather_time"};
+  static constexpr std::array<const char*, nmetrics> units = {"", "", "", "s", "s", "s"};
+  using xzarr_ptrs = std::array<std::shared_ptr<XarrayZarrArray<Store, double>>, nmetrics>;
+
+  Dataset& dataset;       /**< dataset to write load imbalance data to */
+  xzarr_ptrs xzarrs_min;  /**< pointers to arrays for minimum over processes of each metric */
+  xzarr_ptrs xzarrs_max;  /**< pointers to arrays for maximum over processes of each metric */
+  xzarr_ptrs xzarrs_mean; /**< pointers to arrays for mean over processes of each metric */
+
+  /**
+   * @brief Create array called "[name]_[stat]" for statistic of metric along time dimension.
+   */
+  std::shared_ptr<XarrayZarrArray<Store, double>> create_metric_array(
+      const size_t maxchunk, const size_t m, const std::string stat) const {
+    const auto name = std::string(names.at(m)) + "_" + stat;
+    return std::make_shared<XarrayZarrArray<Store, double>>(
+        dataset.template create_array<double>(name, units.at(m), 1, {maxchunk}, {"time"}));
+  }
+
+  /**
+   * @brief Returns this process's value of each metric.
+   *
+   * @param d_supers View of superdroplets in this process's domain.
+   */
+  std::array<double, nmetrics> local_metrics(const subviewd_constsupers d_supers) const {
+    return {static_cast<double>(d_supers.extent(0)),
+            static_cast<double>(communication_metrics::get_nsupers_sent()),
+            static_cast<double>(communication_metrics::get_nbytes_sent()),
+            communication_metrics::get_alltoall_time(),
+            communication_metrics::get_waitall_time(),
+            communication_metrics::get_gather_time()};
+  }
+
+  /**
+   * @brief Write out the minimum, maximum and mean over all processes of each metric to the
+   * arrays in the dataset, then reset the (process-local) communication metrics.
+   *
+   * @param d_supers View of superdroplets in this process's domain.
+   */
+  void at_start_step(const subviewd_constsupers d_supers) const {
+    const auto local = local_metrics(d_supers);
+    auto min = local;
+    auto max = local;
+    auto mean = local;
+
+    const auto comm_size = init_communicator::get_comm_size();
+    if (comm_size > 1) {
+      const auto comm = init_communicator::get_communicator();
+      MPI_Reduce(local.data(), min.data(), nmetrics, MPI_DOUBLE, MPI_MIN, 0, comm);
+      MPI_Reduce(local.data(), max.data(), nmetrics, MPI_DOUBLE, MPI_MAX, 0, comm);
+      MPI_Reduce(local.data(), mean.data(), nmetrics, MPI_DOUBLE, MPI_SUM, 0, comm);
+      for (auto& m : mean) {
+        m /= comm_size;
+      }
+    }
+
+    for (size_t m(0); m < nmetrics; ++m) {
+      dataset.write_to_array(xzarrs_min.at(m), min.at(m));
+      dataset.write_to_array(xzarrs_max.at(m), max.at(m));
+      dataset.write_to_array(xzarrs_mean.at(m), mean.at(m));
+    }
+
+    communication_metrics::reset();
+  }
+
+ public:
+  /**
+   * @brief Constructor for DoLoadImbalanceObs.
+   * @param dataset Dataset to write load imbalance data to.
+   * @param store Store which dataset writes to.
+   * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+   */
+  DoLoadImbalanceObs(Dataset& dataset, Store& store, const size_t maxchunk) : dataset(dataset) {
+    for (size_t m(0); m < nmetrics; ++m) {
+      xzarrs_min.at(m) = create_metric_array(maxchunk, m, "min");
+      xzarrs_max.at(m) = create_metric_array(maxchunk, m, "max");
+      xzarrs_mean.at(m) = create_metric_array(maxchunk, m, "mean");
+    }
+  }
+
+  /**
+   * @brief Destructor for DoLoadImbalanceObs.
+   */
+  ~DoLoadImbalanceObs() {
+    for (size_t m(0); m < nmetrics; ++m) {
+      dataset.write_arrayshape(xzarrs_min.at(m));
+      dataset.write_arrayshape(xzarrs_max.at(m));
+      dataset.write_arrayshape(xzarrs_mean.at(m));
+    }
+  }
+
+  /**
+   * @brief Before timestepping reset communication metrics so that they are only accumulated
+   * during timestepping.
+   */
+  void before_timestepping(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    std::cout << "observer includes load imbalance observer\n";
+    communication_metrics::reset();
+  }
+
+  /**
+   * @brief Placeholder for after timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void after_timestepping() const {}
+
+  /**
+   * @brief Adapter to call at start step function which writes the load imbalance metrics to the
+   * arrays in the dataset.
+   *
+   * @param t_mdl Current model timestep.
+   * @param d_gbxs View of gridboxes on device.
+   * @param d_supers View of superdrops on device.
+   */
+  void at_start_step(const unsigned int t_mdl, const viewd_constgbx d_gbxs,
+                     const subviewd_constsupers d_supers) const {
+    at_start_step(d_supers);
+  }
+
+  /**
+   * @brief Get null monitor for SDM processes from observer.
+   *
+   * @return monitor 'mo' of the observer that does nothing
+   */
+  SDMMonitor auto get_sdmmonitor() const { return NullSDMMonitor{}; }
+};
+
+/**
+ * @brief Constructs an observer which writes the minimum, maximum and mean over all MPI processes
+ * of the number of superdroplets, communication volume and time spent in MPI communication at
+ * start of each observation timestep to 1-D arrays with a constant observation timestep
+ * "interval".
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store for dataset.
+ * @param interval Observation timestep.
+ * @param dataset Dataset to write data to.
+ * @param store Store which dataset writes to.
+ * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+ * @return Constructed type satisfying observer concept.
+ */
+template <typename Dataset, typename Store>
+inline Observer auto LoadImbalanceObserver(const unsigned int interval, Dataset& dataset,
+                                           Store& store, const size_t maxchunk) {
+  return ConstTstepObserver(interval, DoLoadImbalanceObs<Dataset, Store>(dataset, store, maxchunk));
+}
+
+#endif  // LIBS_OBSERVERS_LOAD_IMBALANCE_OBSERVER_HPP_
@@ -204,7 +204,9 @@ struct CollectMassMoments {
   template <typename Dataset, typename T>
   void write_one_array(std::shared_ptr<XarrayAndViews<Store, T>> ptr,
                        const Dataset& dataset) const {
-    Kokkos::deep_copy(ptr->h_data, ptr->d_data);
+    if (!ptr->is_packed) {
+      Kokkos::deep_copy(ptr->h_data, ptr->d_data);
+    }
     dataset.write_to_array(ptr->xzarr, ptr->h_data);
   }
 
@@ -352,8 +354,77 @@ struct CollectMassMoments {
    * @param sz The size for reallocation of a view.
    */
   void reallocate_views(const size_t sz) const {}
+
+  /**
+   * @brief Binds the views for all three mass moments to slices of a pack of data (see DataPack).
+   *
+   * @param pack The pack of data.
+   */
+  template <typename Pack>
+  void pack_views(Pack& pack) const {
+    pack.bind(mom0_ptr);
+    pack.bind(mom1_ptr);
+    pack.bind(mom2_ptr);
+  }
 };
 
+/**
+ * @brief Constructs a type satisfying the CollectDataForDataset concept for collecting the mass
+ * moments of the droplet distribution in each gridbox within a Kokkos::parallel_for loop over
+ * gridboxes with a team policy.
+ *
+ * @tparam Dataset The type of dataset.
+ * @tparam Store The type of data store in the dataset.
+ * @param dataset Dataset to write data to.
+ * @param store The store the dataset writes to.
+ * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+ * @param ngbxs The number of gridboxes.
+ * @return CollectDataForDataset<Dataset> An instance of CollectDataForDataset for collecting
+ * mass moments of the droplet distribution.
+ */
+template <typename Dataset, typename Store>
+inline CollectDataForDataset<Dataset> auto CollectDropletMassMoments(const Dataset& dataset,
+                                                                     Store& store,
+                                                                     const size_t maxchunk,
+                                                                     const size_t ngbxs) {
+  const auto xzarr_mom0 = create_massmom0_xarray(dataset, store, "massmom0", maxchunk, ngbxs);
+  const auto xzarr_mom1 = create_massmom1_xarray(dataset, store, "massmom1", maxchunk, ngbxs);
+  const auto xzarr_mom2 = create_massmom2_xarray(dataset, store, "massmom2", maxchunk, ngbxs);
+
+  const auto ffunc = MassMomentsFunc{};
+  return CollectMassMoments(ffunc, xzarr_mom0, xzarr_mom1, xzarr_mom2, ngbxs);
+}
+
+/**
+ * @brief Constructs a type satisfying the CollectDataForDataset concept for collecting the mass
+ * moments of the rain-droplet distribution in each gridbox within a Kokkos::parallel_for loop over
+ * gridboxes with a team policy.
+ *
+ * @tparam Dataset The type of dataset.
+ * @tparam Store The type of data store in the dataset.
+ * @param dataset Dataset to write data to.
+ * @param store The store the dataset writes to.
+ * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+ * @param ngbxs The number of gridboxes.
+ * @return CollectDataForDataset<Dataset> An instance of CollectDataForDataset for collecting
+ * mass moments of the rain-droplet distribution.
+ */
+template <typename Dataset, typename Store>
+inline CollectDataForDataset<Dataset> auto CollectRaindropMassMoments(const Dataset& dataset,
+                                                                      Store& store,
+                                                                      const size_t maxchunk,
+                                                                      const size_t ngbxs) {
+  const auto xzarr_mom0 =
+      create_massmom0_xarray(dataset, store, "massmom0_raindrops", maxchunk, ngbxs);
+  const auto xzarr_mom1 =
+      create_massmom1_xarray(dataset, store, "massmom1_raindrops", maxchunk, ngbxs);
+  const auto xzarr_mom2 =
+      create_massmom2_xarray(dataset, store, "massmom2_raindrops", maxchunk, ngbxs);
+
+  const auto ffunc = RaindropsMassMomentsFunc{};
+  return CollectMassMoments(ffunc, xzarr_mom0, xzarr_mom1, xzarr_mom2, ngbxs);
+}
+
 /**
  * @brief Constructs an observer which writes mass moments of droplet distribution at start of
  * each observation timestep to an array with a constant observation timestep "interval".
@@ -371,14 +442,8 @@ struct CollectMassMoments {
 template <typename Dataset, typename Store>
 inline Observer auto MassMomentsObserver(const unsigned int interval, const Dataset& dataset,
                                          Store& store, const size_t maxchunk, const size_t ngbxs) {
-  const auto xzarr_mom0 = create_massmom0_xarray(dataset, store, "massmom0", maxchunk, ngbxs);
-  const auto xzarr_mom1 = create_massmom1_xarray(dataset, store, "massmom1", maxchunk, ngbxs);
-  const auto xzarr_mom2 = create_massmom2_xarray(dataset, store, "massmom2", maxchunk, ngbxs);
-
-  const auto ffunc = MassMomentsFunc{};
-
   const CollectDataForDataset<Dataset> auto massmoments =
-      CollectMassMoments(ffunc, xzarr_mom0, xzarr_mom1, xzarr_mom2, ngbxs);
+      CollectDropletMassMoments(dataset, store, maxchunk, ngbxs);
   const auto parallel_write =
       ParallelWriteGridboxes(ParallelGridboxesTeamPolicyFunc{}, dataset, massmoments);
   return WriteToDatasetObserver(interval, parallel_write);
@@ -402,17 +467,8 @@ template <typename Dataset, typename Store>
 inline Observer auto MassMomentsRaindropsObserver(const unsigned int interval,
                                                   const Dataset& dataset, Store& store,
                                                   const size_t maxchunk, const size_t ngbxs) {
-  const auto xzarr_mom0 =
-      create_massmom0_xarray(dataset, store, "massmom0_raindrops", maxchunk, ngbxs);
-  const auto xzarr_mom1 =
-      create_massmom1_xarray(dataset, store, "massmom1_raindrops", maxchunk, ngbxs);
-  const auto xzarr_mom2 =
-      create_massmom2_xarray(dataset, store, "massmom2_raindrops", maxchunk, ngbxs);
-
-  const auto ffunc = RaindropsMassMomentsFunc{};
-
   const CollectDataForDataset<Dataset> auto massmoments_raindrops =
-      CollectMassMoments(ffunc, xzarr_mom0, xzarr_mom1, xzarr_mom2, ngbxs);
+      CollectRaindropMassMoments(dataset, store, maxchunk, ngbxs);
   const auto parallel_write =
       ParallelWriteGridboxes(ParallelGridboxesTeamPolicyFunc{}, dataset, massmoments_raindrops);
   return WriteToDatasetObserver(interval, parallel_write);
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: optional_observer.hpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Observer which is only created (and therefore only creates its arrays in a dataset) if it is
+ * enabled at runtime, e.g. by a configuration file, but whose type is the same whether or not it
+ * is enabled so that it can be combined with other observers.
+ */
+
+#ifndef LIBS_OBSERVERS_OPTIONAL_OBSERVER_HPP_
+#define LIBS_OBSERVERS_OPTIONAL_OBSERVER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../cleoconstants.hpp"
+#include "../kokkosaliases.hpp"
+#include "observers/observers.hpp"
+#include "superdrops/sdmmonitor.hpp"
+
+/**
+ * @brief Structure OptionalSDMMonitor is the monitor of an OptionalObserver which only calls the
+ * functions of its monitor if the observer is enabled.
+ *
+ * @tparam SDMMo Type satisfying the SDMMonitor concept.
+ */
+template <SDMMonitor SDMMo>
+struct OptionalSDMMonitor {
+ private:
+  SDMMo mo;        /**< Monitor of observer (not used if is_enabled = false) */
+  bool is_enabled; /**< true if the observer is enabled */
+
+ public:
+  /**
+   * @brief Construct a new OptionalSDMMonitor object.
+   *
+   * @param mo Monitor of observer.
+   * @param is_enabled True if the observer is enabled.
+   */
+  OptionalSDMMonitor(const SDMMo mo, const bool is_enabled) : mo(mo), is_enabled(is_enabled) {}
+
+  void reset_monitor() const {
+    if (is_enabled) {
+      mo.reset_monitor();
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void before_timestepping(const TeamMember& tm, const viewd_constsupers supers) const {
+    if (is_enabled) {
+      mo.before_timestepping(tm, supers);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void monitor_condensation(const TeamMember& tm, const double d) const {
+    if (is_enabled) {
+      mo.monitor_condensation(tm, d);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void monitor_condensation_solver(const TeamMember& tm, const uint64_t niters,
+                                   const uint64_t nsubsteps) const {
+    if (is_enabled) {
+      mo.monitor_condensation_solver(tm, niters, nsubsteps);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void monitor_collisions(const TeamMember& tm, const uint64_t ncolls, const uint64_t ncoals,
+                          const uint64_t nbreakups, const uint64_t nnulls) const {
+    if (is_enabled) {
+      mo.monitor_collisions(tm, ncolls, ncoals, nbreakups, nnulls);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void monitor_microphysics(const TeamMember& tm, const viewd_constsupers supers) const {
+    if (is_enabled) {
+      mo.monitor_microphysics(tm, supers);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void monitor_motion(const TeamMember& tm, const viewd_constsupers supers) const {
+    if (is_enabled) {
+      mo.monitor_motion(tm, supers);
+    }
+  }
+
+  void monitor_motion_substeps(const unsigned int nsubsteps) const {
+    if (is_enabled) {
+      mo.monitor_motion_substeps(nsubsteps);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void monitor_precipitation(const TeamMember& tm, const double d) const {
+    if (is_enabled) {
+      mo.monitor_precipitation(tm, d);
+    }
+  }
+};
+
+/**
+ * @brief Observer which behaves like the observer of type Obs if it is enabled and otherwise
+ * does nothing at all (like a NullObserver).
+ *
+ * The observer of type Obs is only created if it is enabled, so a disabled observer creates no
+ * arrays in a dataset. Copies of an OptionalObserver share the same observer.
+ *
+ * @tparam Obs Type satisfying the Observer concept.
+ */
+template <Observer Obs>
+class OptionalObserver {
+ private:
+  using SDMMo = decltype(std::declval<const Obs>().get_sdmmonitor());
+  std::shared_ptr<const Obs> obs; /**< observer, or nullptr if observer is disabled */
+  SDMMo mo;                       /**< monitor of observer (not used if observer is disabled) */
+
+ public:
+  /**
+   * @brief Construct a new OptionalObserver object.
+   *
+   * @param obs Pointer to observer, or nullptr if observer is disabled.
+   * @param disabled_mo Monitor (of the same type as the observer's) to use if observer is disabled.
+   */
+  OptionalObserver(const std::shared_ptr<const Obs> obs, const SDMMo disabled_mo)
+      : obs(obs), mo(obs ? obs->get_sdmmonitor() : disabled_mo) {}
+
+  void before_timestepping(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    if (obs) {
+      obs->before_timestepping(d_gbxs, d_supers);
+    }
+  }
+
+  void after_timestepping() const {
+    if (obs) {
+      obs->after_timestepping();
+    }
+  }
+
+  unsigned int next_obs(const unsigned int t_mdl) const {
+    return obs ? obs->next_obs(t_mdl) : LIMITVALUES::uintmax;
+  }
+
+  bool on_step(const unsigned int t_mdl) const { return obs ? obs->on_step(t_mdl) : false; }
+
+  void at_start_step(const unsigned int t_mdl, const viewd_constgbx d_gbxs,
+                     const subviewd_constsupers d_supers) const {
+    if (obs) {
+      obs->at_start_step(t_mdl, d_gbxs, d_supers);
+    }
+  }
+
+  /**
+   * @brief Get monitor for SDM processes from observer which does nothing if observer is
+   * disabled.
+   *
+   * @return monitor of the observer
+   */
+  SDMMonitor auto get_sdmmonitor() const { return OptionalSDMMonitor(mo, obs != nullptr); }
+};
+
+/**
+ * @brief Constructs an observer which is created by create_observer if is_enabled is true and
+ * which otherwise does nothing (and so e.g. creates no arrays in a dataset).
+ *
+ * @tparam CreateObserver Type of function which takes no arguments and returns an Observer.
+ * @param is_enabled True if the observer should be created.
+ * @param create_observer Function to create the observer.
+ * @param disabled_mo Monitor (of the same type as the observer's) to use if observer is disabled,
+ * e.g. NullSDMMonitor{} (default) for observers which do not monitor SDM processes.
+ * @return Constructed type satisfying observer concept.
+ */
+template <typename CreateObserver, typename Obs = std::invoke_result_t<CreateObserver>,
+          SDMMonitor SDMMo = NullSDMMonitor>
+  requires Observer<Obs>
+inline Observer auto optional_observer(const bool is_enabled, CreateObserver create_observer,
+                                       const SDMMo disabled_mo = NullSDMMonitor{}) {
+  const auto obs = is_enabled ? std::make_shared<const Obs>(create_observer()) : nullptr;
+  return OptionalObserver<Obs>(obs, disabled_mo);
+}
+
+#endif  // LIBS_OBSERVERS_OPTIONAL_OBSERVER_HPP_
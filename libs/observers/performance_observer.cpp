@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: performance_observer.cpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functionality of struct which satisfies observer type and records the wall-clock time spent
+ * in each of CLEO's Kokkos profiling regions at fixed 'interval' timesteps.
+ */
+
+#include "observers/performance_observer.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "configuration/communicator.hpp"
+
+namespace {
+/* record which receives callbacks from Kokkos Tools' push/pop region (nullptr if none) */
+PerformanceRecord* recording = nullptr;
+
+/* push/pop region callbacks set before recording started, e.g. by a Kokkos tools library */
+Kokkos::Tools::Experimental::PushRegionFunction previous_push_region = nullptr;
+Kokkos::Tools::Experimental::PopRegionFunction previous_pop_region = nullptr;
+
+void push_region_callback(const char* name) {
+  recording->push_region(name);
+  if (previous_push_region) {
+    previous_push_region(name);
+  }
+}
+
+void pop_region_callback() {
+  recording->pop_region();
+  if (previous_pop_region) {
+    previous_pop_region();
+  }
+}
+}  // namespace
+
+/**
+ * @brief Constructor for PerformanceRecord.
+ *
+ * If there is more than one MPI process, "_rank[X]" is appended to the stem of the filename
+ * for output so that each process writes its own timings.
+ *
+ * @param filename Name of file for output (extension is replaced by .csv and .json).
+ * @param do_fence If true, Kokkos is fenced at the start and end of each region.
+ */
+PerformanceRecord::PerformanceRecord(const std::filesystem::path filename, const bool do_fence)
+    : filename(filename), do_fence(do_fence), tstart(clock::now()) {
+  if (init_communicator::get_comm_size() > 1) {
+    const auto rank = std::to_string(init_communicator::get_comm_rank());
+    this->filename.replace_filename(filename.stem().string() + "_rank" + rank);
+  }
+}
+
+/**
+ * @brief Destructor for PerformanceRecord stops recording (if it is recording).
+ */
+PerformanceRecord::~PerformanceRecord() { stop_recording(); }
+
+/**
+ * @brief Start recording timings of regions by setting Kokkos Tools' push and pop region
+ * callbacks to those of this PerformanceRecord.
+ *
+ * Any previous push and pop region callbacks are saved and still called whilst recording.
+ * Throws an error if another PerformanceRecord is already recording.
+ */
+void PerformanceRecord::start_recording() {
+  if (recording && recording != this) {
+    throw std::runtime_error("cannot record performance with more than one PerformanceObserver");
+  }
+
+  if (!recording) {
+    const auto callbacks = Kokkos::Tools::Experimental::get_callbacks();
+    previous_push_region = callbacks.push_region;
+    previous_pop_region = callbacks.pop_region;
+    recording = this;
+    Kokkos::Tools::Experimental::set_push_region_callback(push_region_callback);
+    Kokkos::Tools::Experimental::set_pop_region_callback(pop_region_callback);
+  }
+  tstart = clock::now();
+}
+
+/**
+ * @brief Stop recording timings of regions by restoring Kokkos Tools' push and pop region
+ * callbacks to those from before recording started.
+ */
+void PerformanceRecord::stop_recording() {
+  if (recording == this) {
+    Kokkos::Tools::Experimental::set_push_region_callback(previous_push_region);
+    Kokkos::Tools::Experimental::set_pop_region_callback(previous_pop_region);
+    previous_push_region = nullptr;
+    previous_pop_region = nullptr;
+    recording = nullptr;
+  }
+}
+
+/**
+ * @brief Start timing a region called "name".
+ *
+ * @param name Name of region entered.
+ */
+void PerformanceRecord::push_region(const char* name) {
+  if (do_fence) {
+    Kokkos::fence("performance_observer_push_region");
+  }
+
+  const auto key = std::string(name);
+  if (!timings.contains(key)) {
+    names.push_back(key);
+    timings.insert({key, RegionTiming{}});
+  }
+  open_regions.push_back({key, clock::now()});
+}
+
+/**
+ * @brief Stop timing the most recently entered region and add the time spent in that region
+ * to its cumulative total.
+ *
+ * Regions entered before recording started (i.e. with no corresponding push) are ignored.
+ */
+void PerformanceRecord::pop_region() {
+  if (open_regions.empty()) {
+    return;
+  }
+
+  if (do_fence) {
+    Kokkos::fence("performance_observer_pop_region");
+  }
+
+  const auto& [key, tpush] = open_regions.back();
+  auto& timing = timings.at(key);
+  timing.seconds += std::chrono::duration<double>(clock::now() - tpush).count();
+  ++timing.ncalls;
+  open_regions.pop_back();
+}
+
+/**
+ * @brief Observe cumulative time spent in each region so far (and other data).
+ *
+ * @param time Current model time [s].
+ * @param totnsupers Number of superdroplets in the domain.
+ * @param ngbxs Number of gridboxes in the domain.
+ * @param nbytes_written Total number of bytes written so far.
+ */
+void PerformanceRecord::observe(const double time, const size_t totnsupers, const size_t ngbxs,
+                                const size_t nbytes_written) {
+  auto obs = Observation{time,
+                         std::chrono::duration<double>(clock::now() - tstart).count(),
+                         totnsupers,
+                         ngbxs,
+                         nbytes_written,
+                         {}};
+  for (const auto& [key, timing] : timings) {
+    obs.totals.insert({key, timing.seconds});
+  }
+  observations.push_back(obs);
+}
+
+/**
+ * @brief Write timings of each observation to a CSV table and a summary of the total time spent
+ * in each region to a JSON file.
+ */
+void PerformanceRecord::write_timings() const {
+  auto csvfile = filename;
+  auto jsonfile = filename;
+  write_csv(csvfile.replace_extension(".csv"));
+  write_json(jsonfile.replace_extension(".json"));
+}
+
+/**
+ * @brief Write table with one row per observation and columns for the model time, wall-clock
+ * time, number of superdroplets, number of gridboxes, bytes written and cumulative time spent
+ * in each region.
+ *
+ * @param csvfile Name of CSV file to write to.
+ */
+void PerformanceRecord::write_csv(const std::filesystem::path csvfile) const {
+  std::ofstream out(csvfile);
+  if (!out.good()) {
+    std::cout << "can't write performance timings to " << csvfile << "\n";
+    return;
+  }
+
+  out << "time,walltime,totnsupers,ngbxs,nbytes_written";
+  for (const auto& key : names) {
+    out << "," << key;
+  }
+  out << "\n";
+
+  out << std::setprecision(9);
+  for (const auto& obs : observations) {
+    out << obs.time << "," << obs.walltime << "," << obs.totnsupers << "," << obs.ngbxs << ","
+        << obs.nbytes_written;
+    for (const auto& key : names) {
+      out << "," << (obs.totals.contains(key) ? obs.totals.at(key) : 0.0);
+    }
+    out << "\n";
+  }
+
+  std::cout << "performance timings written to " << csvfile << "\n";
+}
+
+/**
+ * @brief Write summary of total wall-clock time, number of calls and mean time per call for
+ * each region to a JSON file.
+ *
+ * @param jsonfile Name of JSON file to write to.
+ */
+void PerformanceRecord::write_json(const std::filesystem::path jsonfile) const {
+  std::ofstream out(jsonfile);
+  if (!out.good()) {
+    std::cout << "can't write performance summary to " << jsonfile << "\n";
+    return;
+  }
+
+  const auto walltime = std::chrono::duration<double>(clock::now() - tstart).count();
+  const auto nbytes_written = observations.empty() ? size_t{0} : observations.back().nbytes_written;
+
+  out << std::setprecision(9);
+  out << "{\n  \"walltime\": " << walltime << ",\n  \"nobservations\": " << observations.size()
+      << ",\n  \"nbytes_written\": " << nbytes_written << ",\n  \"regions\": {";
+  for (size_t i = 0; i < names.size(); ++i) {
+    const auto& timing = timings.at(names.at(i));
+    const auto mean = timing.ncalls ? timing.seconds / timing.ncalls : 0.0;
+    out << (i ? ",\n" : "\n") << "    \"" << names.at(i) << "\": {\"seconds\": " << timing.seconds
+        << ", \"ncalls\": " << timing.ncalls << ", \"mean\": " << mean << "}";
+  }
+  out << "\n  }\n}\n";
+
+  std::cout << "performance summary written to " << jsonfile << "\n";
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: performance_observer.hpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Struct satisfies observer type and records the wall-clock time spent in each of CLEO's
+ * Kokkos profiling regions (e.g. SDM stages, coupling steps and observation steps), together
+ * with the number of superdroplets and bytes written at fixed 'interval' timesteps. Timings
+ * are written to a CSV table and a JSON summary after timestepping.
+ */
+
+#ifndef LIBS_OBSERVERS_PERFORMANCE_OBSERVER_HPP_
+#define LIBS_OBSERVERS_PERFORMANCE_OBSERVER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <chrono>
+#include <concepts>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../kokkosaliases.hpp"
+#include "superdrops/sdmmonitor.hpp"
+
+/**
+ * @brief Class to record wall-clock time spent in named (Kokkos profiling) regions and to
+ * write timings observed at certain times to a CSV table and JSON summary.
+ *
+ * Timing of regions uses Kokkos Tools' push/pop region callbacks, so regions created with
+ * Kokkos::Profiling::ScopedRegion or Kokkos::Profiling::push/popRegion are timed without the
+ * need for an external "KOKKOS_TOOLS_LIBS" library. Only one PerformanceRecord can be recording at
+ * once. Push/pop region callbacks of a loaded Kokkos tools library are still called whilst
+ * recording and are restored when recording stops (or the recording PerformanceRecord is
+ * destroyed).
+ */
+class PerformanceRecord {
+ private:
+  using clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Cumulative time spent in a region and number of times region was entered.
+   */
+  struct RegionTiming {
+    double seconds = 0.0; /**< total wall-clock time spent in region [s] */
+    size_t ncalls = 0;    /**< number of times region has been entered */
+  };
+
+  /**
+   * @brief Observation of cumulative timings (and other data) at a particular model time.
+   */
+  struct Observation {
+    double time;                                    /**< model time of observation [s] */
+    double walltime;                                /**< wall-clock time since start [s] */
+    size_t totnsupers;                              /**< no. superdroplets in domain */
+    size_t ngbxs;                                   /**< no. gridboxes in domain */
+    size_t nbytes_written;                          /**< total no. bytes written to store */
+    std::unordered_map<std::string, double> totals; /**< cumulative seconds in each region */
+  };
+
+  std::filesystem::path filename;  /**< filename for output (extension replaced by .csv/.json) */
+  bool do_fence;                   /**< true = fence Kokkos at start and end of each region */
+  clock::time_point tstart;        /**< wall-clock time when recording started */
+  std::vector<std::string> names;  /**< names of regions in order of first occurrence */
+  std::unordered_map<std::string, RegionTiming> timings; /**< timings for each region */
+  std::vector<std::pair<std::string, clock::time_point>> open_regions; /**< stack of regions */
+  std::vector<Observation> observations; /**< timings (and other data) at each observation */
+
+  void write_csv(const std::filesystem::path csvfile) const;
+
+  void write_json(const std::filesystem::path jsonfile) const;
+
+ public:
+  /**
+   * @brief Constructor for PerformanceRecord.
+   *
+   * @param filename Name of file for output (extension is replaced by .csv and .json). If there
+   * is more than one MPI process, the process's rank is appended to the filename.
+   * @param do_fence If true, Kokkos is fenced at the start and end of each region so that time
+   * includes (asynchronous) device kernels launched within region.
+   */
+  PerformanceRecord(const std::filesystem::path filename, const bool do_fence);
+
+  ~PerformanceRecord();
+
+  void start_recording();
+
+  void stop_recording();
+
+  void push_region(const char* name);
+
+  void pop_region();
+
+  void observe(const double time, const size_t totnsupers, const size_t ngbxs,
+               const size_t nbytes_written);
+
+  void write_timings() const;
+};
+
+/**
+ * @struct PerformanceObserver
+ * @brief Struct that satisfies the observer concept and records wall-clock time spent in
+ * CLEO's profiling regions (e.g. per SDM stage, coupling step and observation step) along with
+ * the total number of superdroplets and number of bytes written at every observation at fixed
+ * 'interval' timesteps. Timings are written to a CSV and JSON file after timestepping.
+ *
+ * Copies of the observer share the same record of timings.
+ */
+struct PerformanceObserver {
+ private:
+  unsigned int interval; /**< Timestep between observations. */
+  std::function<double(unsigned int)>
+      step2realtime; /**< Function to convert model timesteps to real time. */
+  std::function<size_t()>
+      nbytes_written; /**< Function returning total number of bytes written (e.g. to a store) */
+  std::shared_ptr<PerformanceRecord> record; /**< Record of timings (shared between copies). */
+
+ public:
+  /**
+   * @brief Constructor for PerformanceObserver.
+   *
+   * @param obsstep Interval in model timesteps between observation events.
+   * @param step2realtime Function to convert model timesteps to real time.
+   * @param filename Name of file for output (extension is replaced by .csv and .json).
+   * @param nbytes_written Function returning total number of bytes written so far,
+   * e.g. `[&store]() { return store.get_nbytes_written(); }`.
+   * @param do_fence If true, Kokkos is fenced at the start and end of each profiling region.
+   */
+  PerformanceObserver(
+      const unsigned int obsstep, const std::function<double(unsigned int)> step2realtime,
+      const std::filesystem::path filename,
+      const std::function<size_t()> nbytes_written = []() { return size_t{0}; },
+      const bool do_fence = true)
+      : interval(obsstep),
+        step2realtime(step2realtime),
+        nbytes_written(nbytes_written),
+        record(std::make_shared<PerformanceRecord>(filename, do_fence)) {}
+
+  /**
+   * @brief Function called before timestepping starts recording timings of profiling regions.
+   * @param d_gbxs View of grid boxes.
+   * @param d_supers View of superdrops.
+   */
+  void before_timestepping(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    std::cout << "observer includes PerformanceObserver\n";
+    record->start_recording();
+  }
+
+  /**
+   * @brief Function called after timestepping stops recording timings and writes them to files.
+   */
+  void after_timestepping() const {
+    record->stop_recording();
+    record->write_timings();
+  }
+
+  /**
+   * @brief Determine the next observation time.
+   *
+   * Calculates the next observation time based on the current model time and this observer's
+   * constant timestep between observations, 'interval'.
+   *
+   * @param t_mdl The unsigned int parameter representing the current model timestep.
+   * @return Unsigned int for the next observation timestep.
+   */
+  unsigned int next_obs(const unsigned int t_mdl) const {
+    return ((t_mdl / interval) + 1) * interval;
+  }
+
+  /**
+   * @brief Check if observer is "on step".
+   *
+   * Checks if the current model time is on an observation timestep.
+   *
+   * @param t_mdl The unsigned int parameter representing the current model timestep.
+   * @return True if the current timestep is an observation timestep, false otherwise.
+   */
+  bool on_step(const unsigned int t_mdl) const { return t_mdl % interval == 0; }
+
+  /**
+   * @brief Observe cumulative timings at the start of each timestep.
+   *
+   * If timestep is on observation step, record cumulative time spent in each profiling region so
+   * far, along with the number of superdroplets and gridboxes and the number of bytes written.
+   *
+   * @param t_mdl Current model time.
+   * @param d_gbxs View of grid boxes.
+   * @param d_supers View of superdrops.
+   */
+  void at_start_step(const unsigned int t_mdl, const viewd_constgbx d_gbxs,
+                     const subviewd_constsupers d_supers) const {
+    if (on_step(t_mdl)) {
+      record->observe(step2realtime(t_mdl), d_supers.extent(0), d_gbxs.extent(0),
+                      nbytes_written());
+    }
+  }
+
+  /**
+   * @brief Get null monitor for SDM processes from observer.
+   *
+   * @return monitor 'mo' of the observer that does nothing
+   */
+  SDMMonitor auto get_sdmmonitor() const { return NullSDMMonitor{}; }
+};
+
+#endif  // LIBS_OBSERVERS_PERFORMANCE_OBSERVER_HPP_
@@ -22,10 +22,10 @@
 
 #include <Kokkos_Core.hpp>
 #include <concepts>
+#include <cstdint>
 #include <memory>
 
 #include "../../kokkosaliases.hpp"
-#include "gridboxes/gridboxmaps.hpp"
 #include "observers/consttstep_observer.hpp"
 #include "observers/observers.hpp"
 #include "observers/sdmmonitor/do_sdmmonitor_obs.hpp"
@@ -66,6 +66,31 @@ struct MonitorCondensation {
   KOKKOS_FUNCTION
   void monitor_condensation(const TeamMember& team_member, const double totmass_condensed) const;
 
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param niters Number of Newton Raphson iterations of condensation ODE solver in one gridbox
+   * @param nsubsteps Number of (sub-)timesteps of condensation ODE solver in one gridbox
+   */
+  KOKKOS_FUNCTION
+  void monitor_condensation_solver(const TeamMember& team_member, const uint64_t niters,
+                                   const uint64_t nsubsteps) const {}
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param ncolls Number of collision events in one gridbox
+   * @param ncoals Number of collision events which resulted in coalescence
+   * @param nbreakups Number of collision events which resulted in breakup
+   * @param nnulls Number of null superdroplets produced by collisions
+   */
+  KOKKOS_FUNCTION
+  void monitor_collisions(const TeamMember& team_member, const uint64_t ncolls,
+                          const uint64_t ncoals, const uint64_t nbreakups,
+                          const uint64_t nnulls) const {}
+
   /**
    * @brief Placeholder function to obey SDMMonitor concept does nothing.
    *
@@ -78,22 +103,28 @@ struct MonitorCondensation {
   /**
    * @brief Placeholder function to obey SDMMonitor concept does nothing.
    *
-   * @param d_gbxs The view of gridboxes in device memory.
-   * @param domainsupers The view of superdroplets within the domain in device memory.
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param supers (sub)View of all the superdrops in one gridbox after one motion step
+   */
+  KOKKOS_FUNCTION
+  void monitor_motion(const TeamMember& team_member, const viewd_constsupers supers) const {}
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param nsubsteps Number of sub-steps of superdroplet motion step.
    */
-  void monitor_motion(const viewd_constgbx d_gbxs, const subviewd_constsupers domainsupers) const {}
+  void monitor_motion_substeps(const unsigned int nsubsteps) const {}
 
   /**
    * @brief Placeholder function to obey SDMMonitor concept does nothing.
    *
    * @param team_member Kokkos team member in TeamPolicy parallel loop over gridboxes.
-   * @param gbxindex Gridbox whose bottom boundary is to be evaluated.
-   * @param gbxmaps The Gridbox Maps.
-   * @param drop The super-droplet to evaluate.
+   * @param totprecip Precipitation through the bottom boundary of one gridbox during one motion
+   * step
    */
   KOKKOS_FUNCTION
-  void monitor_precipitation(const TeamMember& team_member, const unsigned int gbxindex,
-                             const GridboxMaps auto& gbxmaps, Superdrop& drop) const {}
+  void monitor_precipitation(const TeamMember& team_member, const double totprecip) const {}
 
   /**
    * @brief Constructor for MonitorCondensation
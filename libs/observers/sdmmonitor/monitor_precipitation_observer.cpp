@@ -26,3 +26,20 @@ void MonitorPrecipitation::reset_monitor() const {
       "reset_monitor", Kokkos::RangePolicy(0, d_data.extent(0)),
       KOKKOS_CLASS_LAMBDA(const size_t& jj) { d_data(jj) = 0.0; });
 }
+
+/**
+ * @brief Add precipitation through the bottom boundary of a gridbox to current value since view
+ * was last reset.
+ *
+ * @param team_member Kokkos team member in TeamPolicy parallel loop over gridboxes.
+ * @param totprecip Precipitation through the bottom boundary of one gridbox during one motion
+ * step
+ */
+KOKKOS_FUNCTION
+void MonitorPrecipitation::monitor_precipitation(const TeamMember& team_member,
+                                                 const double totprecip) const {
+  Kokkos::single(Kokkos::PerTeam(team_member), [=, this]() {
+    const auto ii = team_member.league_rank();
+    d_data(ii) += static_cast<datatype>(totprecip);
+  });
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: monitor_solvercost_observer.cpp
+ * Project: sdmmonitor
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * functionality to monitor cost of condensation and collision SDM microphysical processes
+ */
+
+#include "./monitor_solvercost_observer.hpp"
+
+/**
+ * @brief Parallel loop to fill all views with zero value.
+ */
+void MonitorSolverCost::reset_monitor() const {
+  Kokkos::parallel_for(
+      "reset_monitor", Kokkos::RangePolicy(0, d_niters.extent(0)),
+      KOKKOS_CLASS_LAMBDA(const size_t& jj) {
+        d_niters(jj) = 0;
+        d_nsubsteps(jj) = 0;
+        d_ncolls(jj) = 0;
+        d_ncoals(jj) = 0;
+        d_nbreakups(jj) = 0;
+        d_nnulls(jj) = 0;
+      });
+  h_nsubsteps_motion() = 0;
+}
+
+/**
+ * @brief Monitor cost of condensation ODE solver.
+ *
+ * Add number of Newton Raphson iterations and number of (sub-)timesteps to current values
+ * since views were last reset. Counts have already been reduced over the team so a single
+ * team member updates the gridbox's values (no atomics required).
+ *
+ * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+ * @param niters Number of Newton Raphson iterations of condensation ODE solver in one gridbox
+ * @param nsubsteps Number of (sub-)timesteps of condensation ODE solver in one gridbox
+ */
+KOKKOS_FUNCTION
+void MonitorSolverCost::monitor_condensation_solver(const TeamMember& team_member,
+                                                    const uint64_t niters,
+                                                    const uint64_t nsubsteps) const {
+  Kokkos::single(Kokkos::PerTeam(team_member), [=, this]() {
+    const auto ii = team_member.league_rank();
+    d_niters(ii) += niters;
+    d_nsubsteps(ii) += nsubsteps;
+  });
+}
+
+/**
+ * @brief Monitor collision events.
+ *
+ * Add number of collision, coalescence and breakup events and number of null superdroplets
+ * produced to current values since views were last reset. Counts have already been reduced
+ * over the team so a single team member updates the gridbox's values (no atomics required).
+ *
+ * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+ * @param ncolls Number of collision events in one gridbox
+ * @param ncoals Number of collision events which resulted in coalescence
+ * @param nbreakups Number of collision events which resulted in breakup
+ * @param nnulls Number of null superdroplets produced by collisions
+ */
+KOKKOS_FUNCTION
+void MonitorSolverCost::monitor_collisions(const TeamMember& team_member, const uint64_t ncolls,
+                                           const uint64_t ncoals, const uint64_t nbreakups,
+                                           const uint64_t nnulls) const {
+  Kokkos::single(Kokkos::PerTeam(team_member), [=, this]() {
+    const auto ii = team_member.league_rank();
+    d_ncolls(ii) += ncolls;
+    d_ncoals(ii) += ncoals;
+    d_nbreakups(ii) += nbreakups;
+    d_nnulls(ii) += nnulls;
+  });
+}
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: monitor_solvercost_observer.hpp
+ * Project: sdmmonitor
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * struct to create observer which outputs the cost of SDM microphysical processes in each gridbox,
+ * i.e. the number of Newton Raphson iterations and (sub-)timesteps of the condensation ODE solver,
+ * the number of collision, coalescence and breakup events and null superdroplets produced, and the
+ * number of sub-steps of superdroplet motion (in the whole domain) accumulated over a constant
+ * interval and output at the start of each timestep.
+ */
+
+#ifndef LIBS_OBSERVERS_SDMMONITOR_MONITOR_SOLVERCOST_OBSERVER_HPP_
+#define LIBS_OBSERVERS_SDMMONITOR_MONITOR_SOLVERCOST_OBSERVER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../kokkosaliases.hpp"
+#include "observers/consttstep_observer.hpp"
+#include "observers/observers.hpp"
+#include "superdrops/sdmmonitor.hpp"
+#include "superdrops/superdrop.hpp"
+#include "zarr/buffer.hpp"
+#include "zarr/xarray_zarr_array.hpp"
+
+namespace KCS = KokkosCleoSettings;
+
+/* struct satisfies SDMMonitor concept for use in DoMonitorSolverCostObs to make observer */
+struct MonitorSolverCost {
+  using datatype = uint64_t;
+  Buffer<datatype>::mirrorviewd_buffer d_niters;     // no. Newton Raphson iterations
+  Buffer<datatype>::mirrorviewd_buffer d_nsubsteps;  // no. (sub-)timesteps of condensation solver
+  Buffer<datatype>::mirrorviewd_buffer d_ncolls;     // no. collision events
+  Buffer<datatype>::mirrorviewd_buffer d_ncoals;     // no. coalescence events
+  Buffer<datatype>::mirrorviewd_buffer d_nbreakups;  // no. breakup events
+  Buffer<datatype>::mirrorviewd_buffer d_nnulls;     // no. null superdroplets from collisions
+  Kokkos::View<datatype, HostSpace> h_nsubsteps_motion;  // no. sub-steps of superdroplet motion
+
+  /**
+   * @brief Parallel loop to fill all views with zero value.
+   */
+  void reset_monitor() const;
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkos team member in TeamPolicy parallel loop over gridboxes.
+   * @param d_supers The subview of superdrops.
+   */
+  KOKKOS_FUNCTION
+  void before_timestepping(const TeamMember& team_member,
+                           const subviewd_constsupers d_supers) const {}
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param totmass_condensed Mass condensed in one gridbox during one microphysical timestep
+   */
+  KOKKOS_FUNCTION
+  void monitor_condensation(const TeamMember& team_member, const double totmass_condensed) const {}
+
+  /**
+   * @brief Monitor cost of condensation ODE solver.
+   *
+   * Add number of Newton Raphson iterations and number of (sub-)timesteps to current values
+   * since views were last reset.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param niters Number of Newton Raphson iterations of condensation ODE solver in one gridbox
+   * @param nsubsteps Number of (sub-)timesteps of condensation ODE solver in one gridbox
+   */
+  KOKKOS_FUNCTION
+  void monitor_condensation_solver(const TeamMember& team_member, const uint64_t niters,
+                                   const uint64_t nsubsteps) const;
+
+  /**
+   * @brief Monitor collision events.
+   *
+   * Add number of collision, coalescence and breakup events and number of null superdroplets
+   * produced to current values since views were last reset.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param ncolls Number of collision events in one gridbox
+   * @param ncoals Number of collision events which resulted in coalescence
+   * @param nbreakups Number of collision events which resulted in breakup
+   * @param nnulls Number of null superdroplets produced by collisions
+   */
+  KOKKOS_FUNCTION
+  void monitor_collisions(const TeamMember& team_member, const uint64_t ncolls,
+                          const uint64_t ncoals, const uint64_t nbreakups,
+                          const uint64_t nnulls) const;
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param supers (sub)View of all the superdrops in one gridbox during one microphysical timestep
+   */
+  KOKKOS_FUNCTION
+  void monitor_microphysics(const TeamMember& team_member, const viewd_constsupers supers) const {}
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkkos team member in TeamPolicy parallel loop over gridboxes
+   * @param supers (sub)View of all the superdrops in one gridbox after one motion step
+   */
+  KOKKOS_FUNCTION
+  void monitor_motion(const TeamMember& team_member, const viewd_constsupers supers) const {}
+
+  /**
+   * @brief Monitor number of sub-steps of superdroplet motion.
+   *
+   * Add number of sub-steps of one motion step (same for all gridboxes in domain) to current
+   * value since monitor was last reset.
+   *
+   * @param nsubsteps Number of sub-steps of superdroplet motion step.
+   */
+  void monitor_motion_substeps(const unsigned int nsubsteps) const {
+    h_nsubsteps_motion() += nsubsteps;
+  }
+
+  /**
+   * @brief Placeholder function to obey SDMMonitor concept does nothing.
+   *
+   * @param team_member Kokkos team member in TeamPolicy parallel loop over gridboxes.
+   * @param totprecip Precipitation through the bottom boundary of one gridbox during one motion
+   * step
+   */
+  KOKKOS_FUNCTION
+  void monitor_precipitation(const TeamMember& team_member, const double totprecip) const {}
+
+  /**
+   * @brief Constructor for MonitorSolverCost
+   *
+   * @param ngbxs Number of gridboxes in domain.
+   */
+  explicit MonitorSolverCost(const size_t ngbxs)
+      : d_niters("d_monitor_niters_cond", ngbxs),
+        d_nsubsteps("d_monitor_nsubsteps_cond", ngbxs),
+        d_ncolls("d_monitor_ncolls", ngbxs),
+        d_ncoals("d_monitor_ncoals", ngbxs),
+        d_nbreakups("d_monitor_nbreakups", ngbxs),
+        d_nnulls("d_monitor_nnulls_colls", ngbxs),
+        h_nsubsteps_motion("h_monitor_nsubsteps_motion") {
+    reset_monitor();
+  }
+};
+
+/**
+ * @brief Struct holding the arrays in the dataset for the solver cost monitor.
+ *
+ * @tparam Dataset The type of dataset.
+ * @tparam Store The type of data store in the dataset.
+ */
+template <typename Dataset, typename Store>
+struct MonitorSolverCostXarrays {
+  using T = MonitorSolverCost::datatype;
+  XarrayZarrArray<Store, T> niters;    /**< no. Newton Raphson iterations Xarray */
+  XarrayZarrArray<Store, T> nsubsteps; /**< no. (sub-)timesteps of condensation solver Xarray */
+  XarrayZarrArray<Store, T> ncolls;    /**< no. collision events Xarray */
+  XarrayZarrArray<Store, T> ncoals;    /**< no. coalescence events Xarray */
+  XarrayZarrArray<Store, T> nbreakups; /**< no. breakup events Xarray */
+  XarrayZarrArray<Store, T> nnulls;    /**< no. null superdroplets from collisions Xarray */
+  std::shared_ptr<XarrayZarrArray<Store, T>>
+      nsubsteps_motion; /**< no. sub-steps of superdroplet motion Xarray */
+
+  /**
+   * @brief Creates an array for a count in each gridbox (with no units and no scale factor).
+   */
+  static XarrayZarrArray<Store, T> create_count_xarray(const Dataset& dataset,
+                                                       const std::string_view name,
+                                                       const size_t maxchunk, const size_t ngbxs) {
+    const auto chunkshape = good2Dchunkshape(maxchunk, ngbxs);
+    const auto dimnames = std::vector<std::string>{"time", "gbxindex"};
+    return dataset.template create_array<T>(name, "", 1, chunkshape, dimnames);
+  }
+
+  MonitorSolverCostXarrays(const Dataset& dataset, Store& store, const size_t maxchunk,
+                           const size_t ngbxs)
+      : niters(create_count_xarray(dataset, "niters_cond", maxchunk, ngbxs)),
+        nsubsteps(create_count_xarray(dataset, "nsubsteps_cond", maxchunk, ngbxs)),
+        ncolls(create_count_xarray(dataset, "ncolls", maxchunk, ngbxs)),
+        ncoals(create_count_xarray(dataset, "ncoals", maxchunk, ngbxs)),
+        nbreakups(create_count_xarray(dataset, "nbreakups", maxchunk, ngbxs)),
+        nnulls(create_count_xarray(dataset, "nnulls_colls", maxchunk, ngbxs)),
+        nsubsteps_motion(std::make_shared<XarrayZarrArray<Store, T>>(
+            dataset.template create_array<T>("nsubsteps_motion", "", 1, {maxchunk}, {"time"}))) {}
+};
+
+/**
+ * @class DoMonitorSolverCostObs
+ * @brief Class for functionality to observe data from a solver cost monitor of SDM
+ * processes at the start of each timestep and write it to Zarr arrays in an Xarray dataset.
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store for dataset.
+ */
+template <typename Dataset, typename Store>
+class DoMonitorSolverCostObs {
+ private:
+  using T = MonitorSolverCost::datatype;
+  Dataset& dataset; /**< Dataset to write time data to. */
+  std::shared_ptr<MonitorSolverCostXarrays<Dataset, Store>>
+      xzarrs_ptr; /**< Pointer to arrays in dataset. */
+  MonitorSolverCost monitor;
+
+  /**
+   * @brief Copy data from d_data view on device into host view,
+   * then write to the array in the dataset.
+   */
+  void write_to_array(const Buffer<T>::mirrorviewd_buffer d_data,
+                      XarrayZarrArray<Store, T>& xzarr) const {
+    using viewh_buffer = Buffer<T>::viewh_buffer;
+    const auto h_data = viewh_buffer("h_data", d_data.extent(0));
+    Kokkos::deep_copy(h_data, d_data);
+    dataset.write_to_array(xzarr, h_data);
+  }
+
+  /**
+   * @brief Write each count from the monitor's views to the appropriate arrays in the
+   * dataset then reset the monitor.
+   */
+  void at_start_step() const {
+    write_to_array(monitor.d_niters, xzarrs_ptr->niters);
+    write_to_array(monitor.d_nsubsteps, xzarrs_ptr->nsubsteps);
+    write_to_array(monitor.d_ncolls, xzarrs_ptr->ncolls);
+    write_to_array(monitor.d_ncoals, xzarrs_ptr->ncoals);
+    write_to_array(monitor.d_nbreakups, xzarrs_ptr->nbreakups);
+    write_to_array(monitor.d_nnulls, xzarrs_ptr->nnulls);
+    dataset.write_to_array(xzarrs_ptr->nsubsteps_motion, monitor.h_nsubsteps_motion());
+
+    monitor.reset_monitor();
+  }
+
+ public:
+  /**
+   * @brief Constructor for DoMonitorSolverCostObs.
+   * @param dataset Dataset to write monitored data to.
+   * @param store Store dataset writes into.
+   * @param maxchunk The maximum chunk size (number of elements) for Xarrays.
+   * @param ngbxs The number of gridboxes.
+   */
+  DoMonitorSolverCostObs(Dataset& dataset, Store& store, const size_t maxchunk,
+                         const size_t ngbxs)
+      : dataset(dataset),
+        xzarrs_ptr(
+            std::make_shared<MonitorSolverCostXarrays<Dataset, Store>>(dataset, store, maxchunk,
+                                                                        ngbxs)),
+        monitor(ngbxs) {}
+
+  /**
+   * @brief Destructor for DoMonitorSolverCostObs.
+   */
+  ~DoMonitorSolverCostObs() {
+    dataset.write_arrayshape(xzarrs_ptr->niters);
+    dataset.write_arrayshape(xzarrs_ptr->nsubsteps);
+    dataset.write_arrayshape(xzarrs_ptr->ncolls);
+    dataset.write_arrayshape(xzarrs_ptr->ncoals);
+    dataset.write_arrayshape(xzarrs_ptr->nbreakups);
+    dataset.write_arrayshape(xzarrs_ptr->nnulls);
+    dataset.write_arrayshape(xzarrs_ptr->nsubsteps_motion);
+  }
+
+  /**
+   * @brief Placeholder for before timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void before_timestepping(const viewd_constgbx d_gbxs,
+                           const subviewd_constsupers domainsupers) const {
+    std::cout << "observer includes SDM solver cost monitor observer\n";
+  }
+
+  /**
+   * @brief Placeholder for after timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void after_timestepping() const {}
+
+  /**
+   * @brief Adapter to call at start step function which writes data from the monitor to the
+   * arrays in the dataset.
+   *
+   * @param t_mdl Current model timestep.
+   * @param d_gbxs View of gridboxes on device.
+   * @param d_supers View of superdrops on device.
+   */
+  void at_start_step(const unsigned int t_mdl, const viewd_constgbx d_gbxs,
+                     const subviewd_constsupers d_supers) const {
+    at_start_step();
+  }
+
+  /**
+   * @brief Get monitor for SDM processes from observer.
+   *
+   * @return monitor 'mo' of the observer
+   */
+  SDMMonitor auto get_sdmmonitor() const { return monitor; }
+};
+
+/**
+ * @brief Constructs an observer which writes data monitoring the cost of SDM microphysical
+ * processes (condensation ODE solver iterations and sub-timesteps, and collision, coalescence,
+ * breakup and null superdroplet counts) in each gridbox to arrays with a constant observation
+ * timestep "interval".
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store for dataset.
+ * @param interval Observation timestep.
+ * @param dataset Dataset to write time data to.
+ * @param store Store which dataset writes to
+ * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+ * @param ngbxs The number of gridboxes.
+ * @return Constructed type satisfying observer concept.
+ */
+template <typename Dataset, typename Store>
+inline Observer auto MonitorSolverCostObserver(const unsigned int interval, Dataset& dataset,
+                                               Store& store, const size_t maxchunk,
+                                               const size_t ngbxs) {
+  const auto do_obs = DoMonitorSolverCostObs<Dataset, Store>(dataset, store, maxchunk, ngbxs);
+  return ConstTstepObserver(interval, do_obs);
+}
+
+#endif  // LIBS_OBSERVERS_SDMMONITOR_MONITOR_SOLVERCOST_OBSERVER_HPP_
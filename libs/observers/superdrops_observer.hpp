@@ -24,6 +24,7 @@
 #include <concepts>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -32,6 +33,7 @@
 #include "../kokkosaliases.hpp"
 #include "observers/collect_data_for_dataset.hpp"
 #include "observers/generic_collect_data.hpp"
+#include "observers/parallel_write_data.hpp"
 #include "observers/write_to_dataset_observer.hpp"
 #include "superdrops/superdrop.hpp"
 
@@ -74,7 +76,18 @@ struct RaggedCount {
    * @param d_supers The view of total super-droplets.
    */
   void write_to_array(const Dataset& dataset, const subviewd_constsupers d_supers) const {
-    const auto totnsupers = static_cast<uint32_t>(d_supers.extent(0));
+    write_to_array(dataset, d_supers.extent(0));
+  }
+
+  /**
+   * @brief Writes the given number of super-droplets to the ragged count array in the dataset,
+   * e.g. the number of super-droplets in a sample.
+   *
+   * @param dataset The dataset to write data to.
+   * @param nsupers The number of super-droplets written.
+   */
+  void write_to_array(const Dataset& dataset, const size_t nsupers) const {
+    const auto totnsupers = static_cast<uint32_t>(nsupers);
     dataset.write_to_array(xzarr_ptr, totnsupers);
   }
 
@@ -131,6 +144,7 @@ CollectDataForDataset<Dataset> auto CollectSuperdropVariable(
  * _Note:_ Conversion of sdgbxindex from unsigned long int (8 bytes) to unsigned int
  * (uint32_t = 4 bytes)
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -138,10 +152,17 @@ CollectDataForDataset<Dataset> auto CollectSuperdropVariable(
  */
 struct SdgbxindexFunc {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<uint32_t>::mirrorviewd_buffer d_data) const {
     auto sdgbxindex = static_cast<uint32_t>(d_supers(kk).get_sdgbxindex());
-    d_data(kk) = sdgbxindex;
+    d_data(nn) = sdgbxindex;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<uint32_t>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -175,6 +196,7 @@ CollectDataForDataset<Dataset> auto CollectSdgbxindex(const Dataset& dataset,
  * _Note:_ Conversion of sdid from unsigned long int (8 bytes) to unsigned int
  * (uint32_t = 4 bytes)
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -182,10 +204,17 @@ CollectDataForDataset<Dataset> auto CollectSdgbxindex(const Dataset& dataset,
  */
 struct SdIdFunc {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<uint32_t>::mirrorviewd_buffer d_data) const {
     auto sdid = static_cast<uint32_t>(d_supers(kk).sdId.get_value());
-    d_data(kk) = sdid;
+    d_data(nn) = sdid;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<uint32_t>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -218,6 +247,7 @@ CollectDataForDataset<Dataset> auto CollectSdId(const Dataset& dataset, const si
  * _Note:_ Conversion of xi from size_t (architecture dependent usually 8 bytes) to 8 byte, long
  * unsigned int (unit64_t).
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -225,7 +255,8 @@ CollectDataForDataset<Dataset> auto CollectSdId(const Dataset& dataset, const si
  */
 struct XiFunc {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<uint64_t>::mirrorviewd_buffer d_data) const {
     if (d_supers(kk).get_xi() >= LIMITVALUES::uint64_t_max) {
       Kokkos::abort(
@@ -233,7 +264,13 @@ struct XiFunc {
           "represent with 8 byte unsigned integer");
     }
     auto xi = static_cast<uint64_t>(d_supers(kk).get_xi());
-    d_data(kk) = xi;
+    d_data(nn) = xi;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<uint64_t>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -265,6 +302,7 @@ CollectDataForDataset<Dataset> auto CollectXi(const Dataset& dataset, const size
  *
  * _Note:_ Conversion of radius from double (8 bytes) to float (4 bytes).
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -272,10 +310,17 @@ CollectDataForDataset<Dataset> auto CollectXi(const Dataset& dataset, const size
  */
 struct RadiusFunc {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<float>::mirrorviewd_buffer d_data) const {
     auto radius = static_cast<float>(d_supers(kk).get_radius());
-    d_data(kk) = radius;
+    d_data(nn) = radius;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<float>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -307,6 +352,7 @@ CollectDataForDataset<Dataset> auto CollectRadius(const Dataset& dataset, const
  *
  * _Note:_ Conversion of msol from double (8 bytes) to float (4 bytes).
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -314,10 +360,17 @@ CollectDataForDataset<Dataset> auto CollectRadius(const Dataset& dataset, const
  */
 struct MsolFunc {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<float>::mirrorviewd_buffer d_data) const {
     auto msol = static_cast<float>(d_supers(kk).get_msol());
-    d_data(kk) = msol;
+    d_data(nn) = msol;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<float>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -348,6 +401,7 @@ CollectDataForDataset<Dataset> auto CollectMsol(const Dataset& dataset, const si
  *
  * _Note:_ Conversion of coord3 from double (8 bytes) to float (4 bytes).
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -355,10 +409,17 @@ CollectDataForDataset<Dataset> auto CollectMsol(const Dataset& dataset, const si
  */
 struct Coord3Func {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<float>::mirrorviewd_buffer d_data) const {
     auto coord3 = static_cast<float>(d_supers(kk).get_coord3());
-    d_data(kk) = coord3;
+    d_data(nn) = coord3;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<float>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -390,6 +451,7 @@ CollectDataForDataset<Dataset> auto CollectCoord3(const Dataset& dataset, const
  *
  * _Note:_ Conversion of coord1 from double (8 bytes) to float (4 bytes).
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -397,10 +459,17 @@ CollectDataForDataset<Dataset> auto CollectCoord3(const Dataset& dataset, const
  */
 struct Coord1Func {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<float>::mirrorviewd_buffer d_data) const {
     auto coord1 = static_cast<float>(d_supers(kk).get_coord1());
-    d_data(kk) = coord1;
+    d_data(nn) = coord1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<float>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -432,6 +501,7 @@ CollectDataForDataset<Dataset> auto CollectCoord1(const Dataset& dataset, const
  *
  * _Note:_ Conversion of coord2 from double (8 bytes) to float (4 bytes).
  *
+ * @param nn The index in d_data to copy to (= kk unless gathering from a sample of superdroplets).
  * @param kk The index of the superdrop.
  * @param d_gbxs The view of gridboxes on device.
  * @param d_supers The view of superdroplets on device.
@@ -439,10 +509,17 @@ CollectDataForDataset<Dataset> auto CollectCoord1(const Dataset& dataset, const
  */
 struct Coord2Func {
   KOKKOS_INLINE_FUNCTION
-  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+  void operator()(const size_t nn, const size_t kk, viewd_constgbx d_gbxs,
+                  const subviewd_constsupers d_supers,
                   Buffer<float>::mirrorviewd_buffer d_data) const {
     auto coord2 = static_cast<float>(d_supers(kk).get_coord2());
-    d_data(kk) = coord2;
+    d_data(nn) = coord2;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t kk, viewd_constgbx d_gbxs, const subviewd_constsupers d_supers,
+                  Buffer<float>::mirrorviewd_buffer d_data) const {
+    (*this)(kk, kk, d_gbxs, d_supers, d_data);
   }
 };
 
@@ -489,4 +566,226 @@ inline Observer auto SuperdropsObserver(const unsigned int interval, const Datas
   return WriteToDatasetObserver(interval, dataset, collect_data, ragged_count);
 }
 
+/**
+ * @brief Criteria for selecting a (deterministic) sample of superdroplets to write to a dataset.
+ *
+ * A superdroplet is selected if it meets all of the criteria. Criteria based on a superdroplet's
+ * identity (every id_stride'th sdId and/or a fraction of sdIds chosen by a hash of the sdId) are
+ * independent of time and of the process the superdroplet is on, so the same superdroplets are
+ * selected at every observation time (and on every process) and their trajectories remain
+ * continuous. Criteria based on a region of the domain or a range of radii select whichever
+ * superdroplets meet them at each observation time. By default all superdroplets are selected.
+ */
+struct SuperdropsSampleCriteria {
+  uint64_t id_stride = 1;   /**< select superdroplets with sdId % id_stride == 0 */
+  double id_fraction = 1.0; /**< select (approx.) this fraction of sdIds, 0 <= id_fraction <= 1 */
+  Kokkos::pair<double, double> radius_range = {LIMITVALUES::llim, LIMITVALUES::ulim};
+  /**< select superdroplets with lower <= radius < upper */
+  Kokkos::pair<double, double> coord3_range = {LIMITVALUES::llim, LIMITVALUES::ulim};
+  /**< select superdroplets with lower <= coord3 < upper */
+  Kokkos::pair<double, double> coord1_range = {LIMITVALUES::llim, LIMITVALUES::ulim};
+  /**< select superdroplets with lower <= coord1 < upper */
+  Kokkos::pair<double, double> coord2_range = {LIMITVALUES::llim, LIMITVALUES::ulim};
+  /**< select superdroplets with lower <= coord2 < upper */
+
+  /**
+   * @brief Returns a number uniformly distributed in [0, 1) which is a deterministic hash of a
+   * superdroplet identity (using the finaliser of the SplitMix64 generator).
+   *
+   * @param id The identity (sdId) of a superdroplet.
+   * @return Hash of id in [0, 1).
+   */
+  KOKKOS_INLINE_FUNCTION
+  static double hash_id(uint64_t id) {
+    id += 0x9e3779b97f4a7c15ULL;
+    id = (id ^ (id >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    id = (id ^ (id >> 27)) * 0x94d049bb133111ebULL;
+    id = id ^ (id >> 31);
+    constexpr double twoPow53 = 9007199254740992.0;
+    return static_cast<double>(id >> 11) / twoPow53;
+  }
+
+  /**
+   * @brief Returns true if superdroplet meets all of the criteria for the sample.
+   *
+   * @param drop The superdroplet.
+   * @return True if superdroplet is selected.
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool is_selected(const Superdrop& drop) const {
+    const auto in_range = [](const Kokkos::pair<double, double>& range, const double val) {
+      return (val >= range.first && val < range.second);
+    };
+
+    const auto id = static_cast<uint64_t>(drop.sdId.get_value());
+    return ((id % id_stride == 0) && (hash_id(id) < id_fraction) &&
+            in_range(radius_range, drop.get_radius()) &&
+            in_range(coord3_range, drop.get_coord3()) &&
+            in_range(coord1_range, drop.get_coord1()) && in_range(coord2_range, drop.get_coord2()));
+  }
+};
+
+/**
+ * @brief Function-like object to find the indexes of the superdroplets which meet the criteria of
+ * a sample, e.g. so that data can be gathered from only those superdroplets without copying them.
+ *
+ * The view for the indexes is re-used (and only grown if necessary) between calls.
+ */
+class SampleSuperdrops {
+ private:
+  SuperdropsSampleCriteria criteria;      /**< criteria for selecting superdroplets in sample */
+  std::shared_ptr<viewd_indexes> indexes; /**< view for the indexes of superdroplets in sample */
+
+ public:
+  /**
+   * @brief Constructs a new SampleSuperdrops object.
+   *
+   * Throws error if id_stride < 1 or id_fraction is not in range [0, 1].
+   *
+   * @param criteria Criteria for selecting superdroplets in sample.
+   */
+  explicit SampleSuperdrops(const SuperdropsSampleCriteria criteria)
+      : criteria(criteria), indexes(std::make_shared<viewd_indexes>("sampled_supers", 0)) {
+    if (criteria.id_stride == 0 || criteria.id_fraction < 0.0 || criteria.id_fraction > 1.0) {
+      const auto err = std::string("superdroplet sample requires id_stride >= 1 and ") +
+                       std::string("0 <= id_fraction <= 1");
+      throw std::invalid_argument(err);
+    }
+  }
+
+  /**
+   * @brief Returns the indexes of the superdroplets which meet the criteria of the sample.
+   *
+   * Indexes of selected superdroplets are found (in ascending order) using a
+   * Kokkos::parallel_scan over superdroplets, equivalent in serial to:
+   * for (size_t kk(0); kk < d_supers.extent(0); ++kk){[...]}.
+   *
+   * @param d_supers The view of superdroplets on device.
+   * @return The view of indexes (in d_supers) of superdroplets in the sample on device.
+   */
+  viewd_constindexes operator()(const subviewd_constsupers d_supers) const {
+    const size_t nsupers(d_supers.extent(0));
+    if (indexes->extent(0) < nsupers) {
+      Kokkos::realloc(*indexes, nsupers);
+    }
+
+    const auto crit = criteria;
+    const auto d_indexes = *indexes;
+    auto nsample = size_t{0};
+    Kokkos::parallel_scan(
+        "sample_supers", Kokkos::RangePolicy<ExecSpace>(0, nsupers),
+        KOKKOS_LAMBDA(const size_t kk, size_t& nn, const bool is_final) {
+          if (crit.is_selected(d_supers(kk))) {
+            if (is_final) {
+              d_indexes(nn) = kk;
+            }
+            ++nn;
+          }
+        },
+        nsample);
+
+    return Kokkos::subview(viewd_constindexes(d_indexes), kkpair_size_t{0, nsample});
+  }
+};
+
+/**
+ * @brief Struct for "ParallelWriteData" (see write_to_dataset_observer.hpp) to collect data from
+ * only a sample of the superdroplets and then write that data to ragged arrays in a dataset.
+ *
+ * As for ParallelWriteSupers, except that data is gathered (in a parallel loop over the sample)
+ * from the superdroplets at the indexes of the sample. The type returned by the CollectData's
+ * get_gather_functor() call should therefore have operator() with signature
+ * void operator()(const size_t nn).
+ *
+ * @tparam Dataset The type dataset used to write data to a store.
+ * @tparam CollectData The object for collecting data satsifying the CollectDataForDataset concept.
+ * @tparam RaggedCount The type of the function object for writing the ragged count variable in the
+ * dataset, e.g. RaggedCount which can also write a given number of superdroplets.
+ */
+template <typename Dataset, CollectDataForDataset<Dataset> CollectData,
+          CollectRaggedCount<Dataset> RaggedCount>
+class ParallelWriteSampledSupers {
+ private:
+  const Dataset& dataset; /**< dataset to write data to */
+  CollectData collect_data;
+  /**< functions to collect data from superdroplets and write it to ragged array(s) */
+  RaggedCount ragged_count; /**< functions to write ragged count variable to a dataset */
+  SampleSuperdrops sample;  /**< Function-like object to select sample of superdroplets */
+
+ public:
+  /**
+   * @brief Constructs a new ParallelWriteSampledSupers object.
+   *
+   * @param dataset The dataset to write data to.
+   * @param collect_data Object for collecting data satsifying the CollectDataForDataset concept.
+   * @param ragged_count Object for writing the ragged count variable in the dataset.
+   * @param criteria Criteria for selecting superdroplets in sample.
+   */
+  ParallelWriteSampledSupers(const Dataset& dataset, CollectData collect_data,
+                             RaggedCount ragged_count, const SuperdropsSampleCriteria criteria)
+      : dataset(dataset),
+        collect_data(collect_data),
+        ragged_count(ragged_count),
+        sample(criteria) {}
+
+  /**
+   * @brief Destructor for the ParallelWriteSampledSupers class.
+   */
+  ~ParallelWriteSampledSupers() {
+    collect_data.write_ragged_arrayshapes(dataset);
+    ragged_count.write_arrayshape(dataset);
+  }
+
+  /**
+   * @brief Writes data from the superdroplets which meet the criteria of the sample.
+   *
+   * Data is gathered from the superdroplets at the indexes of the sample in a parallel loop over
+   * the sample, then written to ragged arrays in the dataset alongside the ragged count.
+   *
+   * @param d_gbxs The view of gridboxes in device memory.
+   * @param d_supers The view of superdroplets in device memory.
+   */
+  void operator()(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    const auto d_indexes = sample(d_supers);
+    const size_t nsample(d_indexes.extent(0));
+
+    collect_data.reallocate_views(nsample);
+    const auto functor = collect_data.get_gather_functor(d_gbxs, d_supers, d_indexes);
+    Kokkos::parallel_for("write_sampled_supers", Kokkos::RangePolicy<ExecSpace>(0, nsample),
+                         functor);
+    collect_data.write_to_ragged_arrays(dataset);
+    ragged_count.write_to_array(dataset, nsample);
+  }
+};
+
+/**
+ * @brief Constructs an observer which writes superdroplet variables (e.g. their attributes) from
+ * a sample of the superdroplets at start of each observation timestep to a ragged arrays with a
+ * constant observation timestep "interval".
+ *
+ * Superdroplets are selected for the sample according to the given criteria, see
+ * SuperdropsSampleCriteria. The sample is selected independently on each process, so the observer
+ * can be used with datasets which collect data from multiple processes.
+ *
+ * @tparam Dataset Type of dataset.
+ * @tparam Store Type of store for dataset.
+ * @param interval Observation timestep.
+ * @param dataset Dataset to write time data to.
+ * @param store The store the dataset writes to.
+ * @param maxchunk Maximum number of elements in a chunk (1-D vector size).
+ * @param collect_data Object satisfying CollectDataForDataset for given Store to write superdroplet
+ * data, such as their attributes, to ragged arrays.
+ * @param criteria Criteria for selecting superdroplets in sample.
+ * @return Observer An observer instance for writing data from a sample of superdroplets.
+ */
+template <typename Dataset, typename Store>
+inline Observer auto SuperdropsObserver(const unsigned int interval, const Dataset& dataset,
+                                        Store& store, const size_t maxchunk,
+                                        CollectDataForDataset<Dataset> auto collect_data,
+                                        const SuperdropsSampleCriteria criteria) {
+  const CollectRaggedCount<Dataset> auto ragged_count = RaggedCount(dataset, store, maxchunk);
+  return WriteToDatasetObserver(
+      interval, ParallelWriteSampledSupers(dataset, collect_data, ragged_count, criteria));
+}
+
 #endif  // LIBS_OBSERVERS_SUPERDROPS_OBSERVER_HPP_
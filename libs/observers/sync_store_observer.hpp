@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: sync_store_observer.hpp
+ * Project: observers
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Observer to tell a store (e.g. PosixFSStore) that an observation has ended so that the store can
+ * batch and synchronise its writes according to its own (durability) policy.
+ */
+
+#ifndef LIBS_OBSERVERS_SYNC_STORE_OBSERVER_HPP_
+#define LIBS_OBSERVERS_SYNC_STORE_OBSERVER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <concepts>
+#include <iostream>
+
+#include "../kokkosaliases.hpp"
+#include "observers/consttstep_observer.hpp"
+#include "observers/observers.hpp"
+#include "superdrops/sdmmonitor.hpp"
+
+/**
+ * @brief Concept for stores which can be told when an observation has ended.
+ *
+ * @tparam Store Type that satisfies the SyncableStore concept.
+ */
+template <typename Store>
+concept SyncableStore = requires(Store store) {
+  { store.end_observation() } -> std::same_as<void>;
+};
+
+/**
+ * @class DoSyncStoreObs
+ * @brief Template class for functionality to tell a store that an observation has ended.
+ * @tparam Store Type of store.
+ */
+template <SyncableStore Store>
+class DoSyncStoreObs {
+ private:
+  Store& store; /**< Store which observers write to. */
+
+ public:
+  /**
+   * @brief Constructor for DoSyncStoreObs.
+   * @param store Store which observers write to.
+   */
+  explicit DoSyncStoreObs(Store& store) : store(store) {}
+
+  /**
+   * @brief Placeholder for before timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void before_timestepping(const viewd_constgbx d_gbxs, const subviewd_constsupers d_supers) const {
+    std::cout << "observer includes sync store observer\n";
+  }
+
+  /**
+   * @brief Placeholder for after timestepping functionality and to make class satisfy observer
+   * concept.
+   */
+  void after_timestepping() const {}
+
+  /**
+   * @brief Tells the store that an observation has ended.
+   *
+   * @param t_mdl Current model timestep.
+   * @param d_gbxs View of gridboxes on device.
+   * @param d_supers View of superdrops on device.
+   */
+  void at_start_step(const unsigned int t_mdl, const viewd_constgbx d_gbxs,
+                     const subviewd_constsupers d_supers) const {
+    store.end_observation();
+  }
+
+  /**
+   * @brief Get null monitor for SDM processes from observer.
+   *
+   * @return monitor 'mo' of the observer that does nothing
+   */
+  SDMMonitor auto get_sdmmonitor() const { return NullSDMMonitor{}; }
+};
+
+/**
+ * @brief Constructs an observer which tells a store that an observation has ended at the start
+ * of each observation timestep with a constant observation timestep "interval".
+ *
+ * Observer should be combined after (i.e. to the right of) the observers which write to the store
+ * so that it acts after they have written their data for the observation.
+ *
+ * @tparam Store Type of store.
+ * @param interval Observation timestep.
+ * @param store Store which observers write to.
+ * @return Constructed type satisfying observer concept.
+ */
+template <SyncableStore Store>
+inline Observer auto SyncStoreObserver(const unsigned int interval, Store& store) {
+  return ConstTstepObserver(interval, DoSyncStoreObs<Store>(store));
+}
+
+#endif  // LIBS_OBSERVERS_SYNC_STORE_OBSERVER_HPP_
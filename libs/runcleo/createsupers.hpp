@@ -21,7 +21,9 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
+#include <concepts>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -29,12 +31,29 @@
 #include "gridboxes/supersindomain.hpp"
 #include "runcleo/gensuperdrop.hpp"
 
+/**
+ * @concept DeviceSuperdropInitConds
+ * @brief Concept for super-droplets' initial conditions which can generate super-droplets
+ * directly in a view in device memory (rather than via data fetched on host).
+ *
+ * A type satisfies the DeviceSuperdropInitConds concept if it provides an
+ * `initialise_supers_on_device(totsupers)` function which initialises every super-droplet in a
+ * view of superdrops with size `get_maxnsupers()`.
+ *
+ * @tparam SDIC The type to check against the DeviceSuperdropInitConds concept.
+ */
+template <typename SDIC>
+concept DeviceSuperdropInitConds = requires(const SDIC sdic, const viewd_supers totsupers) {
+  { sdic.initialise_supers_on_device(totsupers) } -> std::same_as<void>;
+};
+
 /**
  * @brief Return an initialised view of superdrops in device memory.
  *
  * This function initialises a view of superdrops in device memory by creating
- * a view on the device and copying a host mirror view that is initialised using
- * the `SuperdropInitConds` instance.
+ * a view on the device and either generating the superdrops directly in it (if
+ * `SuperdropInitConds` satisfies the DeviceSuperdropInitConds concept) or copying a
+ * host mirror view that is initialised using the `SuperdropInitConds` instance.
  *
  * @tparam SuperdropInitConds The type of the super-droplets' initial conditions data.
  * @param sdic The instance of the super-droplets' initial conditions data.
@@ -106,10 +125,15 @@ void print_supers(const viewd_constsupers totsupers);
  * @tparam SuperdropInitConds The type of the super-droplets' initial conditions data.
  * @param sdic The instance of the super-droplets' initial conditions data.
  * @param gbxindex_max max value for superdroplet gridbox indexes (0 <= sdgbxindex < gbxindex)
+ * @param sort_method Method used to sort super-droplets by their gridbox indexes.
+ * @param max_capacity Ceiling on the number of super-droplets the view of super-droplets may grow
+ * to hold (initial capacity is given by sdic.get_maxnsupers()).
  * @return Struct for handling super-droplets in device memory.
  */
 template <typename SuperdropInitConds>
-SupersInDomain create_supers(const SuperdropInitConds& sdic, const unsigned int gbxindex_max) {
+SupersInDomain create_supers(const SuperdropInitConds& sdic, const unsigned int gbxindex_max,
+                             const SortSupersMethod sort_method = SortSupersMethod::counting_sort,
+                             const size_t max_capacity = std::numeric_limits<size_t>::max()) {
   Kokkos::Profiling::ScopedRegion region("init_supers");
 
   // Log message and create superdrops using the initial conditions
@@ -118,7 +142,7 @@ SupersInDomain create_supers(const SuperdropInitConds& sdic, const unsigned int
 
   // Log message and sort the view of superdrops
   std::cout << "sorting and finding superdrops in domain\n";
-  auto allsupers = SupersInDomain(totsupers, gbxindex_max);
+  auto allsupers = SupersInDomain(totsupers, gbxindex_max, sort_method, max_capacity);
 
 #ifndef NDEBUG
 
@@ -141,8 +165,9 @@ SupersInDomain create_supers(const SuperdropInitConds& sdic, const unsigned int
  * @brief Return an initialised view of superdrops in device memory.
  *
  * This function initialises a view of superdrops in device memory by creating
- * a view on the device and copying a host mirror view that is initialised using
- * the `SuperdropInitConds` instance.
+ * a view on the device and either generating the superdrops directly in it (if
+ * `SuperdropInitConds` satisfies the DeviceSuperdropInitConds concept) or copying a
+ * host mirror view that is initialised using the `SuperdropInitConds` instance.
  *
  * @tparam SuperdropInitConds The type of the super-droplets' initial conditions data.
  * @param sdic The instance of the super-droplets' initial conditions data.
@@ -153,11 +178,16 @@ viewd_supers initialise_supers(const SuperdropInitConds& sdic) {
   // create superdrops view on device
   auto totsupers = viewd_supers("totsupers", sdic.get_maxnsupers());
 
-  // initialise a mirror of superdrops view on host
-  auto h_totsupers = initialise_supers_on_host(sdic, totsupers);
+  if constexpr (DeviceSuperdropInitConds<SuperdropInitConds>) {
+    // generate superdrops directly in device memory
+    sdic.initialise_supers_on_device(totsupers);
+  } else {
+    // initialise a mirror of superdrops view on host
+    auto h_totsupers = initialise_supers_on_host(sdic, totsupers);
 
-  // Copy host view to device (h_totsupers to totsupers)
-  Kokkos::deep_copy(totsupers, h_totsupers);
+    // Copy host view to device (h_totsupers to totsupers)
+    Kokkos::deep_copy(totsupers, h_totsupers);
+  }
 
   return totsupers;
 }
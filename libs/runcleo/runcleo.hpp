@@ -25,6 +25,7 @@
 #include <Kokkos_Random.hpp>
 #include <concepts>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -71,8 +72,10 @@ class RunCLEO {
  private:
   const SDMMethods<GbxMaps, Microphys, M, T, BCs, Obs>& sdm;
   /**< SDMMethods object. */
-  CD& coupldyn;       /**< CoupledDynamics object.  */
-  const Comms& comms; /**< CouplingComms object. */
+  CD& coupldyn;                 /**< CoupledDynamics object.  */
+  const Comms& comms;           /**< CouplingComms object. */
+  SortSupersMethod sort_method; /**< Method for sorting super-droplets. */
+  size_t max_capacity;          /**< Ceiling on capacity of view for super-droplets. */
 
   /**
    * @brief Prepare SDM and Coupled Dynamics for timestepping.
@@ -155,6 +158,10 @@ class RunCLEO {
    * (e.g. to make observations), and 3) returning the size of the timestep to
    * take now given the current timestep `t_mdl`.
    *
+   * Kokkos::Profiling are null pointers unless a Kokkos profiler library has been
+   * exported to "KOKKOS_TOOLS_LIBS" prior to runtime so the lib gets dynamically loaded
+   * (or, for example, a PerformanceObserver is recording).
+   *
    * @param t_mdl Current timestep of the coupled model.
    * @param gbxs DualView of gridboxes.
    * @param allsupers View of all (inside and outside of domain) superdroplets.
@@ -169,7 +176,10 @@ class RunCLEO {
     }
 
     gbxs.sync_device();
-    sdm.at_start_step(t_mdl, gbxs, allsupers);
+    {
+      Kokkos::Profiling::ScopedRegion region("timestep_observations");
+      sdm.at_start_step(t_mdl, gbxs, allsupers);
+    }
 
     return get_next_step(t_mdl);
   }
@@ -273,10 +283,17 @@ class RunCLEO {
    * @param sdm SDMMethods object.
    * @param coupldyn CoupledDynamics object.
    * @param comms CouplingComms object.
+   * @param sort_method Method for sorting super-droplets (see SortSupersMethod).
+   * @param max_capacity Ceiling on capacity of view for super-droplets (see SupersInDomain).
    */
   RunCLEO(const SDMMethods<GbxMaps, Microphys, M, T, BCs, Obs>& sdm, CD& coupldyn,
-          const Comms& comms)
-      : sdm(sdm), coupldyn(coupldyn), comms(comms) {
+          const Comms& comms, const SortSupersMethod sort_method = SortSupersMethod::counting_sort,
+          const size_t max_capacity = std::numeric_limits<size_t>::max())
+      : sdm(sdm),
+        coupldyn(coupldyn),
+        comms(comms),
+        sort_method(sort_method),
+        max_capacity(max_capacity) {
     check_coupling();
   }
 
@@ -306,8 +323,8 @@ class RunCLEO {
 
     // create runtime objects and prepare CLEO for timestepping
     Kokkos::Profiling::pushRegion("init");
-    auto allsupers =
-        create_supers(initconds.initsupers, sdm.gbxmaps.get_local_ngridboxes_hostcopy());
+    const auto gbxindex_max = sdm.gbxmaps.get_local_ngridboxes_hostcopy();
+    auto allsupers = create_supers(initconds.initsupers, gbxindex_max, sort_method, max_capacity);
     auto gbxs = create_gbxs(sdm.gbxmaps, initconds.initgbxs, allsupers);
     prepare_to_timestep(gbxs, allsupers);
     Kokkos::Profiling::popRegion();
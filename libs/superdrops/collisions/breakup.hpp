@@ -25,6 +25,7 @@
 #include <concepts>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "../microphysicalprocess.hpp"
 #include "../superdrop.hpp"
@@ -72,11 +73,12 @@ struct DoBreakup {
    * @param prob Probability of collision.
    * @param phi_coll Random number in the range [0.0, 1.0] for collision.
    * @param phi_out Random number in the range [0.0, 1.0] for outcome of collision (not used).
-   * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+   * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+   * (0, 1 or 2) and kind of collision event which occured (if any).
    */
   KOKKOS_FUNCTION
-  size_t operator()(Superdrop& drop1, Superdrop& drop2, const double prob, const double phi_coll,
-                    const double phi_out) const;
+  CollisionOutcome operator()(Superdrop& drop1, Superdrop& drop2, const double prob,
+                              const double phi_coll, const double phi_out) const;
 
   /**
    * enact collisional-breakup of droplets by changing multiplicity, radius and solute mass of each
@@ -92,32 +94,37 @@ struct DoBreakup {
 /*
  * constructs Microphysical Process for collision-breakup of superdroplets with a constant timestep
  * 'interval' and probability of collision-breakup determined by 'collbuprob' with random seed
- * for the random number generator.
+ * for the random number generator. Pairs of superdroplets are sampled according to 'sampling'
+ * (see PairSampling).
  */
 template <PairProbability Probability, NFragments NFrags>
 inline MicrophysicalProcess auto CollBu(const unsigned int interval,
                                         const std::function<double(unsigned int)> int2realtime,
-                                        const Probability collbuprob, const NFrags nfrags) {
+                                        const Probability collbuprob, const NFrags nfrags,
+                                        const PairSampling sampling = PairSampling::direct) {
   const auto DELT = double{int2realtime(interval)};
 
   const DoBreakup bu(nfrags);
   const MicrophysicsFunc auto colls =
-      DoCollisions<Probability, DoBreakup<NFrags>>(DELT, collbuprob, bu);
+      DoCollisions<Probability, DoBreakup<NFrags>>(DELT, collbuprob, bu, sampling);
 
   return ConstTstepMicrophysics(interval, colls);
 }
 
-/* same as CollBu above but with fixed seed */
+/* same as CollBu above but with fixed seed and optionally a seed for each gridbox (see
+DoCollisions) */
 template <PairProbability Probability, NFragments NFrags>
 inline MicrophysicalProcess auto CollBu(const unsigned int interval,
                                         const std::function<double(unsigned int)> int2realtime,
                                         const Probability collbuprob, const NFrags nfrags,
-                                        const uint64_t seed) {
+                                        const uint64_t seed,
+                                        const PairSampling sampling = PairSampling::direct,
+                                        const std::vector<uint64_t>& gbxseeds = {}) {
   const auto DELT = double{int2realtime(interval)};
 
   const DoBreakup bu(nfrags);
   const MicrophysicsFunc auto colls =
-      DoCollisions<Probability, DoBreakup<NFrags>>(DELT, collbuprob, bu, seed);
+      DoCollisions<Probability, DoBreakup<NFrags>>(DELT, collbuprob, bu, seed, sampling, gbxseeds);
 
   return ConstTstepMicrophysics(interval, colls);
 }
@@ -135,19 +142,21 @@ inline MicrophysicalProcess auto CollBu(const unsigned int interval,
  * @param prob Probability of collision.
  * @param phi_coll Random number in the range [0.0, 1.0] for collision.
  * @param phi_out Random number in the range [0.0, 1.0] for outcome of collision (not used).
- * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+ * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+ * (0, 1 or 2) and kind of collision event which occured (if any).
  */
 template <NFragments NFrags>
-KOKKOS_FUNCTION size_t DoBreakup<NFrags>::operator()(Superdrop& drop1, Superdrop& drop2,
-                                                     const double prob, const double phi_coll,
-                                                     const double phi_out) const {
+KOKKOS_FUNCTION CollisionOutcome DoBreakup<NFrags>::operator()(Superdrop& drop1, Superdrop& drop2,
+                                                               const double prob,
+                                                               const double phi_coll,
+                                                               const double phi_out) const {
   /* enact collision-breakup on pair of superdroplets if
   gamma factor for collision-breakup is not zero */
   if (breakup_gamma(prob, phi_coll) != 0) {
-    return breakup_superdroplet_pair(drop1, drop2);
+    return {breakup_superdroplet_pair(drop1, drop2), CollisionKind::breakup};
   }
 
-  return 0;
+  return {0, CollisionKind::none};
 }
 
 /* calculates value of gamma factor in Monte Carlo
@@ -27,6 +27,7 @@
 #include <concepts>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "../microphysicalprocess.hpp"
 #include "../superdrop.hpp"
@@ -95,11 +96,12 @@ struct DoCoalBuRe {
    * @param phi Phi value.
    * @param drop1 First superdroplet.
    * @param drop2 Second superdroplet.
-   * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+   * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+   * (0, 1 or 2) and kind of collision event which occured (if any).
    */
   KOKKOS_FUNCTION
-  size_t coalesce_breakup_or_rebound(const uint64_t gamma, const double phi, Superdrop& drop1,
-                                     Superdrop& drop2) const;
+  CollisionOutcome coalesce_breakup_or_rebound(const uint64_t gamma, const double phi,
+                                               Superdrop& drop1, Superdrop& drop2) const;
 
  public:
   /**
@@ -128,11 +130,12 @@ struct DoCoalBuRe {
    * @param phi_coll Random number in the range [0.0, 1.0] for collision.
    * @param phi_out Random number in the range [0.0, 1.0] for outcome of collision as breakup,
    * rebound or coalescence.
-   * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+   * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+   * (0, 1 or 2) and kind of collision event which occured (if any).
    */
   KOKKOS_INLINE_FUNCTION
-  size_t operator()(Superdrop& drop1, Superdrop& drop2, const double prob, const double phi_coll,
-                    const double phi_out) const;
+  CollisionOutcome operator()(Superdrop& drop1, Superdrop& drop2, const double prob,
+                              const double phi_coll, const double phi_out) const;
 };
 
 /**
@@ -151,35 +154,40 @@ struct DoCoalBuRe {
  * @param collprob Probability of collisions.
  * @param nfrags Calculatino for number of fragments cases of breakup.
  * @param coalbure_flag Flag indicating the action to perform: coalescence, breakup or rebound.
+ * @param sampling Method for sampling which pairs of superdroplets collide (see PairSampling).
  * @return A Microphysical Process enacting collision- coalescence, breakup or rebound.
  */
 template <PairProbability Probability, NFragments NFrags, CoalBuReFlag Flag>
 inline MicrophysicalProcess auto CoalBuRe(const unsigned int interval,
                                           const std::function<double(unsigned int)> int2realtime,
                                           const Probability collprob, const NFrags nfrags,
-                                          const Flag coalbure_flag) {
+                                          const Flag coalbure_flag,
+                                          const PairSampling sampling = PairSampling::direct) {
   const auto DELT = double{int2realtime(interval)};
 
   const DoCoalBuRe<NFrags, Flag> coalbure(nfrags, coalbure_flag);
   const MicrophysicsFunc auto colls =
-      DoCollisions<Probability, DoCoalBuRe<NFrags, Flag>>(DELT, collprob, coalbure);
+      DoCollisions<Probability, DoCoalBuRe<NFrags, Flag>>(DELT, collprob, coalbure, sampling);
 
   return ConstTstepMicrophysics(interval, colls);
 }
 
 /**
- * same as CoalBuRe above but with fixed seed
+ * same as CoalBuRe above but with fixed seed and optionally a seed for each gridbox (see
+ * DoCollisions)
  */
 template <PairProbability Probability, NFragments NFrags, CoalBuReFlag Flag>
 inline MicrophysicalProcess auto CoalBuRe(const unsigned int interval,
                                           const std::function<double(unsigned int)> int2realtime,
                                           const Probability collprob, const NFrags nfrags,
-                                          const Flag coalbure_flag, const uint64_t seed) {
+                                          const Flag coalbure_flag, const uint64_t seed,
+                                          const PairSampling sampling = PairSampling::direct,
+                                          const std::vector<uint64_t>& gbxseeds = {}) {
   const auto DELT = double{int2realtime(interval)};
 
   const DoCoalBuRe<NFrags, Flag> coalbure(nfrags, coalbure_flag);
-  const MicrophysicsFunc auto colls =
-      DoCollisions<Probability, DoCoalBuRe<NFrags, Flag>>(DELT, collprob, coalbure, seed);
+  const MicrophysicsFunc auto colls = DoCollisions<Probability, DoCoalBuRe<NFrags, Flag>>(
+      DELT, collprob, coalbure, seed, sampling, gbxseeds);
 
   return ConstTstepMicrophysics(interval, colls);
 }
@@ -202,13 +210,15 @@ inline MicrophysicalProcess auto CoalBuRe(const unsigned int interval,
  * @param phi_coll Random number in the range [0.0, 1.0] for collision.
  * @param phi_out Random number in the range [0.0, 1.0] for outcome of collision as breakup,
  * rebound or coalescence.
- * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+ * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+ * (0, 1 or 2) and kind of collision event which occured (if any).
  */
 template <NFragments NFrags, CoalBuReFlag Flag>
-KOKKOS_FUNCTION size_t DoCoalBuRe<NFrags, Flag>::operator()(Superdrop& drop1, Superdrop& drop2,
-                                                            const double prob,
-                                                            const double phi_coll,
-                                                            const double phi_out) const {
+KOKKOS_FUNCTION CollisionOutcome DoCoalBuRe<NFrags, Flag>::operator()(Superdrop& drop1,
+                                                                      Superdrop& drop2,
+                                                                      const double prob,
+                                                                      const double phi_coll,
+                                                                      const double phi_out) const {
   /* 1. calculate gamma factor for collision  */
   const auto xi1 = drop1.get_xi();
   const auto xi2 = drop2.get_xi();
@@ -220,7 +230,7 @@ KOKKOS_FUNCTION size_t DoCoalBuRe<NFrags, Flag>::operator()(Superdrop& drop1, Su
     return coalesce_breakup_or_rebound(gamma, phi_out, drop1, drop2);
   }
 
-  return 0;
+  return {0, CollisionKind::none};
 }
 
 /**
@@ -235,24 +245,22 @@ KOKKOS_FUNCTION size_t DoCoalBuRe<NFrags, Flag>::operator()(Superdrop& drop1, Su
  * @param phi Phi value.
  * @param drop1 First superdroplet.
  * @param drop2 Second superdroplet.
- * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+ * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+ * (0, 1 or 2) and kind of collision event which occured (if any).
  */
 template <NFragments NFrags, CoalBuReFlag Flag>
-KOKKOS_FUNCTION size_t DoCoalBuRe<NFrags, Flag>::coalesce_breakup_or_rebound(
+KOKKOS_FUNCTION CollisionOutcome DoCoalBuRe<NFrags, Flag>::coalesce_breakup_or_rebound(
     const uint64_t gamma, const double phi, Superdrop& drop1, Superdrop& drop2) const {
   const auto flag = coalbure_flag(phi, drop1, drop2);
 
-  size_t null_sds = 0;
   switch (flag) {
     case 1:  // coalescence
-      null_sds = coal.coalesce_superdroplet_pair(gamma, drop1, drop2);
-      break;
+      return {coal.coalesce_superdroplet_pair(gamma, drop1, drop2), CollisionKind::coalescence};
     case 2:  // breakup
-      null_sds = bu.breakup_superdroplet_pair(drop1, drop2);
-      break;
+      return {bu.breakup_superdroplet_pair(drop1, drop2), CollisionKind::breakup};
+    default:  // rebound
+      return {0, CollisionKind::rebound};
   }
-
-  return null_sds;
 }
 
 #endif  // LIBS_SUPERDROPS_COLLISIONS_COALBURE_HPP_
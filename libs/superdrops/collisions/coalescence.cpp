@@ -34,11 +34,13 @@
  * @param prob The probability of collision-coalescence.
  * @param phi_coll Random number in the range [0.0, 1.0] for collision.
  * @param phi_out Random number in the range [0.0, 1.0] for outcome of collision (not used).
- * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+ * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+ * (0, 1 or 2) and kind of collision event which occured (if any).
  */
-KOKKOS_FUNCTION size_t DoCoalescence::operator()(Superdrop& drop1, Superdrop& drop2,
-                                                 const double prob, const double phi_coll,
-                                                 const double phi_out) const {
+KOKKOS_FUNCTION CollisionOutcome DoCoalescence::operator()(Superdrop& drop1, Superdrop& drop2,
+                                                           const double prob,
+                                                           const double phi_coll,
+                                                           const double phi_out) const {
   /* 1. calculate gamma factor for collision-coalescence  */
   const auto xi1 = drop1.get_xi();
   const auto xi2 = drop2.get_xi();
@@ -47,10 +49,10 @@ KOKKOS_FUNCTION size_t DoCoalescence::operator()(Superdrop& drop1, Superdrop& dr
   /* 2. enact collision-coalescence on pair
   of superdroplets if gamma is not zero */
   if (gamma != 0) {
-    return coalesce_superdroplet_pair(gamma, drop1, drop2);
+    return {coalesce_superdroplet_pair(gamma, drop1, drop2), CollisionKind::coalescence};
   }
 
-  return 0;
+  return {0, CollisionKind::none};
 }
 
 /**
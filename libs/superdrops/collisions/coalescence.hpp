@@ -23,6 +23,7 @@
 #include <Kokkos_Core.hpp>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "../../cleoconstants.hpp"
 #include "../microphysicalprocess.hpp"
@@ -81,11 +82,12 @@ struct DoCoalescence {
    * @param prob The probability of collision-coalescence.
    * @param phi_coll Random number in the range [0.0, 1.0] for collision.
    * @param phi_out Random number in the range [0.0, 1.0] for outcome of collision (not used).
-   * @return Resulting total number of null (xi=0) superdroplets from collision (i.e. 0, 1 or 2)
+   * @return Outcome of collision, i.e. number of null (xi=0) superdroplets resulting from collision
+   * (0, 1 or 2) and kind of collision event which occured (if any).
    */
   KOKKOS_FUNCTION
-  size_t operator()(Superdrop& drop1, Superdrop& drop2, const double prob, const double phi_coll,
-                    const double phi_out) const;
+  CollisionOutcome operator()(Superdrop& drop1, Superdrop& drop2, const double prob,
+                              const double phi_coll, const double phi_out) const;
 
   /**
    * @brief Calculates the value of the gamma factor in Monte Carlo collision-coalescence.
@@ -128,33 +130,38 @@ struct DoCoalescence {
  * @param interval The constant timestep interval.
  * @param int2realtime A function that converts an integer timestep to real time.
  * @param collcoalprob The probability of collision-coalescence.
+ * @param sampling Method for sampling which pairs of superdroplets collide (see PairSampling).
  * @return An instance of MicrophysicalProcess for collision-coalescence.
  */
 template <PairProbability Probability>
 inline MicrophysicalProcess auto CollCoal(const unsigned int interval,
                                           const std::function<double(unsigned int)> int2realtime,
-                                          const Probability collcoalprob) {
+                                          const Probability collcoalprob,
+                                          const PairSampling sampling = PairSampling::direct) {
   const auto DELT = int2realtime(interval);
 
   const DoCoalescence coal{};
   const MicrophysicsFunc auto colls =
-      DoCollisions<Probability, DoCoalescence>(DELT, collcoalprob, coal);
+      DoCollisions<Probability, DoCoalescence>(DELT, collcoalprob, coal, sampling);
 
   return ConstTstepMicrophysics(interval, colls);
 }
 
 /**
- * same as CollCoal above but with fixed seed
+ * same as CollCoal above but with fixed seed and optionally a seed for each gridbox (see
+ * DoCollisions)
  */
 template <PairProbability Probability>
 inline MicrophysicalProcess auto CollCoal(const unsigned int interval,
                                           const std::function<double(unsigned int)> int2realtime,
-                                          const Probability collcoalprob, const uint64_t seed) {
+                                          const Probability collcoalprob, const uint64_t seed,
+                                          const PairSampling sampling = PairSampling::direct,
+                                          const std::vector<uint64_t>& gbxseeds = {}) {
   const auto DELT = int2realtime(interval);
 
   const DoCoalescence coal{};
   const MicrophysicsFunc auto colls =
-      DoCollisions<Probability, DoCoalescence>(DELT, collcoalprob, coal, seed);
+      DoCollisions<Probability, DoCoalescence>(DELT, collcoalprob, coal, seed, sampling, gbxseeds);
 
   return ConstTstepMicrophysics(interval, colls);
 }
@@ -23,7 +23,10 @@
 #include <Kokkos_NestedSort.hpp>
 #include <Kokkos_Random.hpp>
 #include <concepts>
+#include <cstdint>
 #include <random>
+#include <stdexcept>
+#include <vector>
 
 #include "../../cleoconstants.hpp"
 #include "../kokkosaliases_sd.hpp"
@@ -51,19 +54,66 @@ concept PairProbability = requires(P p, Superdrop& drop, double d) {
   { p(drop, drop, d, d) } -> std::convertible_to<double>;
 };
 
+/**
+ * @brief Concept for PairProbability objects which can also return an upper bound (majorant) on
+ * the probability of collision of any pair of droplets no larger than a given (largest) droplet.
+ *
+ * Object has majorant(largest_drop, DELT, VOLUME) function which returns a value >= prob_jk for
+ * all pairs of droplets with radii <= the radius of largest_drop. The majorant should be cheap
+ * to calculate compared to prob_jk, e.g. by avoiding terminal velocity calculations.
+ *
+ * @tparam P The type representing the pair probability object.
+ */
+template <typename P>
+concept MajorantPairProbability = PairProbability<P> && requires(P p, Superdrop& drop, double d) {
+  { p.majorant(drop, d, d) } -> std::convertible_to<double>;
+};
+
+/**
+ * @brief Method for sampling which pairs of superdroplets collide.
+ *
+ * direct = calculate the probability of collision of every pair of superdroplets.
+ * majorant = first compare each pair's random number with an upper bound on its (scaled)
+ * probability of collision, calculated from a cheap majorant for the gridbox (see
+ * MajorantPairProbability), and only calculate the exact probability of collision if the pair is
+ * not rejected. Majorant sampling is only used for pairs whose upper bound is < 1, meaning
+ * rejected pairs are exactly those which would not collide anyway, i.e. the outcome is identical
+ * to direct sampling.
+ */
+enum class PairSampling { direct, majorant };
+
+/**
+ * @brief Kind of collision event enacted (if any) between a pair of superdroplets.
+ */
+enum class CollisionKind : unsigned int {
+  none = 0,        /**< no collision event */
+  coalescence = 1, /**< collision-coalescence */
+  breakup = 2,     /**< collision-breakup */
+  rebound = 3      /**< collision-rebound */
+};
+
+/**
+ * @brief Outcome of (possible) collision event between a pair of superdroplets.
+ */
+struct CollisionOutcome {
+  size_t nnulls;      /**< no. null (xi=0) superdroplets resulting from collision (0, 1 or 2) */
+  CollisionKind kind; /**< kind of collision event which occured (none if no collision) */
+};
+
 /**
  * @brief Concept for objects that enact a sucessful collision event between two superdroplets, e.g.
  * to model the coalscence and/or rebound and/or breakup of two superdroplets.
  *
  * Object (has operator that) enacts a collision-X event between two superdroplets. For example it
  * may enact collision-coalescence of a pair of superdroplets by changing the multiplicity,
- * radius and solute mass of each superdroplet in the pair.
+ * radius and solute mass of each superdroplet in the pair. Returns the outcome of the collision,
+ * i.e. the number of null superdroplets and the kind of collision event enacted (if any).
  *
  * @tparam X The type representing the pair enactment object.
  */
 template <typename X>
 concept PairEnactX = requires(X x, Superdrop& drop, double d) {
-  { x(drop, drop, d, d, d) } -> std::convertible_to<size_t>;
+  { x(drop, drop, d, d, d) } -> std::convertible_to<CollisionOutcome>;
 };
 
 /*
@@ -76,8 +126,11 @@ struct CollideSupersFunctor {
   const Probability& probability;        /**< Object for calculating collision probabilities. */
   const EnactCollision& enact_collision; /**< Enactment object for enacting collision events. */
   const GenRandomPool genpool;           /**< Kokkos thread-safe random number generator pool.*/
-  const subviewd_supers supers;          /**< The randomly shuffled view of super-droplets. */
+  const bool is_keyed; /**< true = counter-based random numbers from gbxkey, false = genpool */
+  const uint64_t gbxkey;        /**< key for counter-based random numbers of gridbox */
+  const subviewd_supers supers; /**< The randomly shuffled view of super-droplets. */
   const double scale_p;                  /**< The probability scaling factor. */
+  const double prob_majorant; /**< upper bound on prob_jk for any pair (< 0.0 means no bound) */
   const double DELT;   /**< time interval [s] over which probability of collision is calculated. */
   const double VOLUME; /**< The volume [m^-3]. */
 
@@ -125,47 +178,111 @@ struct CollideSupersFunctor {
     return prob;
   }
 
+  /**
+   * @brief Returns true if pair is certain not to collide given an upper bound on the probability
+   * of collision, prob_majorant, for any pair of super-droplets.
+   *
+   * Scaled upper bound is calculated like the scaled probability of collision. If this is < 1,
+   * collision only occurs if phi_coll < scaled probability (see e.g. DoCoalescence), hence there
+   * is certainly no collision if phi_coll >= scaled upper bound.
+   *
+   * @param drop1 The super-droplet with the larger multiplicity of the pair.
+   * @param phi_coll Random number in the range [0.0, 1.0] for collision.
+   * @return true if pair is rejected (certainly no collision), false otherwise.
+   */
+  KOKKOS_INLINE_FUNCTION bool is_rejected(const Superdrop& drop1, const double phi_coll) const {
+    if (prob_majorant < 0.0) {
+      return false;
+    }
+    const auto large_xi = static_cast<double>(drop1.get_xi());  // casting to double (!)
+    const auto bound = double{scale_p * large_xi * prob_majorant};
+    return (bound < 1.0 && phi_coll >= bound);
+  }
+
+  /**
+   * @brief Returns random number generator for the jj'th pair of super-droplets, either from the
+   * pool or counter-based with the gridbox's key.
+   *
+   * @param jj The index of the pair of super-droplets.
+   * @return The random number generator.
+   */
+  KOKKOS_INLINE_FUNCTION URBG<ExecSpace> get_urbg(const size_t jj) const {
+    if (is_keyed) {
+      return counter_urbg<ExecSpace>(gbxkey, jj + 1);  // counter 0 is for shuffling
+    }
+    return URBG<ExecSpace>{genpool.get_state()};
+  }
+
+  /**
+   * @brief Returns state of random number generator to the pool (if it is from the pool).
+   *
+   * @param urbg The random number generator.
+   */
+  KOKKOS_INLINE_FUNCTION void free_urbg(const URBG<ExecSpace>& urbg) const {
+    if (!is_keyed) {
+      genpool.free_state(urbg.gen);
+    }
+  }
+
   /**
    * @brief Performs collision event for a pair of superdroplets.
    *
    * Monte Carlo Routine from Shima et al. 2009 for collision-coalescence generalised to any
-   * collision-[X] process for a pair of super-droplets.
+   * collision-[X] process for a pair of super-droplets. If there is an upper bound on the
+   * probability of collision (i.e. majorant sampling), pairs which are certain not to collide are
+   * rejected without calculating their probability of collision.
    *
+   * @param jj The index of the pair of superdroplets.
    * @param dropA The first superdroplet.
    * @param dropB The second superdroplet.
    * @param scale_p The probability scaling factor.
    * @param VOLUME The volume [m^-3].
-   * @return True if the collision event results in null superdrops with xi=0, otherwise false.
+   * @return Outcome of collision, i.e. number of null superdrops with xi=0 resulting from
+   * collision and kind of collision event enacted (if any).
    */
-  KOKKOS_INLINE_FUNCTION size_t collide_superdroplet_pair(Superdrop& dropA, Superdrop& dropB,
-                                                          const double scale_p,
-                                                          const double VOLUME) const {
+  KOKKOS_INLINE_FUNCTION CollisionOutcome collide_superdroplet_pair(const size_t jj,
+                                                                    Superdrop& dropA,
+                                                                    Superdrop& dropB,
+                                                                    const double scale_p,
+                                                                    const double VOLUME) const {
     /* 1. assign references to each superdrop in pair that will collide
     such that (drop1.xi) >= (drop2.xi) */
     const auto drops = assign_drops(dropA, dropB);  // {drop1, drop2}
 
-    /* 2. calculate scaled probability of collision for pair of superdroplets */
-    const auto prob = scaled_probability(drops.first, drops.second, scale_p, VOLUME);
-
-    /* 3. Monte Carlo Step: use random number to enact (or not) collision of superdroplets pair */
+    /* 2. generate random numbers for Monte Carlo step */
     /* TODO(CB): move phi_out generation into coalbure? */
-    URBG<ExecSpace> urbg{genpool.get_state()};   // thread safe random number generator
+    URBG<ExecSpace> urbg = get_urbg(jj);         // thread safe random number generator
     const auto phi_coll = urbg.drand(0.0, 1.0);  // random number in range [0.0, 1.0] for collision
     const auto phi_out = urbg.drand(0.0, 1.0);  // for outcome of collisions extended algorithm only
-    genpool.free_state(urbg.gen);
+    free_urbg(urbg);
+
+    /* 3. (optional) reject pair if it certainly does not collide */
+    if (is_rejected(drops.first, phi_coll)) {
+      return {0, CollisionKind::none};
+    }
 
+    /* 4. calculate scaled probability of collision for pair of superdroplets */
+    const auto prob = scaled_probability(drops.first, drops.second, scale_p, VOLUME);
+
+    /* 5. Monte Carlo Step: use random number to enact (or not) collision of superdroplets pair */
     return enact_collision(drops.first, drops.second, prob, phi_coll, phi_out);
   }
 
   /*
    * operator for functor with parallel (TeamThreadRangePolicy) loop over superdroplet pairs
-   * in supers view in order to call collide_superdroplet_pair.
+   * in supers view in order to call collide_superdroplet_pair. Reduces number of null
+   * superdroplets and number of collision events of each kind (for monitoring).
    *
    */
-  KOKKOS_INLINE_FUNCTION void operator()(const size_t jj, size_t& oob_nsupers) const {
+  KOKKOS_INLINE_FUNCTION void operator()(const size_t jj, size_t& oob_nsupers, uint64_t& ncolls,
+                                         uint64_t& ncoals, uint64_t& nbreakups) const {
     const auto kk = size_t{jj * 2};
-    const auto null_supers = collide_superdroplet_pair(supers(kk), supers(kk + 1), scale_p, VOLUME);
-    oob_nsupers += null_supers;
+    const auto outcome =
+        collide_superdroplet_pair(jj, supers(kk), supers(kk + 1), scale_p, VOLUME);
+    oob_nsupers += outcome.nnulls;
+    ncolls += (outcome.kind != CollisionKind::none);
+    ncoals += (outcome.kind == CollisionKind::coalescence);
+    nbreakups += (outcome.kind == CollisionKind::breakup);
   }
 };
 
@@ -181,7 +298,11 @@ struct DoCollisions {
   double DELT; /**< time interval [s] over which probability of collision is calculated. */
   Probability probability; /**< Probability object for calculating collision probabilities. */
   EnactCollision enact_collision; /**< Enactment object for enacting collision events. */
+  using viewd_gbxseeds = Kokkos::View<uint64_t*>;
+  uint64_t seed;                  /**< seed for random number generators */
   GenRandomPool genpool;          /**< Kokkos thread-safe random number generator pool.*/
+  PairSampling sampling;          /**< Method for sampling which pairs of superdroplets collide. */
+  viewd_gbxseeds gbxseeds;        /**< (optional) seed for each gridbox (see gridbox_key) */
 
   /* helper structure in case of null superdroplets
    * superdroplet a precedes b if its sdgbxindex is smaller
@@ -193,6 +314,89 @@ struct DoCollisions {
     }
   };
 
+  /**
+   * @brief Copies seed for each gridbox into device memory.
+   *
+   * @param seeds The seed for each gridbox (in order of local gridbox index).
+   * @return The seeds in device memory.
+   */
+  static viewd_gbxseeds copy_gbxseeds(const std::vector<uint64_t>& seeds) {
+    auto d_seeds = viewd_gbxseeds("collisions_gbxseeds", seeds.size());
+    auto h_seeds = Kokkos::create_mirror_view(d_seeds);
+    for (size_t ii(0); ii < seeds.size(); ++ii) {
+      h_seeds(ii) = seeds.at(ii);
+    }
+    Kokkos::deep_copy(d_seeds, h_seeds);
+    return d_seeds;
+  }
+
+  /**
+   * @brief Key for the counter-based random numbers of the gridbox of a team at a given time.
+   *
+   * Key is a hash of the seed, the gridbox's own seed, the (local) index of the gridbox and the
+   * time, so the random numbers for collisions in a gridbox depend only on these and not on the
+   * other gridboxes or on the number of threads (e.g. each member of an ensemble of box models
+   * can be seeded independently).
+   *
+   * @param team_member The Kokkos team member (for the gridbox with index league_rank).
+   * @param subt The current time.
+   * @return The key.
+   */
+  KOKKOS_INLINE_FUNCTION uint64_t gridbox_key(const TeamMember& team_member,
+                                              const unsigned int subt) const {
+    const auto ii = static_cast<size_t>(team_member.league_rank());
+    auto key = splitmix64(seed ^ splitmix64(gbxseeds(ii)));
+    key = splitmix64(key ^ ii);
+    return splitmix64(key ^ subt);
+  }
+
+  /**
+   * @brief Throws error if majorant sampling is requested but probability object has no majorant.
+   */
+  void check_sampling() const {
+    if (sampling == PairSampling::majorant && !MajorantPairProbability<Probability>) {
+      throw std::invalid_argument("majorant sampling of collisions requires a PairProbability "
+                                  "with a majorant (see MajorantPairProbability concept)");
+    }
+  }
+
+  /**
+   * @brief Upper bound on the probability of collision, prob_jk, of any pair of super-droplets in
+   * supers view for majorant sampling.
+   *
+   * Bound is the majorant of the probability object given the super-droplet with the largest
+   * radius. Function uses Kokkos nested parallelism for reduction over supers inside parallelised
+   * loop for member 'teamMember'. Returns -1.0 (i.e. no bound) if pairs are sampled directly.
+   *
+   * @param team_member The Kokkos team member.
+   * @param supers The view of super-droplets.
+   * @param VOLUME The volume [m^-3].
+   * @return Upper bound on prob_jk (or -1.0 if there is no bound).
+   */
+  KOKKOS_INLINE_FUNCTION double majorant_probability(const TeamMember& team_member,
+                                                     const subviewd_supers supers,
+                                                     const double VOLUME) const {
+    if constexpr (MajorantPairProbability<Probability>) {
+      const auto nsupers = static_cast<size_t>(supers.extent(0));
+      if (sampling == PairSampling::majorant && nsupers > 0) {
+        using MaxLoc = Kokkos::MaxLoc<double, size_t>;
+        auto largest = typename MaxLoc::value_type{};
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(team_member, nsupers),
+            [&](const size_t kk, typename MaxLoc::value_type& ml) {
+              const auto radius = supers(kk).get_radius();
+              if (radius > ml.val) {
+                ml.val = radius;
+                ml.loc = kk;
+              }
+            },
+            MaxLoc(largest));
+        return probability.majorant(supers(largest.loc), DELT, VOLUME);
+      }
+    }
+    return -1.0;
+  }
+
   /**
    * @brief Performs collisions between super-droplets in supers view.
    *
@@ -207,24 +411,40 @@ struct DoCollisions {
    * _NOTE:_ function assumes supers is already randomly shuffled and these superdrops are
    * colliding some 'VOLUME' [m^3]).
    *
+   * Number of collision events (of any kind), number of those which were coalescence or breakup,
+   * and the number of null superdroplets produced, are reduced over the team and passed to the
+   * monitor.
+   *
    * @param team_member The Kokkos team member.
    * @param supers The randomly shuffled view of super-droplets.
    * @param volume The volume in which to calculate the probability of collisions.
+   * @param gbxkey Key of gridbox for counter-based random numbers (if seeded per gridbox).
+   * @param mo Monitor of SDM processes.
    * @return Total number of null (xi=0) superdrops produced by collisions.
    */
   KOKKOS_INLINE_FUNCTION size_t collide_supers(const TeamMember& team_member,
-                                               subviewd_supers supers, const double volume) const {
+                                               subviewd_supers supers, const double volume,
+                                               const uint64_t gbxkey,
+                                               const SDMMonitor auto mo) const {
     const auto nsupers = static_cast<size_t>(supers.extent(0));
     const auto npairs = size_t{nsupers / 2};  // no. pairs of superdrops (=floor() for nsupers > 0)
     const auto scale_p = double{nsupers * (nsupers - 1.0) / (2.0 * npairs)};
     const auto VOLUME = double{volume * dlc::VOL0};  // volume in which collisions occur [m^3]
+    const auto prob_majorant = majorant_probability(team_member, supers, VOLUME);
 
     auto oob_nsupers = size_t{0};
-    const auto functor =
-        CollideSupersFunctor{probability, enact_collision, genpool, supers, scale_p, DELT, VOLUME};
-    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team_member, npairs), functor, oob_nsupers);
+    auto ncolls = uint64_t{0};
+    auto ncoals = uint64_t{0};
+    auto nbreakups = uint64_t{0};
+    const auto is_keyed = (gbxseeds.extent(0) > 0);
+    const auto functor = CollideSupersFunctor{probability, enact_collision, genpool, is_keyed,
+                                              gbxkey, supers, scale_p, prob_majorant, DELT, VOLUME};
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team_member, npairs), functor, oob_nsupers,
+                            ncolls, ncoals, nbreakups);
     team_member.team_barrier();  // synchronise threads
 
+    mo.monitor_collisions(team_member, ncolls, ncoals, nbreakups, oob_nsupers);
+
     return oob_nsupers;
   }
 
@@ -253,22 +473,33 @@ struct DoCollisions {
    * Superdroplet collision algorithm adapted from collision-coalescence in Shima et al. 2009.
    * This function shuffles supers to get random pairs of superdroplets (SDs) and then calls the
    * collision function for each pair assuming these superdrops are colliding some 'VOLUME' [m^3].
-   * Function is designed to be called inside a parallelised loop for member 'teamMember'.
+   * Function is designed to be called inside a parallelised loop for member 'teamMember'. If there
+   * is a seed for each gridbox, random numbers are counter-based with the gridbox's key (see
+   * gridbox_key), otherwise they are drawn from the pool.
    *
    * @param team_member The Kokkos team member.
+   * @param subt The current time.
    * @param supers The view of super-droplets.
    * @param volume The volume in which to calculate the probability of collisions.
+   * @param mo Monitor of SDM processes.
    * @return The updated superdroplets.
    */
   KOKKOS_INLINE_FUNCTION subviewd_supers do_collisions(const TeamMember& team_member,
-                                                       subviewd_supers supers,
-                                                       const double volume) const {
+                                                       const unsigned int subt,
+                                                       subviewd_supers supers, const double volume,
+                                                       const SDMMonitor auto mo) const {
     /* Randomly shuffle order of superdroplet objects
     in supers in order to generate random pairs */
-    supers = shuffle_supers(team_member, supers, genpool);
+    const auto is_keyed = (gbxseeds.extent(0) > 0);
+    const auto gbxkey = is_keyed ? gridbox_key(team_member, subt) : uint64_t{0};
+    if (is_keyed) {
+      supers = shuffle_supers(team_member, supers, gbxkey);
+    } else {
+      supers = shuffle_supers(team_member, supers, genpool);
+    }
 
     /* collide all randomly generated pairs of SDs */
-    const auto oob_nsupers = collide_supers(team_member, supers, volume);
+    const auto oob_nsupers = collide_supers(team_member, supers, volume, gbxkey, mo);
 
     if (oob_nsupers == 0) {
       return supers;
@@ -288,18 +519,43 @@ struct DoCollisions {
    * @param DELT Time interval [s] over which probability of collision is calculated.
    * @param p The probability object for calculating the probability of a collision.
    * @param x The enactment object for enacting collision events.
+   * @param sampling Method for sampling which pairs of superdroplets collide (see PairSampling).
    */
-  DoCollisions(const double DELT, Probability p, EnactCollision x)
-      : DELT(DELT), probability(p), enact_collision(x), genpool(std::random_device {}()) {}
+  DoCollisions(const double DELT, Probability p, EnactCollision x,
+               const PairSampling sampling = PairSampling::direct)
+      : DELT(DELT),
+        probability(p),
+        enact_collision(x),
+        seed(std::random_device {}()),
+        genpool(seed),
+        sampling(sampling),
+        gbxseeds("collisions_gbxseeds", 0) {
+    check_sampling();
+  }
 
   /**
    * @brief Constructs a DoCollisions object with a fixed seed for the random number generator.
    *
    * same as DoCollisions constructor above, except that genpool is initialised
    * with a fixed seed for the random number generator (for reproducibility).
+   *
+   * Optionally a seed can be given for each gridbox (in order of local gridbox index), e.g. for
+   * each member of an ensemble of box models. Random numbers are then counter-based (see
+   * gridbox_key) rather than drawn from genpool, so they are reproducible for any number of
+   * threads and independent in each gridbox.
    */
-  DoCollisions(const double DELT, Probability p, EnactCollision x, const uint64_t seed)
-      : DELT(DELT), probability(p), enact_collision(x), genpool(seed) {}
+  DoCollisions(const double DELT, Probability p, EnactCollision x, const uint64_t seed,
+               const PairSampling sampling = PairSampling::direct,
+               const std::vector<uint64_t>& gbxseeds = {})
+      : DELT(DELT),
+        probability(p),
+        enact_collision(x),
+        seed(seed),
+        genpool(seed),
+        sampling(sampling),
+        gbxseeds(copy_gbxseeds(gbxseeds)) {
+    check_sampling();
+  }
 
   /**
    * @brief Operator used as an "adaptor" for using collisions as the MicrophysicsFunction type for
@@ -322,7 +578,7 @@ struct DoCollisions {
                                                     const unsigned int subt, subviewd_supers supers,
                                                     const State& state,
                                                     const SDMMonitor auto mo) const {
-    return do_collisions(team_member, supers, state.get_volume());
+    return do_collisions(team_member, subt, supers, state.get_volume(), mo);
   }
 };
 
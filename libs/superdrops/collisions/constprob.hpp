@@ -46,6 +46,12 @@ struct ConstProb {
                     const double VOLUME) const {
     return kernel * DELT / VOLUME;  // prob_jk * time interval / volume [s/m^3]
   }
+
+  /* returns (exact) upper bound on the probability that any pair of droplets collide */
+  KOKKOS_INLINE_FUNCTION
+  double majorant(const Superdrop &largest_drop, const double DELT, const double VOLUME) const {
+    return kernel * DELT / VOLUME;
+  }
 };
 
 #endif  // LIBS_SUPERDROPS_COLLISIONS_CONSTPROB_HPP_
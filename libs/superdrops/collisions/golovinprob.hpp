@@ -47,6 +47,14 @@ struct GolovinProb {
   KOKKOS_FUNCTION
   double operator()(const Superdrop &drop1, const Superdrop &drop2, const double DELT,
                     const double VOLUME) const;
+
+  /* returns upper bound on the probability of coalescence of any pair of droplets
+  with radii no larger than that of largest_drop, i.e. with volumes <= largest_drop.vol() */
+  KOKKOS_FUNCTION
+  double majorant(const Superdrop &largest_drop, const double DELT, const double VOLUME) const {
+    const auto DELT_DELVOL = double{DELT / VOLUME};
+    return prob_jk_const * (2.0 * largest_drop.vol()) * DELT_DELVOL;
+  }
 };
 
 #endif  // LIBS_SUPERDROPS_COLLISIONS_GOLOVINPROB_HPP_
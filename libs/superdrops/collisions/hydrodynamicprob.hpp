@@ -64,6 +64,21 @@ struct HydrodynamicProb {
 
     return prob_jk;
   }
+
+  /* returns upper bound on the probability that any pair of droplets with radii no larger than
+  that of largest_drop collide, given an upper bound on their efficiency factor, eff_max.
+  Assumes terminal velocity is non-negative and monotonically increasing with radius such that
+  |v1-v2| <= terminalv(largest_drop) and (r1 + r2)^2 <= (2 * largest_drop radius)^2 */
+  KOKKOS_FUNCTION
+  double majorant(const Superdrop &largest_drop, const double eff_max, const double DELT,
+                  const double VOLUME) const {
+    const auto DELT_DELVOL = double{DELT / VOLUME};
+    const auto sumr = double{2.0 * largest_drop.get_radius()};
+    const auto vmax = double{Kokkos::abs(terminalv(largest_drop))};
+    const auto hydro_kernel = double{prob_jk_const * eff_max * sumr * sumr * vmax};
+
+    return hydro_kernel * DELT_DELVOL;
+  }
 };
 
 #endif  // LIBS_SUPERDROPS_COLLISIONS_HYDRODYNAMICPROB_HPP_
@@ -46,3 +46,20 @@ double LongHydroProb::kerneleff(const Superdrop &drop1, const Superdrop &drop2)
 
   return eff;
 }
+
+/* returns upper bound on the efficiency of collision-coalescence, eff, for any pair of droplets
+  with radii no larger than rmax. For rbig < rlim, colleff <= max(k1 * rbig^2, colleff_min)
+  (see kerneleff), otherwise colleff = 1. */
+KOKKOS_FUNCTION
+double LongHydroProb::max_kerneleff(const double rmax) const {
+  constexpr double k1 = 4.5e4 * dlc::R0 * dlc::R0 * 100 * 100;
+  constexpr double rlim = 5e-5 / dlc::R0;
+  constexpr double colleff_min = 0.001;
+
+  auto colleff_max = double{Kokkos::fmax(1.0, k1 * rlim * rlim)};
+  if (rmax < rlim) {
+    colleff_max = Kokkos::fmax(k1 * rmax * rmax, colleff_min);
+  }
+
+  return colleff_max * coaleff;
+}
@@ -48,6 +48,11 @@ struct LongHydroProb {
   KOKKOS_FUNCTION
   double kerneleff(const Superdrop &drop1, const Superdrop &drop2) const;
 
+  /* returns upper bound on the efficiency of collision-coalescence, eff, for any pair of droplets
+  with radii no larger than rmax */
+  KOKKOS_FUNCTION
+  double max_kerneleff(const double rmax) const;
+
  public:
   LongHydroProb() : hydroprob(SimmelTerminalVelocity{}), coaleff(1.0) {}
 
@@ -63,6 +68,15 @@ struct LongHydroProb {
     const auto eff = kerneleff(drop1, drop2);
     return hydroprob(drop1, drop2, eff, DELT, VOLUME);
   }
+
+  /* returns upper bound on the probability of collision-coalescence of any
+  pair of droplets with radii no larger than that of largest_drop (see
+  HydrodynamicProb::majorant) */
+  KOKKOS_FUNCTION
+  double majorant(const Superdrop &largest_drop, const double DELT, const double VOLUME) const {
+    const auto eff_max = max_kerneleff(largest_drop.get_radius());
+    return hydroprob.majorant(largest_drop, eff_max, DELT, VOLUME);
+  }
 };
 
 #endif  // LIBS_SUPERDROPS_COLLISIONS_LONGHYDROPROB_HPP_
@@ -117,6 +117,13 @@ struct LowListCoalProb {
                     const double VOLUME) const {
     return longprob(drop1, drop2, DELT, VOLUME) * coaleff(drop1, drop2);
   }
+
+  /* returns upper bound on the probability of collision-coalescence of any pair of droplets
+  with radii no larger than that of largest_drop, i.e. Long's majorant since coaleff <= 1 */
+  KOKKOS_FUNCTION
+  double majorant(const Superdrop& largest_drop, const double DELT, const double VOLUME) const {
+    return longprob.majorant(largest_drop, DELT, VOLUME);
+  }
 };
 
 /* Probability of collision-breakup of a pair of
@@ -150,6 +157,13 @@ struct LowListBuProb {
     const auto longprob = double{ll.get_longprob(drop1, drop2, DELT, VOLUME)};
     return longprob * bueff;
   }
+
+  /* returns upper bound on the probability of collision-breakup of any pair of droplets
+  with radii no larger than that of largest_drop, i.e. Long's majorant since bueff <= 1 */
+  KOKKOS_FUNCTION
+  double majorant(const Superdrop& largest_drop, const double DELT, const double VOLUME) const {
+    return ll.majorant(largest_drop, DELT, VOLUME);
+  }
 };
 
 #endif  // LIBS_SUPERDROPS_COLLISIONS_LOWLISTPROB_HPP_
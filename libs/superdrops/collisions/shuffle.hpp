@@ -45,6 +45,21 @@
  */
 KOKKOS_FUNCTION viewd_supers shuffle_supers(const TeamMember& team_member,
                                             const viewd_supers supers, const GenRandomPool genpool);
+
+/**
+ * @brief Randomly shuffles the order of super-droplet objects in a view using Fisher-Yates
+ * algorithm and a counter-based random number generator.
+ *
+ * Same as shuffle_supers above except random numbers are drawn from a generator seeded by 'key'
+ * (see counter_urbg) rather than from a pool, so the shuffle depends only on the key.
+ *
+ * @param team_member The Kokkos team member.
+ * @param supers The view of superdroplets to shuffle.
+ * @param key The key for the random number generator.
+ * @return The shuffled view of superdroplets.
+ */
+KOKKOS_FUNCTION viewd_supers shuffle_supers(const TeamMember& team_member,
+                                            const viewd_supers supers, const uint64_t key);
 /**
  * @brief Swaps the values of two super-droplets.
  *
@@ -70,4 +70,35 @@ struct URBG {
   }
 };
 
+/**
+ * @brief SplitMix64 finaliser which hashes an integer (e.g. a seed or a counter) into a
+ * well-mixed 64-bit unsigned integer.
+ *
+ * @param x The integer to hash.
+ * @return The hashed integer.
+ */
+KOKKOS_INLINE_FUNCTION uint64_t splitmix64(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Returns a URBG whose random number generator is seeded by hashing a key and a counter.
+ *
+ * Generator is counter-based, i.e. its random numbers depend only on the key and the counter, so
+ * no state is kept between calls and the numbers are independent of which thread draws them.
+ *
+ * @tparam DeviceType The Kokkos device type.
+ * @param key The key, e.g. a hash of a seed and the current time.
+ * @param counter The counter, e.g. the index of a pair of super-droplets.
+ * @return The URBG.
+ */
+template <class DeviceType>
+KOKKOS_INLINE_FUNCTION URBG<DeviceType> counter_urbg(const uint64_t key, const uint64_t counter) {
+  const auto state = splitmix64(key ^ splitmix64(counter));
+  return URBG<DeviceType>{Kokkos::Random_XorShift64<DeviceType>(state)};
+}
+
 #endif  // LIBS_SUPERDROPS_COLLISIONS_URBG_HPP_
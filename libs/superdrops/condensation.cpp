@@ -35,25 +35,27 @@
  * }
  * @endcode
  *
+ * The total number of Newton Raphson iterations and (sub-)timesteps of the ODE solver are
+ * reduced alongside the mass condensed and returned in 'cost'.
+ *
  * @param team_member The Kokkos team member.
  * @param supers The superdroplets.
  * @param state The state.
+ * @param cost Total cost of the ODE solver for all the super-droplets (output).
  * @return The total change in liquid water mass.
  */
 KOKKOS_FUNCTION
 double DoCondensation::superdroplets_change(const TeamMember& team_member,
-                                            const subviewd_supers supers,
-                                            const State& state) const {
+                                            const subviewd_supers supers, const State& state,
+                                            CondensationSolverCost& cost) const {
   const auto nsupers = static_cast<size_t>(supers.extent(0));
 
-  const auto psat = saturation_pressure(state.temp);
-  const auto s_ratio = supersaturation_ratio(state.press, state.qvap, psat);
-  const auto ffactor = diffusion_factor(state.press, state.temp, psat);
+  const auto thermo = CondensationThermoFactors(state);  // same for all supers in gridbox
 
   auto totmass_condensed = double{0.0};  // cumulative change to liquid mass in parcel volume 'dm'
-  const auto functor = SuperdropletsChangeFunctor{impe, supers, state, s_ratio, ffactor};
+  const auto functor = SuperdropletsChangeFunctor{impe, supers, thermo};
   Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team_member, nsupers), functor,
-                          totmass_condensed);
+                          totmass_condensed, cost.niters, cost.nsubsteps);
 
   return totmass_condensed;
 }
@@ -89,22 +91,26 @@ void DoCondensation::effect_on_thermodynamic_state(const TeamMember& team_member
  * ImplicitEuler instance which iteratively solves forward integration of condensation-diffusion
  * ODE. Return mass of liquid that condensed onto / evaporated off of droplet.
  *
+ * The 'a' Kohler factor and the diffusion factors are taken from the (per-gridbox) thermodynamic
+ * factors so that only the 'b' Kohler factor, which depends on the superdroplet's solute, is
+ * computed for each superdroplet.
+ *
  * @param drop The super-droplet.
- * @param temp The ambient temperature.
- * @param s_ratio The saturation ratio.
- * @param ffactor The sum of the diffusion factors.
+ * @param thermo Factors of the ODE from the ambient thermodynamic state.
+ * @param cost Cost of ODE solver to increment by iterations and (sub-)timesteps performed.
  * @return The mass of liquid condensed or evaporated.
  */
 KOKKOS_FUNCTION
-double SuperdropletsChangeFunctor::superdrop_mass_change(Superdrop& drop, const double temp,
-                                                         const double s_ratio,
-                                                         const double ffactor) const {
+double SuperdropletsChangeFunctor::superdrop_mass_change(Superdrop& drop,
+                                                         const CondensationThermoFactors& thermo,
+                                                         CondensationSolverCost& cost) const {
   const double old_m_cond = drop.condensate_mass();
 
   /* do not pass r by reference here!! copy value into iterator */
-  const auto ab_kohler = kohler_factors(drop, temp);  // pair = {akoh, bkoh}
-  const auto newr = impe.solve_condensation(s_ratio, ab_kohler, ffactor,
-                                            drop.get_radius());  // timestepping eqn [7.28] forward
+  const auto ab_kohler = Kokkos::pair<double, double>{thermo.akoh, kohler_bfactor(drop)};
+  const auto newr = impe.solve_condensation(thermo.s_ratio, ab_kohler, thermo.ffactor,
+                                            drop.get_radius(),
+                                            cost);  // timestepping eqn [7.28] forward
   drop.change_radius(newr);
   const auto mass_condensed = (drop.condensate_mass() - old_m_cond) * drop.get_xi();
 
@@ -25,6 +25,7 @@
 #include <Kokkos_MathematicalConstants.hpp>  // for pi
 #include <Kokkos_Random.hpp>
 #include <concepts>
+#include <cstdint>
 
 #include "../cleoconstants.hpp"
 #include "impliciteuler.hpp"
@@ -37,17 +38,39 @@
 
 namespace dlc = dimless_constants;
 
+/**
+ * @brief Factors of the condensation / evaporation ODE which depend only on the thermodynamic
+ * State of a gridbox and so are computed once per gridbox per condensation step (rather than
+ * for every superdroplet).
+ */
+struct CondensationThermoFactors {
+  double s_ratio; /**< The saturation ratio. */
+  double akoh;    /**< The 'a' factor of the Kohler curve. */
+  double ffactor; /**< The sum of the diffusion factors. */
+
+  /**
+   * @brief Computes the factors for the condensation / evaporation ODE given a State.
+   *
+   * @param state The thermodynamic state.
+   */
+  KOKKOS_INLINE_FUNCTION
+  explicit CondensationThermoFactors(const State& state) {
+    const auto psat = saturation_pressure(state.temp);
+    s_ratio = supersaturation_ratio(state.press, state.qvap, psat);
+    akoh = kohler_afactor(state.temp);
+    ffactor = diffusion_factor(state.press, state.temp, psat);
+  }
+};
+
 /*
 SuperdropletsChangeFunctor struct encapsulates superdroplet change during condensation
 so that parallel loop in superdroplets_change function (see below) only captures
 necessary objects and not other members of DoCondensation coincidentally
 */
 struct SuperdropletsChangeFunctor {
-  const ImplicitEuler& impe;    /**< Instance of ImplicitEuler ODE solver */
-  const subviewd_supers supers; /** The view of superdroplets. */
-  const State& state;           /**< The thermodynamic state. */
-  const double s_ratio;         /**< s_ratio The saturation ratio. */
-  const double ffactor;         /**< The sum of the diffusion factors. */
+  const ImplicitEuler& impe;              /**< Instance of ImplicitEuler ODE solver */
+  const subviewd_supers supers;           /** The view of superdroplets. */
+  const CondensationThermoFactors thermo; /**< Factors from thermodynamic state of gridbox. */
 
   /**
    * @brief Updates the super-droplet radius and returns the mass of liquid condensed or evaporated.
@@ -60,22 +83,26 @@ struct SuperdropletsChangeFunctor {
    * ODE. Return mass of liquid that condensed onto / evaporated off of droplet.
    *
    * @param drop The super-droplet.
-   * @param temp The ambient temperature.
-   * @param s_ratio The saturation ratio.
-   * @param ffactor The sum of the diffusion factors.
+   * @param thermo Factors of the ODE from the ambient thermodynamic state.
+   * @param cost Cost of ODE solver to increment by iterations and (sub-)timesteps performed.
    * @return The mass of liquid condensed or evaporated.
    */
   KOKKOS_FUNCTION
-  double superdrop_mass_change(Superdrop& drop, const double temp, const double s_ratio,
-                               const double ffactor) const;
+  double superdrop_mass_change(Superdrop& drop, const CondensationThermoFactors& thermo,
+                               CondensationSolverCost& cost) const;
 
   /*
    * operator for functor in superdroplets_change function used in parallel (TeamThreadRangePolicy)
-   * loop over superdroplets in supers view in order to call superdrop_mass_change
+   * loop over superdroplets in supers view in order to call superdrop_mass_change. Also reduces
+   * the cost of the ODE solver (for monitoring).
    */
-  KOKKOS_INLINE_FUNCTION void operator()(const size_t kk, double& mass_condensed) const {
-    const auto deltamass = superdrop_mass_change(supers(kk), state.temp, s_ratio, ffactor);
+  KOKKOS_INLINE_FUNCTION void operator()(const size_t kk, double& mass_condensed, uint64_t& niters,
+                                         uint64_t& nsubsteps) const {
+    auto cost = CondensationSolverCost{};
+    const auto deltamass = superdrop_mass_change(supers(kk), thermo, cost);
     mass_condensed += deltamass;
+    niters += cost.niters;
+    nsubsteps += cost.nsubsteps;
   }
 };
 
@@ -141,12 +168,14 @@ struct DoCondensation {
   void do_condensation(const TeamMember& team_member, const subviewd_supers supers, State& state,
                        const SDMMonitor auto mo) const {
     /* superdroplet radii changes */
-    const auto totmass_condensed = superdroplets_change(team_member, supers, state);
+    auto cost = CondensationSolverCost{};
+    const auto totmass_condensed = superdroplets_change(team_member, supers, state, cost);
 
     /* resultant effect on thermodynamic state */
     effect_on_thermodynamic_state(team_member, totmass_condensed, state);
 
     mo.monitor_condensation(team_member, totmass_condensed);
+    mo.monitor_condensation_solver(team_member, cost.niters, cost.nsubsteps);
   }
 
   /**
@@ -168,11 +197,12 @@ struct DoCondensation {
    * @param team_member The Kokkos team member.
    * @param supers The superdroplets.
    * @param state The state.
+   * @param cost Total cost of the ODE solver for all the super-droplets (output).
    * @return The total change in liquid water mass.
    */
   KOKKOS_FUNCTION double superdroplets_change(const TeamMember& team_member,
-                                              const subviewd_supers supers,
-                                              const State& state) const;
+                                              const subviewd_supers supers, const State& state,
+                                              CondensationSolverCost& cost) const;
 
   /**
    * @brief Applies the effect of condensation / evaporation on the thermodynamics of the State.
@@ -34,7 +34,7 @@
  */
 KOKKOS_FUNCTION double ImplicitEuler::solve_condensation(
     const double s_ratio, const Kokkos::pair<double, double> kohler_ab, const double ffactor,
-    const double rprev) const {
+    const double rprev, CondensationSolverCost& cost) const {
   const auto ffactor_fv = ffactor / ventilation_factor(rprev);
   const auto odeconsts =
       ImplicitIterations::ODEConstants{s_ratio, kohler_ab.first, kohler_ab.second, ffactor_fv};
@@ -45,9 +45,9 @@ KOKKOS_FUNCTION double ImplicitEuler::solve_condensation(
 
   auto rsqrd = double{0.0};
   if (ucrit1 || ucrit2) {
-    rsqrd = implit.integrate_condensation_ode(odeconsts, delt, rprev, ziter);
+    rsqrd = implit.integrate_condensation_ode(odeconsts, delt, rprev, ziter, cost);
   } else {
-    rsqrd = solve_with_adaptive_subtimestepping(odeconsts, delt, rprev, ziter);
+    rsqrd = solve_with_adaptive_subtimestepping(odeconsts, delt, rprev, ziter, cost);
   }
 
   return Kokkos::sqrt(rsqrd);
@@ -77,7 +77,7 @@ KOKKOS_FUNCTION bool ImplicitEuler::first_unique_criteria(
   const bool is_unactivated = (rprev * rprev < rcritsqrd && is_ziter_unactivated);
 
   const double sqrdval = 4.0 * akoh * akoh * akoh / 27.0 / bkoh;
-  const bool is_subactivated_saturation = (odeconsts.s_ratio <= 1.0 + Kokkos::pow(sqrdval, 0.5));
+  const bool is_subactivated_saturation = (odeconsts.s_ratio <= 1.0 + Kokkos::sqrt(sqrdval));
 
   return (is_unactivated && is_subactivated_saturation);
 }
@@ -97,14 +97,14 @@ KOKKOS_FUNCTION bool ImplicitEuler::first_unique_criteria(
  */
 KOKKOS_FUNCTION double ImplicitEuler::solve_with_adaptive_subtimestepping(
     const ImplicitIterations::ODEConstants& odeconsts, const double delt, double rprev,
-    double ziter) const {
+    double ziter, CondensationSolverCost& cost) const {
   const auto critdelt = critial_timestep(odeconsts);
   const auto mindelt = Kokkos::fmax(critdelt, minsubdelt);
 
   auto remdelt = delt;  // remaining time required to integrate over.
   while (remdelt > 0.0) {
     const auto subdelt = Kokkos::fmin(mindelt, remdelt);
-    ziter = implit.integrate_condensation_ode(odeconsts, subdelt, rprev, ziter);
+    ziter = implit.integrate_condensation_ode(odeconsts, subdelt, rprev, ziter, cost);
     rprev = Kokkos::pow(ziter, 0.5);
     remdelt -= subdelt;
   }
@@ -124,19 +124,24 @@ KOKKOS_FUNCTION double ImplicitEuler::solve_with_adaptive_subtimestepping(
  * criteria has been met (if a root of the g(Z) polynomial has been converged upon), else performs
  * upto maxniters number of further iterations, checking for convergence after each one.
  *
+ * Each call to this function is counted as one (sub-)timestep in the solver's cost.
+ *
  */
 KOKKOS_FUNCTION
 double ImplicitIterations::integrate_condensation_ode(const ODEConstants& odeconsts,
                                                       const double subdelt, const double rprev,
-                                                      double ziter) const {
+                                                      double ziter,
+                                                      CondensationSolverCost& cost) const {
+  ++cost.nsubsteps;
+
   const size_t niters = 2;
-  const auto result =
-      newtonraphson_niterations(odeconsts, subdelt, rprev, ziter, niters);  // ziter, is_converged
+  const auto result = newtonraphson_niterations(odeconsts, subdelt, rprev, ziter, niters,
+                                                cost);  // ziter, is_converged
 
   if (result.second) {
     return result.first;
   } else {
-    return newtonraphson_untilconverged(odeconsts, maxniters, subdelt, rprev, ziter);
+    return newtonraphson_untilconverged(odeconsts, maxniters, subdelt, rprev, ziter, cost);
   }
 }
 
@@ -180,8 +185,9 @@ KOKKOS_FUNCTION double ImplicitIterations::initialguess(const ODEConstants& odec
  */
 KOKKOS_FUNCTION Kokkos::pair<double, bool> ImplicitIterations::newtonraphson_niterations(
     const ODEConstants& odeconsts, const double subdelt, const double rprev, double ziter,
-    const size_t niters) const {
+    const size_t niters, CondensationSolverCost& cost) const {
   auto is_converged = false;
+  cost.niters += niters;
 
   for (size_t iter(0); iter < niters; ++iter) {
     const auto result =
@@ -206,7 +212,7 @@ KOKKOS_FUNCTION Kokkos::pair<double, bool> ImplicitIterations::newtonraphson_nit
  */
 KOKKOS_FUNCTION double ImplicitIterations::newtonraphson_untilconverged(
     const ODEConstants& odeconsts, const size_t niterslimit, const double subdelt,
-    const double rprev, double ziter) const {
+    const double rprev, double ziter, CondensationSolverCost& cost) const {
   auto is_converged = bool{false};
   auto niter = size_t{1};
 
@@ -221,6 +227,7 @@ KOKKOS_FUNCTION double ImplicitIterations::newtonraphson_untilconverged(
     ziter = result.first;
     is_converged = result.second;
     niter += 1;
+    ++cost.niters;
   }
 
   return ziter;
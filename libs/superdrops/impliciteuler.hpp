@@ -24,12 +24,22 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Pair.hpp>
+#include <cstdint>
 
 #include "../cleoconstants.hpp"
 #include "thermodynamic_equations.hpp"
 
 namespace dlc = dimless_constants;
 
+/**
+ * @brief Cost of solving the condensation / evaporation ODE, i.e. number of iterations of the
+ * Newton Raphson method and number of (sub-)timesteps of the implicit Euler method.
+ */
+struct CondensationSolverCost {
+  uint64_t niters = 0;    /**< Total no. iterations of Newton Raphson method */
+  uint64_t nsubsteps = 0; /**< Total no. (sub-)timesteps of implicit Euler method */
+};
+
 /**
  * @brief Struct for performing iterations of the Implicit Euler Method.
  *
@@ -80,10 +90,12 @@ struct ImplicitIterations {
    * @param subdelt Time over which to integrate ODE
    * @param rprev Radius of droplet at previous timestep.
    * @param ziter Initial value for ziter.
+   * @param cost Cost of solver to increment by number of iterations and (sub-)timesteps performed.
    */
   KOKKOS_FUNCTION double integrate_condensation_ode(const ODEConstants& odeconsts,
                                                     const double subdelt, const double rprev,
-                                                    double ziter) const;
+                                                    double ziter,
+                                                    CondensationSolverCost& cost) const;
 
   /**
    * @brief Returns appropriate initial guess (ie. a reasonable guess) for the Newton-Raphson
@@ -117,11 +129,12 @@ struct ImplicitIterations {
    * @param rprev Radius at previous timestep
    * @param ziter The current guess for ziter.
    * @param niters Number of iterations of NR method to perform
+   * @param cost Cost of solver to increment by number of iterations performed.
    * @return The updated value of ziter.
    */
   KOKKOS_FUNCTION Kokkos::pair<double, bool> newtonraphson_niterations(
       const ODEConstants& odeconsts, const double subdelt, const double rprev, double ziter,
-      const size_t niters) const;
+      const size_t niters, CondensationSolverCost& cost) const;
   /**
    *
    * @brief Performs Newton-Raphson iterations until convergence or maximum number of
@@ -137,12 +150,14 @@ struct ImplicitIterations {
    * @param niterslimit The maxiumum number of iterations to attempt.
    * @param rprev Radius at the previous timestep.
    * @param ziter The current guess for ziter.
+   * @param cost Cost of solver to increment by number of iterations performed.
    * @return The updated value of ziter.
    */
   KOKKOS_FUNCTION double newtonraphson_untilconverged(const ODEConstants& odeconsts,
                                                       const size_t niterslimit,
                                                       const double subdelt, const double rprev,
-                                                      double ziter) const;
+                                                      double ziter,
+                                                      CondensationSolverCost& cost) const;
 
   /**
    * @brief Perform one iteration of the Newton-Raphson rootfinding algorithm.
@@ -301,11 +316,12 @@ class ImplicitEuler {
    * @param delt Time over which to integrate ODE over.
    * @param rprev Previous radius at time = t
    * @param ziter Initial guess for ziter.
+   * @param cost Cost of solver to increment by number of iterations and sub-timesteps performed.
    * @return Updated radius^2 for time = t + delt
    */
   KOKKOS_FUNCTION double solve_with_adaptive_subtimestepping(
       const ImplicitIterations::ODEConstants& odeconsts, const double delt, double rprev,
-      double ziter) const;
+      double ziter, CondensationSolverCost& cost) const;
 
  public:
   /**
@@ -337,11 +353,13 @@ class ImplicitEuler {
    * @param kohler_ab A pair containing 'a' and 'b' factors for Kohler curve in that order.
    * @param ffactor The sum of the diffusion factors.
    * @param rprev Previous radius at time = t
+   * @param cost Cost of solver to increment by number of iterations and (sub-)timesteps performed.
    * @return Updated radius for time = t + delt
    */
   KOKKOS_FUNCTION double solve_condensation(const double s_ratio,
                                             const Kokkos::pair<double, double> kohler_ab,
-                                            const double ffactor, const double rprev) const;
+                                            const double ffactor, const double rprev,
+                                            CondensationSolverCost& cost) const;
 };
 
 #endif  // LIBS_SUPERDROPS_IMPLICITEULER_HPP_
@@ -20,6 +20,7 @@
 #define LIBS_SUPERDROPS_SDMMONITOR_HPP_
 
 #include <concepts>
+#include <cstdint>
 
 #include "kokkosaliases_sd.hpp"
 #include "state.hpp"
@@ -28,25 +29,25 @@
 /**
  * @brief Concept of SDMmonitor to monitor various SDM processes.
  *
- * _Note:_ More exact contraint missing:
- * `{ mo.monitor_motion(d_gbxs, domainsupers) } -> std::same_as<void>;`
- * to avoid adding constraint over templated argument types.
- *
- * _Note:_ More exact contraint missing:
- * `{ mo.monitor_precipitation(unsigned int, gbxmaps, state, superdrop) } -> std::same_as<void>;`
- * to avoid adding constraint over templated argument types.
+ * Monitoring of superdroplet motion (monitor_motion and monitor_precipitation) happens within
+ * the (team) parallel loops over gridboxes during motion, so that monitors are fed by team-local
+ * reductions rather than launching their own parallel loops over all superdroplets.
  *
  * @tparam SDMMo Type that satisfies the SDMMonitor concept.
  */
 template <typename SDMMo>
 concept SDMMonitor =
-    requires(SDMMo mo, const TeamMember& tm, const double d, const viewd_constsupers supers) {
+    requires(SDMMo mo, const TeamMember& tm, const double d, const uint64_t u,
+             const viewd_constsupers supers) {
       { mo.reset_monitor() } -> std::same_as<void>;
       { mo.before_timestepping(tm, supers) } -> std::same_as<void>;
       { mo.monitor_condensation(tm, d) } -> std::same_as<void>;
+      { mo.monitor_condensation_solver(tm, u, u) } -> std::same_as<void>;
+      { mo.monitor_collisions(tm, u, u, u, u) } -> std::same_as<void>;
       { mo.monitor_microphysics(tm, supers) } -> std::same_as<void>;
-      // { mo.monitor_motion };
-      // { mo.monitor_precipitation };
+      { mo.monitor_motion(tm, supers) } -> std::same_as<void>;
+      { mo.monitor_motion_substeps(u) } -> std::same_as<void>;
+      { mo.monitor_precipitation(tm, d) } -> std::same_as<void>;
     };
 
 /**
@@ -103,6 +104,30 @@ struct CombinedSDMMonitor {
     b.monitor_condensation(tm, d);
   }
 
+  /**
+   * @brief monitor cost of condensation ODE solver for combination of 2 sdm monitors.
+   *
+   * Each monitor is run sequentially.
+   */
+  KOKKOS_FUNCTION
+  void monitor_condensation_solver(const TeamMember& tm, const uint64_t niters,
+                                   const uint64_t nsubsteps) const {
+    a.monitor_condensation_solver(tm, niters, nsubsteps);
+    b.monitor_condensation_solver(tm, niters, nsubsteps);
+  }
+
+  /**
+   * @brief monitor collision events for combination of 2 sdm monitors.
+   *
+   * Each monitor is run sequentially.
+   */
+  KOKKOS_FUNCTION
+  void monitor_collisions(const TeamMember& tm, const uint64_t ncolls, const uint64_t ncoals,
+                          const uint64_t nbreakups, const uint64_t nnulls) const {
+    a.monitor_collisions(tm, ncolls, ncoals, nbreakups, nnulls);
+    b.monitor_collisions(tm, ncolls, ncoals, nbreakups, nnulls);
+  }
+
   /**
    * @brief monitor microphysics for combination of 2 sdm monitors.
    *
@@ -119,21 +144,31 @@ struct CombinedSDMMonitor {
    *
    * Each monitor is run sequentially.
    */
-  void monitor_motion(const auto d_gbxs, const auto domainsupers) const {
-    a.monitor_motion(d_gbxs, domainsupers);
-    b.monitor_motion(d_gbxs, domainsupers);
+  KOKKOS_FUNCTION
+  void monitor_motion(const TeamMember& tm, const viewd_constsupers supers) const {
+    a.monitor_motion(tm, supers);
+    b.monitor_motion(tm, supers);
   }
 
   /**
-   * @brief monitor motion for combination of 2 sdm monitors.
+   * @brief monitor number of sub-steps of motion for combination of 2 sdm monitors.
+   *
+   * Each monitor is run sequentially.
+   */
+  void monitor_motion_substeps(const unsigned int nsubsteps) const {
+    a.monitor_motion_substeps(nsubsteps);
+    b.monitor_motion_substeps(nsubsteps);
+  }
+
+  /**
+   * @brief monitor precipitation for combination of 2 sdm monitors.
    *
    * Each monitor is run sequentially.
    */
   KOKKOS_FUNCTION
-  void monitor_precipitation(const TeamMember& team_member, const unsigned int gbxindex,
-                             const auto& gbxmaps, Superdrop& drop) const {
-    a.monitor_precipitation(team_member, gbxindex, gbxmaps, drop);
-    b.monitor_precipitation(team_member, gbxindex, gbxmaps, drop);
+  void monitor_precipitation(const TeamMember& tm, const double d) const {
+    a.monitor_precipitation(tm, d);
+    b.monitor_precipitation(tm, d);
   }
 };
 
@@ -151,14 +186,25 @@ struct NullSDMMonitor {
   KOKKOS_FUNCTION
   void monitor_condensation(const TeamMember& team_member, const double d) const {}
 
+  KOKKOS_FUNCTION
+  void monitor_condensation_solver(const TeamMember& team_member, const uint64_t niters,
+                                   const uint64_t nsubsteps) const {}
+
+  KOKKOS_FUNCTION
+  void monitor_collisions(const TeamMember& team_member, const uint64_t ncolls,
+                          const uint64_t ncoals, const uint64_t nbreakups,
+                          const uint64_t nnulls) const {}
+
   KOKKOS_FUNCTION
   void monitor_microphysics(const TeamMember& team_member, const viewd_constsupers supers) const {}
 
-  void monitor_motion(const auto d_gbxs, const auto domainsupers) const {}
+  KOKKOS_FUNCTION
+  void monitor_motion(const TeamMember& team_member, const viewd_constsupers supers) const {}
+
+  void monitor_motion_substeps(const unsigned int nsubsteps) const {}
 
   KOKKOS_FUNCTION
-  void monitor_precipitation(const TeamMember& team_member, const unsigned int gbxindex,
-                             const auto& gbxmaps, Superdrop& drop) const {}
+  void monitor_precipitation(const TeamMember& team_member, const double d) const {}
 };
 
 #endif  // LIBS_SUPERDROPS_SDMMONITOR_HPP_
@@ -23,6 +23,8 @@
 #define LIBS_SUPERDROPS_SUPERDROP_HPP_
 
 #include <cstdint>
+#include <optional>
+#include <type_traits>
 
 #include "superdrop_attrs.hpp"
 #include "superdrop_ids.hpp"
@@ -31,7 +33,9 @@
  * @brief Class representing a super-droplet (synonyms: superdroplet, superdrop, SD).
  *
  * This class defines properties and operations of a super-droplet
- * (synonyms: superdroplet, superdrop, SD).
+ * (synonyms: superdroplet, superdrop, SD). Mass of solute is stored with precision FloatType
+ * (see sdattrs_float) but is always returned as a double. Coordinates are always stored in double
+ * precision so that small displacements of super-droplets are not lost.
  */
 class Superdrop {
  private:
@@ -48,6 +52,8 @@ class Superdrop {
   [[no_unique_address]] IDType sdId;
   /**< instance of super-droplet identity of Superdrop::IDType */
 
+  using FloatType = sdattrs_float; /**< Type used to store mass of solute (attrs.msol) */
+
   /**
    * @brief Default constructor requirement for use of Superdrop in Kokkos View
    */
@@ -90,21 +96,21 @@ class Superdrop {
    *
    * @return 3rd spatial coordinate.
    */
-  KOKKOS_INLINE_FUNCTION auto get_coord3() const { return coord3; }
+  KOKKOS_INLINE_FUNCTION double get_coord3() const { return coord3; }
 
   /**
    * @brief Get the 1st spatial coordinate of the superdroplet.
    *
    * @return 1st spatial coordinate.
    */
-  KOKKOS_INLINE_FUNCTION auto get_coord1() const { return coord1; }
+  KOKKOS_INLINE_FUNCTION double get_coord1() const { return coord1; }
 
   /**
    * @brief Get the 2nd spatial coordinate of the superdroplet.
    *
    * @return 2nd spatial coordinate.
    */
-  KOKKOS_INLINE_FUNCTION auto get_coord2() const { return coord2; }
+  KOKKOS_INLINE_FUNCTION double get_coord2() const { return coord2; }
 
   /**
    * @brief Returns 'true' if the super-droplet has solute.
@@ -162,7 +168,7 @@ class Superdrop {
    *
    * @return mass of solute in the super-droplet.
    */
-  KOKKOS_INLINE_FUNCTION auto get_msol() const { return attrs.msol; }
+  KOKKOS_INLINE_FUNCTION double get_msol() const { return attrs.msol; }
 
   /**
    * @brief Get the mass of the super-droplet.
@@ -325,6 +331,8 @@ class Superdrop {
     coord2 += delta2;
   }
 
+  /* copies coordinates, radius and msol into (MPI) buffer of doubles, i.e. msol is always sent in
+  double precision, so FloatType only changes the size of a Superdrop in memory */
   void serialize_double_components(std::vector<double>::iterator target) const {
     *target++ = coord3;
     *target++ = coord1;
@@ -352,7 +360,46 @@ class Superdrop {
     coord1 = *double_source++;
     coord2 = *double_source++;
     attrs.radius = *double_source++;
-    attrs.msol = *double_source;
+    attrs.msol = static_cast<FloatType>(*double_source);
+  }
+
+  /**
+   * @brief Number of bytes between the start of a Superdrop and each of its (data) members.
+   */
+  struct MemberOffsets {
+    size_t sdgbxindex;          /**< offset of sdgbxindex (unsigned int) */
+    size_t coord3;              /**< offset of coord3 (double) */
+    size_t coord1;              /**< offset of coord1 (double) */
+    size_t coord2;              /**< offset of coord2 (double) */
+    size_t xi;                  /**< offset of multiplicity (uint64_t) */
+    size_t radius;              /**< offset of radius (double) */
+    size_t msol;                /**< offset of solute mass (FloatType) */
+    std::optional<size_t> sdId; /**< offset of ID value (size_t), empty if IDType has no value */
+  };
+
+  /**
+   * @brief Get the number of bytes between the start of this super-droplet and each of its (data)
+   * members, e.g. for strided access without copying to one member of every super-droplet in a
+   * contiguous view of super-droplets.
+   *
+   * @return Byte offsets of the super-droplet's members (without an offset for the ID if IDType
+   * is EmptyID).
+   */
+  MemberOffsets get_member_offsets() const {
+    const auto start = reinterpret_cast<const char*>(this);
+    const auto offset = [start](const void* member) {
+      return static_cast<size_t>(reinterpret_cast<const char*>(member) - start);
+    };
+    const auto id_offset = [offset]<typename ID>(const ID& id) -> std::optional<size_t> {
+      if constexpr (std::is_same_v<ID, EmptyID>) {
+        return std::nullopt;  // EmptyID has no value
+      } else {
+        return offset(&id.value);
+      }
+    };
+    return {offset(&sdgbxindex), offset(&coord3),      offset(&coord1),
+            offset(&coord2),     offset(&attrs.xi),    offset(&attrs.radius),
+            offset(&attrs.msol), id_offset(sdId)};
   }
 };
 
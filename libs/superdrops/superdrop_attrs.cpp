@@ -55,7 +55,7 @@ double SuperdropAttrs::mass() const {
   constexpr double massconst(4.0 / 3.0 * Kokkos::numbers::pi * dlc::Rho_l);  // 4/3 * pi * density
   const auto density_factor = double{1.0 - dlc::Rho_l / solute.rho_sol()};   // to account for msol
 
-  auto mass = double{msol * density_factor};  // mass contribution of solute
+  auto mass = double{static_cast<double>(msol) * density_factor};  // mass contribution of solute
   mass += massconst * rcubed();
 
   return mass;
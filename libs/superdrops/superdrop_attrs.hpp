@@ -29,6 +29,22 @@
 
 namespace dlc = dimless_constants;
 
+/**
+ * @brief Floating point type used to store super-droplet mass of solute.
+ *
+ * Double precision by default. If CLEO_SUPERDROPS_SINGLE_PRECISION is defined (see
+ * CMake option of the same name) mass of solute is stored as a float in order to reduce the
+ * size of a Superdrop in memory, e.g. for sorting. Getters always return doubles so that
+ * calculations, including reductions over super-droplets, are still performed in double precision.
+ * Coordinates are always stored in double precision (see Superdrop) and MPI exchange of
+ * super-droplets always sends mass of solute as a double.
+ */
+#ifdef CLEO_SUPERDROPS_SINGLE_PRECISION
+using sdattrs_float = float;
+#else
+using sdattrs_float = double;
+#endif
+
 /**
  * @brief Struct representing the properties of solute in a super-droplet.
  */
@@ -61,9 +77,9 @@ struct SoluteProperties {
 struct SuperdropAttrs {
   SoluteProperties solute;
   /**< instance of SoluteProperties for pointer-like reference to superdrop's solute properties. */
-  uint64_t xi;   /**< Multiplicity of superdrop. */
-  double radius; /**< Radius of superdrop. */
-  double msol;   /**< Mass of solute dissolved in superdrop. */
+  sdattrs_float msol; /**< Mass of solute dissolved in superdrop (placed to fill padding). */
+  uint64_t xi;        /**< Multiplicity of superdrop. */
+  double radius;      /**< Radius of superdrop. */
 
   /**
    * @brief Default constructor requirement for use of SuperdropAttrs in Kokkos View
@@ -87,7 +103,7 @@ struct SuperdropAttrs {
   KOKKOS_FUNCTION
   SuperdropAttrs(const SoluteProperties solute, const uint64_t xi, const double radius,
                  const double msol, const bool allow_nans = false)
-      : solute(solute), xi(xi), radius(radius), msol(msol) {
+      : solute(solute), msol(msol), xi(xi), radius(radius) {
     if (!allow_nans) {
       // if un-real superdroplets are not allowed check setter functions succeed
       set_xi(xi);
@@ -189,7 +205,7 @@ struct SuperdropAttrs {
    * @param i_msol The value to set for msol.
    */
   KOKKOS_FUNCTION
-  void set_msol(const double i_msol) { msol = i_msol; }
+  void set_msol(const double i_msol) { msol = static_cast<sdattrs_float>(i_msol); }
 
   /**
    * @brief Get the total droplet mass.
@@ -206,7 +222,7 @@ struct SuperdropAttrs {
    * @return mass of the super-droplet - mass of solute
    */
   KOKKOS_INLINE_FUNCTION double condensate_mass() const {
-    auto m_cond = mass() - msol;
+    auto m_cond = double{mass() - static_cast<double>(msol)};
     if (m_cond <= -0.0001 * msol) {
       Kokkos::abort(
           "condensate mass cannot be less than 0.0 (within 0.0001 of dry mass tolerance)");
@@ -226,7 +242,7 @@ struct SuperdropAttrs {
    */
   KOKKOS_FUNCTION double dryradius() const {
     constexpr double vconst = 3.0 / (4.0 * Kokkos::numbers::pi);
-    const auto dryrcubed = double{vconst * msol / solute.rho_sol()};
+    const auto dryrcubed = double{vconst * static_cast<double>(msol) / solute.rho_sol()};
     return Kokkos::pow(dryrcubed, 1.0 / 3.0);
   }
 
@@ -80,6 +80,42 @@ double supersaturation_ratio(const double press, const double qvap, const double
   return (press * qvap) / ((dlc::Mr_ratio + qvap) * psat);
 }
 
+/**
+ * @brief Calculate the 'a' factor of the Kohler curve, which depends only on the ambient
+ * temperature (and so is the same for all superdroplets in a gridbox).
+ *
+ * Calculates value of 'a' in Raoult factor (exp^(a/r)) to account for effect of dissolved solute
+ * on radial growth of droplet. See kohler_factors.
+ *
+ * @param temp The ambient temperature.
+ * @return The 'a' factor.
+ */
+KOKKOS_INLINE_FUNCTION
+double kohler_afactor(const double temp) {
+  constexpr double akoh_constant = 3.3e-7 / (dlc::TEMP0 * dlc::R0);
+  return akoh_constant / temp;  // dimensionless version of eqn [6.24]
+}
+
+/**
+ * @brief Calculate the 'b' factor of the Kohler curve, which depends only on the superdroplet's
+ * solute.
+ *
+ * Calculates value of 'b' in Kelvin factor (1-b/r^3) to account for curvature on radial growth of
+ * droplet. See kohler_factors. The solute properties are compile-time constants so the factor is
+ * a single multiplication of the superdroplet's mass of solute.
+ *
+ * @param drop The superdroplet.
+ * @return The 'b' factor.
+ */
+KOKKOS_INLINE_FUNCTION
+double kohler_bfactor(const Superdrop& drop) {
+  constexpr double bkoh_constant = 4.3e-6 * dlc::RHO0 / dlc::MR0;
+  const auto msol = drop.get_msol();
+  const auto ionic = drop.get_ionic();
+  const auto mr_sol = drop.get_mr_sol();
+  return bkoh_constant * msol * ionic / mr_sol;  // dimensionless version of eqn [6.22]
+}
+
 /**
  * @brief Calculate the Raoult and Kelvin factors for the Kohler curve.
  *
@@ -94,16 +130,7 @@ double supersaturation_ratio(const double press, const double qvap, const double
  */
 KOKKOS_INLINE_FUNCTION
 Kokkos::pair<double, double> kohler_factors(const Superdrop& drop, const double temp) {
-  constexpr double akoh_constant = 3.3e-7 / (dlc::TEMP0 * dlc::R0);
-  const auto akoh = akoh_constant / temp;  // dimensionless version of eqn [6.24]
-
-  constexpr double bkoh_constant = 4.3e-6 * dlc::RHO0 / dlc::MR0;
-  const auto msol = drop.get_msol();
-  const auto ionic = drop.get_ionic();
-  const auto mr_sol = drop.get_mr_sol();
-  const auto bkoh = bkoh_constant * msol * ionic / mr_sol;  // dimensionless version of eqn [6.22]
-
-  return {akoh, bkoh};  // {a, b} = {Raoult, Kelvin} Kohler factors
+  return {kohler_afactor(temp), kohler_bfactor(drop)};  // {a, b} = {Raoult, Kelvin} Kohler factors
 }
 
 /**
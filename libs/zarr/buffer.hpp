@@ -23,11 +23,13 @@
 #include <Kokkos_Pair.hpp>
 #include <algorithm>
 #include <limits>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "../kokkosaliases.hpp"
+#include "zarr/shards.hpp"
 
 /**
  * @brief A class template for managing a buffer of elements of data type T.
@@ -169,6 +171,61 @@ struct Buffer {
     store[std::string(name) + '/' + chunk_label] = buffer;
     reset_buffer();
   }
+
+  /**
+   * @brief Write out the data in the buffer as a chunk of a shard of an array called "name" in a
+   * memory store. Then resets the buffer.
+   *
+   * @tparam Store The type of the memory store.
+   * @param store Reference to the store object.
+   * @param name Name of the array in the store.
+   * @param chunk_labnums Number of the chunk along each dimension of the array.
+   * @param shards Shards of the array to write the chunk into.
+   */
+  template <typename Store>
+  void write_buffer_to_shard(Store& store, std::string_view name,
+                             const std::vector<size_t>& chunk_labnums, Shards& shards) {
+    const auto chunk = std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(buffer.data()),
+                                                buffer.extent(0) * sizeof(T));
+    shards.write_chunk(store, name, chunk_labnums, chunk);
+    reset_buffer();
+  }
+
+  /**
+   * @brief Writes a snapshot of the data in the buffer to a chunk in a store without resetting
+   * the buffer (unfilled elements of the chunk are written as the buffer's NaN values).
+   *
+   * @tparam Store The type of the memory store.
+   * @param store Reference to the store object.
+   * @param name Name of the array in the store.
+   * @param chunk_label Name of the chunk of the array to write in the store.
+   */
+  template <typename Store>
+  void write_buffer_snapshot_to_chunk(Store& store, std::string_view name,
+                                      const std::string& chunk_label) const {
+    store[std::string(name) + '/' + chunk_label] = buffer;
+  }
+
+  /**
+   * @brief Writes snapshots of the incomplete shards of an array called "name" in a memory store,
+   * including the data in the buffer as a chunk (if the buffer isn't empty), without resetting
+   * the buffer or changing the shards.
+   *
+   * @tparam Store The type of the memory store.
+   * @param store Reference to the store object.
+   * @param name Name of the array in the store.
+   * @param chunk_labnums Number of the chunk along each dimension of the array.
+   * @param shards Shards of the array to write snapshots of.
+   */
+  template <typename Store>
+  void write_buffer_snapshot_to_shard(Store& store, std::string_view name,
+                                      const std::vector<size_t>& chunk_labnums,
+                                      const Shards& shards) const {
+    const auto nbytes = size_t{fill > 0 ? buffer.extent(0) * sizeof(T) : 0};
+    const auto chunk =
+        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(buffer.data()), nbytes);
+    shards.write_snapshot(store, name, chunk_labnums, chunk);
+  }
 };
 
 #endif  // LIBS_ZARR_BUFFER_HPP_
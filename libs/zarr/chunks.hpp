@@ -23,6 +23,8 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Pair.hpp>
+#include <cstdint>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -30,6 +32,7 @@
 
 #include "configuration/communicator.hpp"
 #include "zarr/buffer.hpp"
+#include "zarr/shards.hpp"
 
 /**
  * @brief Calculates the product of all elements in a vector of size_t numbers.
@@ -64,7 +67,8 @@ inline size_t vec_product(const std::vector<size_t>& vec, const size_t aa) {
 /**
  * @brief A class template for managing and writing chunks of an array.
  *
- * This class provides functionality for writing chunks of an array to a store.
+ * This class provides functionality for writing chunks of an array to a store, either with one
+ * key per chunk or with many chunks packed into each key by shards (see Shards).
  *
  */
 class Chunks {
@@ -72,30 +76,44 @@ class Chunks {
   std::vector<size_t> chunkshape; /**< Shape of chunks along each dimension (constant) */
   std::vector<size_t> reducedarray_nchunks;
   /**< Number chunks of array along all but outermost dimension of array (constant) */
+  Shards shards; /**< Shards to pack chunks into (if array is sharded) */
   // MPI_Comm comm; /**< (YAC compatible) communicator for MPI domain decomposition */
 
   /**
-   * @brief Create label for a chunk given current number of chunks written to array.
+   * @brief Create number along each dimension for a chunk given current number of chunks written
+   * to array.
    *
    * This function creates a vector of integers for the number of a chunk along each dimension of
    * an array given the chunk is the n'th chunk to be written to the store (starting at n=0 and
-   * incrementing along the innermost dimensions first). The vector is then converted into a
-   * string which can be used to label the chunk.
+   * incrementing along the innermost dimensions first).
    *
    * @param chunk_num The number of the chunk to write to the array.
-   * @return A string representing the label of the current chunk to write.
+   * @return A vector of the number of the current chunk to write along each dimension.
    */
-  std::string chunk_label(const size_t chunk_num) const {
-    auto chunk_labnums = std::vector<size_t>(chunkshape.size(), 0);
-    chunk_labnums.at(0) = chunk_num / vec_product(reducedarray_nchunks);
+  std::vector<size_t> chunk_labnums(const size_t chunk_num) const {
+    auto labnums = std::vector<size_t>(chunkshape.size(), 0);
+    labnums.at(0) = chunk_num / vec_product(reducedarray_nchunks);
 
     for (size_t aa = 1; aa < chunkshape.size(); ++aa) {
-      chunk_labnums.at(aa) =
+      labnums.at(aa) =
           (chunk_num / vec_product(reducedarray_nchunks, aa)) % reducedarray_nchunks.at(aa - 1);
     }
 
+    return labnums;
+  }
+
+  /**
+   * @brief Create label for a chunk given current number of chunks written to array.
+   *
+   * This function converts the vector of integers for the number of a chunk along each dimension
+   * of an array (see chunk_labnums) into a string which can be used to label the chunk.
+   *
+   * @param chunk_num The number of the chunk to write to the array.
+   * @return A string representing the label of the current chunk to write.
+   */
+  std::string chunk_label(const size_t chunk_num) const {
     auto chunk_lab = std::string{""};
-    for (const auto& c : chunk_labnums) {
+    for (const auto& c : chunk_labnums(chunk_num)) {
       chunk_lab += std::to_string(c) + ".";
     }
     chunk_lab.pop_back();  // delete last "."
@@ -114,9 +132,13 @@ class Chunks {
    *
    * @param chunkshape The shape of chunks along each dimension.
    * @param reduced_arrayshape The shape of the reduced array along each dimension.
+   * @param shard_nchunks The number of chunks in each shard (0 means no sharding).
    */
-  Chunks(const std::vector<size_t>& chunkshape, const std::vector<size_t>& reduced_arrayshape)
-      : chunkshape(chunkshape), reducedarray_nchunks(chunkshape.size() - 1, 0) {
+  Chunks(const std::vector<size_t>& chunkshape, const std::vector<size_t>& reduced_arrayshape,
+         const size_t shard_nchunks = 0)
+      : chunkshape(chunkshape),
+        reducedarray_nchunks(chunkshape.size() - 1, 0),
+        shards(shard_nchunks) {
     /* number of dimensions (ndims) of actual array = ndims of array's chunks, is 1 more than
     ndims of reduced arrayshape (because reduced arrayshape excludes outermost (0th) dimension)). */
 
@@ -160,6 +182,11 @@ class Chunks {
    */
   std::vector<size_t> get_reducedarray_nchunks() const { return reducedarray_nchunks; }
 
+  /**
+   * @brief Returns true if chunks are written packed into shards.
+   */
+  bool is_sharded() const { return shards.is_sharded(); }
+
   /**
    * @brief Gets complete shape of the array excluding its outermost dimension.
    *
@@ -179,7 +206,8 @@ class Chunks {
    *
    * This function writes the data held in a buffer in the specified store to a chunk identified by
    * "chunk_label" of an array called "name" given the number of chunks of the array already
-   * existing. After writing the chunk, the total number of chunks is incremented.
+   * existing (or to its shard if the array is sharded). After writing the chunk, the total number
+   * of chunks is incremented.
    *
    * @tparam Store The type of the store.
    * @tparam T The type of the data elements stored in the buffer.
@@ -191,8 +219,12 @@ class Chunks {
    */
   template <typename Store, typename T>
   size_t write_chunk(Store& store, const std::string_view name, const size_t chunk_num,
-                     Buffer<T>& buffer) const {
-    buffer.write_buffer_to_chunk(store, name, chunk_label(chunk_num));
+                     Buffer<T>& buffer) {
+    if (shards.is_sharded()) {
+      buffer.write_buffer_to_shard(store, name, chunk_labnums(chunk_num), shards);
+    } else {
+      buffer.write_buffer_to_chunk(store, name, chunk_label(chunk_num));
+    }
     return chunk_num + 1;
   }
 
@@ -201,7 +233,8 @@ class Chunks {
    *
    * This function writes the data stored in the Kokkos view (in host memory) in the specified store
    * to a chunk identified by "chunk_label" of an array called "name" given the number of chunks of
-   * the array already existing. After writing the chunk, the total number of chunks is incremented.
+   * the array already existing (or to its shard if the array is sharded). After writing the chunk,
+   * the total number of chunks is incremented.
    *
    * @tparam Store The type of the store.
    * @tparam T The type of the data elements stored in the buffer.
@@ -213,8 +246,15 @@ class Chunks {
    */
   template <typename Store, typename T>
   size_t write_chunk(Store& store, const std::string_view name, const size_t chunk_num,
-                     const Buffer<T>::subviewh_buffer h_data_chunk) const {
-    store[std::string(name) + '/' + chunk_label(chunk_num)].template operator= <T>(h_data_chunk);
+                     const Buffer<T>::subviewh_buffer h_data_chunk) {
+    if (shards.is_sharded()) {
+      const auto nbytes = size_t{h_data_chunk.extent(0) * sizeof(T)};
+      const auto chunk =
+          std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(h_data_chunk.data()), nbytes);
+      shards.write_chunk(store, name, chunk_labnums(chunk_num), chunk);
+    } else {
+      store[std::string(name) + '/' + chunk_label(chunk_num)].template operator= <T>(h_data_chunk);
+    }
 
     return chunk_num + 1;
   }
@@ -242,7 +282,7 @@ class Chunks {
   template <typename Store, typename T>
   size_t write_chunks(Store& store, const std::string_view name,
                       const Buffer<T>::subviewh_buffer h_data, const size_t totnchunks,
-                      const size_t chunksize, const size_t nchunks) const {
+                      const size_t chunksize, const size_t nchunks) {
     for (size_t nn = 0; nn < nchunks; ++nn) {
       const auto refs = kkpair_size_t({nn * chunksize, (nn + 1) * chunksize});
       const auto data_chunk = Kokkos::subview(h_data, refs);
@@ -252,6 +292,45 @@ class Chunks {
 
     return totnchunks + nchunks;
   }
+
+  /**
+   * @brief Writes any incomplete shards of the array to the store (does nothing if the array is
+   * not sharded).
+   *
+   * @tparam Store The type of the store.
+   * @param store Reference to the store where the shards will be written.
+   * @param name Name of the array in the store.
+   */
+  template <typename Store>
+  void flush_shards(Store& store, const std::string_view name) {
+    shards.flush(store, name);
+  }
+
+  /**
+   * @brief Writes a snapshot of the data held in memory for an array to the store without
+   * changing the total number of chunks written.
+   *
+   * The data in a (partially filled) buffer is written as the chunk after the total number of
+   * chunks already written, and, if the array is sharded, copies of the incomplete shards of the
+   * array (including the buffer's chunk) are written. The chunk, or shards, will later be
+   * overwritten in the store when they are complete.
+   *
+   * @tparam Store The type of the store.
+   * @tparam T The type of the data elements stored in the buffer.
+   * @param store Reference to the store where the snapshot will be written.
+   * @param name Name of the array in the store.
+   * @param chunk_num The total number of chunks of the array already written.
+   * @param buffer The buffer containing data not yet written to a chunk.
+   */
+  template <typename Store, typename T>
+  void write_snapshot(Store& store, const std::string_view name, const size_t chunk_num,
+                      const Buffer<T>& buffer) const {
+    if (shards.is_sharded()) {
+      buffer.write_buffer_snapshot_to_shard(store, name, chunk_labnums(chunk_num), shards);
+    } else if (buffer.get_fill() > 0) {
+      buffer.write_buffer_snapshot_to_chunk(store, name, chunk_label(chunk_num));
+    }
+  }
 };
 
 #endif  // LIBS_ZARR_CHUNKS_HPP_
@@ -33,6 +33,7 @@
 #include <utility>
 #include <vector>
 
+#include "configuration/communication_metrics.hpp"
 #include "configuration/communicator.hpp"
 #include "zarr/xarray_zarr_array.hpp"
 #include "zarr/zarr_group.hpp"
@@ -54,6 +55,10 @@ class CollectiveDataset {
   ZarrGroup<Store> group;
   /**< map from name of each dimension in dataset to their size */
   std::unordered_map<std::string, size_t> datasetdims;
+  /**< number of chunks in each shard of arrays (0 means no sharding) */
+  size_t shard_nchunks;
+  /**< settings for commits of the shape of arrays to the store */
+  MetadataCommits commits;
   Decomposition decomposition;
   std::shared_ptr<std::vector<unsigned int>> global_superdroplet_ordering;
 
@@ -173,8 +178,10 @@ class CollectiveDataset {
    */
   void collect_global_array(float* target, float* local_source, int local_size, int* receive_counts,
                             int* receive_displacements) const {
+    const auto gather_start = MPI_Wtime();
     MPI_Gatherv(local_source, local_size, MPI_FLOAT, target, receive_counts, receive_displacements,
                 MPI_FLOAT, 0, comm);
+    communication_metrics::add_gather_time(MPI_Wtime() - gather_start);
   }
 
   /**
@@ -182,8 +189,10 @@ class CollectiveDataset {
    */
   void collect_global_array(unsigned int* target, unsigned int* local_source, int local_size,
                             int* receive_counts, int* receive_displacements) const {
+    const auto gather_start = MPI_Wtime();
     MPI_Gatherv(local_source, local_size, MPI_UNSIGNED, target, receive_counts,
                 receive_displacements, MPI_UNSIGNED, 0, comm);
+    communication_metrics::add_gather_time(MPI_Wtime() - gather_start);
   }
 
   /**
@@ -191,8 +200,10 @@ class CollectiveDataset {
    */
   void collect_global_array(size_t* target, size_t* local_source, int local_size,
                             int* receive_counts, int* receive_displacements) const {
+    const auto gather_start = MPI_Wtime();
     MPI_Gatherv(local_source, local_size, MPI_UNSIGNED_LONG, target, receive_counts,
                 receive_displacements, MPI_UNSIGNED_LONG, 0, comm);
+    communication_metrics::add_gather_time(MPI_Wtime() - gather_start);
   }
 
   /**
@@ -220,18 +231,49 @@ class CollectiveDataset {
    * This constructor initializes a Dataset with the provided store object by initialising a
    * ZarrGroup and writing some additional metatdata for Xarray and NetCDF.
    *
+   * If shard_nchunks is greater than 0, the dataset obeys the Zarr storage specification version 3
+   * and the chunks of its arrays are packed into shards of shard_nchunks chunks along the
+   * outermost dimension of each array.
+   *
+   * The metadata for the shape of each array is committed to the store at most once every
+   * commit_interval writes to the array (and when the array is destroyed). In crash safe mode
+   * data held in memory by an array is written to the store before each commit so that the data
+   * in the store is consistent with the metadata up to the last commit.
+   *
    * @param store The store object associated with the Dataset.
+   * @param shard_nchunks The number of chunks in each shard of arrays (0 means no sharding).
+   * @param commit_interval The number of writes to an array between commits of its shape.
+   * @param crash_safe If true, data is written to the store before each commit of an array's shape.
    */
-  explicit CollectiveDataset(Store& store) : group(store), datasetdims() {
-    store[".zattrs"] =
+  explicit CollectiveDataset(Store& store, const size_t shard_nchunks = 0,
+                             const size_t commit_interval = 1, const bool crash_safe = false)
+      : group(store, shard_nchunks > 0),
+        datasetdims(),
+        shard_nchunks(shard_nchunks),
+        commits({commit_interval, crash_safe, group.consolidated}) {
+    group.write_attributes(
         "{\n"
         "  \"creator\": \"Clara Bayley\",\n"
         "  \"title\": \"Dataset from CLEO is Xarray and NetCDF compatible Zarr Group of Arrays\""
-        "\n}";
+        "\n}");
     global_superdroplet_ordering = std::make_shared<std::vector<unsigned int>>();
     comm = init_communicator::get_communicator();
   }
 
+  /**
+   * @brief Destroys the Dataset and writes the consolidated metadata of its group and arrays
+   * (on rank 0 only, which writes the metadata of the arrays).
+   *
+   * Arrays record their shape for the consolidated metadata every time it changes when they are
+   * written, so the consolidated metadata contains the final shapes of the arrays regardless of
+   * whether the arrays are destroyed before or after the dataset.
+   */
+  ~CollectiveDataset() {
+    if (init_communicator::get_comm_rank() == 0) {
+      group.write_consolidated_metadata();
+    }
+  }
+
   /**
    * @brief Returns the size of an existing dimension in the dataset.
    *
@@ -292,7 +334,7 @@ class CollectiveDataset {
                                          const std::vector<size_t>& chunkshape,
                                          const std::vector<std::string>& dimnames) const {
     return XarrayZarrArray<Store, T>(group.store, datasetdims, name, units, scale_factor,
-                                     chunkshape, dimnames);
+                                     chunkshape, dimnames, shard_nchunks, commits);
   }
 
   /**
@@ -336,7 +378,8 @@ class CollectiveDataset {
                                                 const std::vector<std::string>& dimnames,
                                                 const std::string_view sampledimname) const {
     return XarrayZarrArray<Store, T>(group.store, datasetdims, name, units, scale_factor,
-                                     chunkshape, dimnames, sampledimname);
+                                     chunkshape, dimnames, sampledimname, shard_nchunks,
+                                     commits);
   }
 
   /**
@@ -359,7 +402,8 @@ class CollectiveDataset {
                                                      const std::vector<std::string>& dimnames,
                                                      const std::string_view sampledimname) const {
     return XarrayZarrArray<Store, T>(group.store, datasetdims, name, units, scale_factor,
-                                     chunkshape, dimnames, sampledimname);
+                                     chunkshape, dimnames, sampledimname, shard_nchunks,
+                                     commits);
   }
 
   /**
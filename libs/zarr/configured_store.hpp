@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: configured_store.hpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Function to create the type of store for output data chosen by the configuration and call a
+ * function (e.g. which creates a dataset and runs CLEO) with it.
+ */
+
+#ifndef LIBS_ZARR_CONFIGURED_STORE_HPP_
+#define LIBS_ZARR_CONFIGURED_STORE_HPP_
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "configuration/config.hpp"
+#include "zarr/fsstore.hpp"
+#include "zarr/memory_store.hpp"
+#include "zarr/mmap_store.hpp"
+#include "zarr/posix_fsstore.hpp"
+
+/**
+ * @brief Creates the store for output data chosen by the configuration and calls func(store).
+ *
+ * Store is created in the base directory for zarr output given by the configuration with type:
+ * "fsstore" (FSStore), "posix" (PosixFSStore), "mmap" (MmapStore) or "memory" (MemoryStore).
+ * After func returns, i.e. once all the arrays written to the store have been destroyed, a
+ * MemoryStore is dumped to the zarr base directory ("directory"), to a zip file with the path of
+ * the zarr base directory plus ".zip" ("zip"), or not at all ("none"); a std::runtime_error is
+ * thrown if the dump fails. Since func is called with each type of store, func is usually a
+ * generic lambda, e.g.
+ * `[&](auto& store) { auto dataset = SimpleDataset(store); ... }`.
+ *
+ * @tparam Func Type of function to call with the store.
+ * @param config Configuration of CLEO.
+ * @param func Function to call with the store.
+ */
+template <typename Func>
+inline void with_configured_store(const Config& config, const Func func) {
+  const auto params = config.get_store();
+  const auto zarrbasedir = config.get_zarrbasedir();
+
+  if (params.type == "fsstore") {
+    auto store = FSStore(zarrbasedir);
+    func(store);
+  } else if (params.type == "posix") {
+    auto store = PosixFSStore(zarrbasedir, params.max_open_files, params.preallocate,
+                              params.batch_nbytes, fsync_policy_from_string(params.fsync),
+                              params.fsync_nobs);
+    func(store);
+  } else if (params.type == "mmap") {
+    auto store = MmapStore(zarrbasedir, params.max_open_files);
+    func(store);
+  } else if (params.type == "memory") {
+    auto store = MemoryStore();
+    func(store);
+    if (params.memory_dump == "directory") {
+      if (!store.dump_to_directory(zarrbasedir)) {
+        throw std::runtime_error("failed to dump memory store to directory " +
+                                 zarrbasedir.string());
+      }
+    } else if (params.memory_dump == "zip") {
+      const auto zipfile = std::filesystem::path(zarrbasedir.string() + ".zip");
+      if (!store.dump_to_zip(zipfile)) {
+        throw std::runtime_error("failed to dump memory store to zip file " + zipfile.string());
+      }
+    }
+  } else {
+    throw std::invalid_argument("unknown store type '" + params.type + "'");
+  }
+}
+
+#endif  // LIBS_ZARR_CONFIGURED_STORE_HPP_
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: consolidated_metadata.hpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Class to collect the metadata of a Zarr group and its arrays in order to write it all together
+ * as consolidated metadata, e.g. in a .zmetadata json file.
+ */
+
+#ifndef LIBS_ZARR_CONSOLIDATED_METADATA_HPP_
+#define LIBS_ZARR_CONSOLIDATED_METADATA_HPP_
+
+#include <map>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Metadata of a Zarr group and its arrays collected under the keys they are written to.
+ *
+ * Arrays record their latest metadata each time they write it to the store so that the metadata
+ * of a whole group can be written in one place when the group is closed. This means a reader
+ * (e.g. xarray's `open_zarr(consolidated=True)`) needs to read only one key, rather than one (or
+ * two) per array, to open the group. For Zarr storage specification version 2 keys are e.g.
+ * ".zgroup", ".zattrs", "name/.zarray" and "name/.zattrs", whereas for version 3 keys are the
+ * names of the arrays with the contents of their zarr.json metadata.
+ */
+class ConsolidatedMetadata {
+ private:
+  std::map<std::string, std::string> metadata; /**< JSON metadata under each key (sorted) */
+
+  /**
+   * @brief Returns the collected metadata as a JSON object of each key and its metadata.
+   *
+   * @param indent The indentation of the keys in the JSON object.
+   * @return The JSON object for the collected metadata.
+   */
+  std::string metadata_object(const std::string& indent) const {
+    auto json = std::string{"{"};
+    auto sep = std::string{"\n"};
+    for (const auto& [key, value] : metadata) {
+      json += sep + indent + "\"" + key + "\": " + value;
+      sep = ",\n";
+    }
+    return json + "\n" + indent.substr(2) + "}";
+  }
+
+ public:
+  /**
+   * @brief Sets (or replaces) the metadata under a key.
+   *
+   * @param key The key the metadata is written to in the store (relative to the group).
+   * @param json The metadata as a JSON object.
+   */
+  void set(const std::string& key, const std::string_view json) { metadata[key] = json; }
+
+  /**
+   * @brief Returns the consolidated metadata for Zarr storage specification version 2, i.e. the
+   * contents of a .zmetadata json file as written by zarr-python.
+   *
+   * @return The consolidated metadata as a JSON object.
+   */
+  std::string zmetadata() const {
+    return "{\n"
+           "  \"metadata\": " +
+           metadata_object("    ") +
+           ",\n"
+           "  \"zarr_consolidated_format\": 1\n"
+           "}";
+  }
+
+  /**
+   * @brief Returns the consolidated metadata for Zarr storage specification version 3, i.e. the
+   * inline "consolidated_metadata" of a group's zarr.json as written by zarr-python.
+   *
+   * @return The consolidated metadata as a JSON object.
+   */
+  std::string zarr_v3_inline() const {
+    return "{\n"
+           "    \"kind\": \"inline\",\n"
+           "    \"must_understand\": false,\n"
+           "    \"metadata\": " +
+           metadata_object("      ") + "\n  }";
+  }
+};
+
+#endif  // LIBS_ZARR_CONSOLIDATED_METADATA_HPP_
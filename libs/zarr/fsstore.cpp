@@ -49,5 +49,6 @@ bool FSStore::write(std::string_view key, std::span<const uint8_t> buffer) const
   }
 
   out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+  nbytes_written += buffer.size();
   return true;
 }
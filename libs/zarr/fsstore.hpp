@@ -39,6 +39,7 @@
 class FSStore {
  private:
   const std::filesystem::path basedir; /**< The root directory of the file system store. */
+  mutable size_t nbytes_written;       /**< Total number of bytes written to the store. */
 
  public:
   /**
@@ -46,7 +47,7 @@ class FSStore {
    *
    * @param basedir The root directory of the file system store.
    */
-  explicit FSStore(const std::filesystem::path basedir) : basedir(basedir) {}
+  explicit FSStore(const std::filesystem::path basedir) : basedir(basedir), nbytes_written(0) {}
 
   /**
    * @brief Operator to use a StoreAccessor to write values under a given key.
@@ -71,6 +72,13 @@ class FSStore {
    * @return True if the write operation is successful, false otherwise.
    */
   bool write(const std::string_view key, const std::span<const uint8_t> buffer) const;
+
+  /**
+   * @brief Returns the total number of bytes successfully written to the store so far.
+   *
+   * @return Total number of bytes written (data and metadata).
+   */
+  size_t get_nbytes_written() const { return nbytes_written; }
 };
 
 #endif  // LIBS_ZARR_FSSTORE_HPP_
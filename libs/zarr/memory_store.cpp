@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: memory_store.cpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functionality for class for holding memory in a store under a given key in (host) memory.
+ */
+
+#include "./memory_store.hpp"
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include "zarr/fsstore.hpp"
+
+/**
+ * @brief Returns the CRC-32 checksum (as used by zip files) of some bytes.
+ *
+ * @param bytes The bytes to checksum.
+ * @return The CRC-32 of the bytes.
+ */
+static uint32_t crc32(const std::span<const uint8_t> bytes) {
+  static const auto table = []() {
+    auto t = std::array<uint32_t, 256>{};
+    for (uint32_t n = 0; n < 256; ++n) {
+      auto c = n;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      t.at(n) = c;
+    }
+    return t;
+  }();
+
+  auto crc = uint32_t{0xFFFFFFFFu};
+  for (const auto b : bytes) {
+    crc = table[(crc ^ b) & 0xFFu] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+/**
+ * @brief Appends a little endian unsigned integer of nbytes bytes to a vector of bytes.
+ *
+ * @param out The vector to append to.
+ * @param value The value of the integer.
+ * @param nbytes The number of bytes of the integer.
+ */
+static void append_le(std::vector<uint8_t>& out, const uint32_t value, const size_t nbytes) {
+  for (size_t i = 0; i < nbytes; ++i) {
+    out.push_back(static_cast<uint8_t>((value >> (8 * i)) & 0xFFu));
+  }
+}
+
+/**
+ * @brief Returns the keys in the store (sorted).
+ *
+ * @return Vector of all the keys in the store.
+ */
+std::vector<std::string> MemoryStore::keys() const {
+  auto ks = std::vector<std::string>{};
+  for (const auto& [key, value] : values) {
+    ks.push_back(key);
+  }
+  return ks;
+}
+
+/**
+ * @brief Returns the total number of bytes currently held by the store.
+ *
+ * @return Total number of bytes of all the values in the store.
+ */
+size_t MemoryStore::get_nbytes_stored() const {
+  auto nbytes = size_t{0};
+  for (const auto& [key, value] : values) {
+    nbytes += value.size();
+  }
+  return nbytes;
+}
+
+/**
+ * @brief Writes each key-value pair in the store to a file in a directory (as an FSStore would).
+ *
+ * @param dir The root directory of the file system store to dump the store to.
+ * @return True if all the write operations are successful, false otherwise.
+ */
+bool MemoryStore::dump_to_directory(const std::filesystem::path dir) const {
+  const auto fsstore = FSStore(dir);
+
+  auto is_good = true;
+  for (const auto& [key, value] : values) {
+    is_good = fsstore.write(key, value) && is_good;
+  }
+  return is_good;
+}
+
+/**
+ * @brief Writes the store to a zip file with one (uncompressed) entry per key-value pair.
+ *
+ * Each entry is "stored" (compression method 0) with a local file header, followed by a central
+ * directory and end of central directory record. Modification time of entries is 1980-01-01 00:00.
+ * Throws an error if the store is too large for a zip file without the zip64 extension (more
+ * than 65535 keys or 4 GiB of data).
+ *
+ * @param zippath The path of the zip file to write.
+ * @return True if the zip file is successfully written, false otherwise.
+ */
+bool MemoryStore::dump_to_zip(const std::filesystem::path zippath) const {
+  constexpr auto maxu32 = size_t{std::numeric_limits<uint32_t>::max()};
+  if (values.size() > std::numeric_limits<uint16_t>::max()) {
+    throw std::runtime_error("too many keys in store to dump to zip file without zip64");
+  }
+
+  if (zippath.has_parent_path()) {
+    std::filesystem::create_directories(zippath.parent_path());
+  }
+  std::ofstream out(zippath, std::ios::out | std::ios::binary);
+  if (!out.good()) {
+    std::cout << "can't write to " << zippath << "\n";
+    return false;
+  }
+
+  constexpr uint32_t dosdate = (0 << 9) | (1 << 5) | 1;  // 1980-01-01
+  auto centraldir = std::vector<uint8_t>{};
+  auto offset = size_t{0};
+  for (const auto& [key, value] : values) {
+    if (offset + value.size() + key.size() + 30 >= maxu32) {
+      throw std::runtime_error("store too large to dump to zip file without zip64");
+    }
+    const auto crc = crc32(value);
+
+    auto header = std::vector<uint8_t>{};
+    append_le(header, 0x04034b50u, 4);  // local file header signature
+    append_le(header, 20, 2);           // version needed to extract
+    append_le(header, 0, 2);            // flags
+    append_le(header, 0, 2);            // compression method (stored)
+    append_le(header, 0, 2);            // modification time
+    append_le(header, dosdate, 2);      // modification date
+    append_le(header, crc, 4);
+    append_le(header, value.size(), 4);  // compressed size
+    append_le(header, value.size(), 4);  // uncompressed size
+    append_le(header, key.size(), 2);
+    append_le(header, 0, 2);  // extra field length
+    header.insert(header.end(), key.begin(), key.end());
+
+    append_le(centraldir, 0x02014b50u, 4);  // central directory file header signature
+    append_le(centraldir, 20, 2);           // version made by
+    centraldir.insert(centraldir.end(), header.begin() + 4, header.begin() + 30 - 2);
+    append_le(centraldir, 0, 2);  // extra field length
+    append_le(centraldir, 0, 2);  // file comment length
+    append_le(centraldir, 0, 2);  // disk number start
+    append_le(centraldir, 0, 2);  // internal file attributes
+    append_le(centraldir, 0, 4);  // external file attributes
+    append_le(centraldir, offset, 4);
+    centraldir.insert(centraldir.end(), key.begin(), key.end());
+
+    out.write(reinterpret_cast<const char*>(header.data()), header.size());
+    out.write(reinterpret_cast<const char*>(value.data()), value.size());
+    offset += header.size() + value.size();
+  }
+
+  auto end = std::vector<uint8_t>{};
+  append_le(end, 0x06054b50u, 4);  // end of central directory signature
+  append_le(end, 0, 2);            // number of this disk
+  append_le(end, 0, 2);            // disk where central directory starts
+  append_le(end, values.size(), 2);
+  append_le(end, values.size(), 2);
+  append_le(end, centraldir.size(), 4);
+  append_le(end, offset, 4);  // offset of start of central directory
+  append_le(end, 0, 2);       // comment length
+
+  out.write(reinterpret_cast<const char*>(centraldir.data()), centraldir.size());
+  out.write(reinterpret_cast<const char*>(end.data()), end.size());
+
+  if (!out.good()) {
+    std::cout << "can't write to " << zippath << "\n";
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: memory_store.hpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Class for holding memory in a store under a given key in (host) memory, which can be dumped to
+ * a file system store or to a zip file at the end of a run.
+ */
+
+#ifndef LIBS_ZARR_MEMORY_STORE_HPP_
+#define LIBS_ZARR_MEMORY_STORE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "zarr/store_accessor.hpp"
+
+/**
+ * @brief A store held entirely in memory e.g. for Zarr arrays or groups.
+ *
+ * This class represents a store for a series of key-value pairs with the same interface as
+ * FSStore, but where the value of each key is kept in (host) memory instead of being written to a
+ * file. The store is useful for benchmarks which should not measure the file system and for
+ * inspecting data written by datasets and observers without temporary directories. Its contents
+ * can be dumped to a directory (i.e. file system store) or to an (uncompressed) zip file, which is
+ * readable by e.g. zarr.storage.ZipStore in zarr-python, at the end of a run.
+ */
+class MemoryStore {
+ private:
+  std::map<std::string, std::vector<uint8_t>> values; /**< Value of each key in the store. */
+  size_t nbytes_written; /**< Total number of bytes written to the store. */
+
+ public:
+  MemoryStore() : values(), nbytes_written(0) {}
+
+  MemoryStore(const MemoryStore&) = delete;
+  MemoryStore& operator=(const MemoryStore&) = delete;
+
+  /**
+   * @brief Operator to use a StoreAccessor to write values under a given key.
+   *
+   * Usage: `operator[y] = x;` writes values x under a key called 'y' using the StoreAccessor.
+   *
+   * @param key The key for which the StoreAccessor is accessed.
+   * @return A StoreAccessor object associated with the specified key.
+   */
+  StoreAccessor<MemoryStore> operator[](const std::string_view key) { return {*this, key}; }
+
+  /**
+   * @brief Write function called by StoreAccessor to copy data into memory under the specified key
+   * after the data has been converted into a vector of unsigned integer types.
+   *
+   * @param key The key under which the data will be stored.
+   * @param buffer A span representing the range of memory containing the unsigned bytes to be
+   * written.
+   * @return True (write to memory always succeeds).
+   */
+  bool write(const std::string_view key, const std::span<const uint8_t> buffer) {
+    values[std::string(key)].assign(buffer.begin(), buffer.end());
+    nbytes_written += buffer.size();
+    return true;
+  }
+
+  /**
+   * @brief Returns true if a key exists in the store.
+   *
+   * @param key The key in the store.
+   * @return True if a value has been written under the key.
+   */
+  bool contains(const std::string_view key) const {
+    return values.find(std::string(key)) != values.end();
+  }
+
+  /**
+   * @brief Returns the value of a key in the store (throws std::out_of_range if key is missing).
+   *
+   * @param key The key in the store.
+   * @return A span of the bytes of the value under the key.
+   */
+  std::span<const uint8_t> get(const std::string_view key) const {
+    return values.at(std::string(key));
+  }
+
+  /**
+   * @brief Returns the keys in the store (sorted).
+   *
+   * @return Vector of all the keys in the store.
+   */
+  std::vector<std::string> keys() const;
+
+  /**
+   * @brief Returns the total number of bytes written to the store so far.
+   *
+   * @return Total number of bytes written (data and metadata, including overwritten values).
+   */
+  size_t get_nbytes_written() const { return nbytes_written; }
+
+  /**
+   * @brief Returns the total number of bytes currently held by the store.
+   *
+   * @return Total number of bytes of all the values in the store.
+   */
+  size_t get_nbytes_stored() const;
+
+  /**
+   * @brief Writes each key-value pair in the store to a file in a directory (as an FSStore would).
+   *
+   * @param dir The root directory of the file system store to dump the store to.
+   * @return True if all the write operations are successful, false otherwise.
+   */
+  bool dump_to_directory(const std::filesystem::path dir) const;
+
+  /**
+   * @brief Writes the store to a zip file with one (uncompressed) entry per key-value pair.
+   *
+   * Throws an error if the store is too large for a zip file without the zip64 extension (more
+   * than 65535 keys or 4 GiB of data).
+   *
+   * @param zippath The path of the zip file to write.
+   * @return True if the zip file is successfully written, false otherwise.
+   */
+  bool dump_to_zip(const std::filesystem::path zippath) const;
+};
+
+#endif  // LIBS_ZARR_MEMORY_STORE_HPP_
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: mmap_store.cpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functionality for class for writing memory in a file system store under a given key by copying
+ * it into a memory mapping of the file for that key.
+ */
+
+#include "./mmap_store.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+MmapStore::MmapStore(const std::filesystem::path basedir, const size_t max_mappings)
+    : basedir(basedir), max_mappings(max_mappings), mappings(), naccesses(0), nbytes_written(0) {
+  if (max_mappings == 0) {
+    throw std::invalid_argument("MmapStore must be allowed at least one mapping");
+  }
+}
+
+MmapStore::~MmapStore() {
+  for (const auto& [key, mapping] : mappings) {
+    if (mapping.addr) {
+      ::munmap(mapping.addr, mapping.capacity);
+    }
+  }
+}
+
+/**
+ * @brief Unmaps the least recently used mapping.
+ */
+void MmapStore::unmap_least_recently_used() {
+  auto lru = mappings.begin();
+  for (auto it = mappings.begin(); it != mappings.end(); ++it) {
+    if (it->second.last_use < lru->second.last_use) {
+      lru = it;
+    }
+  }
+
+  if (lru->second.addr) {
+    ::munmap(lru->second.addr, lru->second.capacity);
+  }
+  mappings.erase(lru);
+}
+
+/**
+ * @brief Resizes the file for a key (creating it and its directory if necessary) and grows its
+ * mapping if the file becomes larger than the mapping.
+ *
+ * The mapping grows to the larger of the new size and twice its previous size, so that the
+ * number of remappings of a key whose data keeps growing is logarithmic in its final size. Only
+ * the first "size" bytes of a mapping (i.e. within the file) are ever accessed.
+ *
+ * @param key The key of the file in the store.
+ * @param mapping The mapping of the file for the key.
+ * @param size The new size of the file [bytes].
+ * @param is_new True if the key has not been mapped before (i.e. the file's size is unknown).
+ * @return True if the file was successfully resized and mapped, false otherwise.
+ */
+bool MmapStore::resize(const std::string& key, Mapping& mapping, const size_t size,
+                       const bool is_new) {
+  const auto path = basedir / key;
+  auto fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+
+  if (fd < 0 && errno == ENOENT) {
+    std::cout << "couldn't open " << path << ",\n " << "making directory " << path.parent_path()
+              << "\n";
+    std::filesystem::create_directories(path.parent_path());
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  }
+
+  if (fd < 0) {
+    return false;
+  }
+
+  auto is_good = (::ftruncate(fd, size) == 0);
+  if (is_good && size > 0 && (is_new || size > mapping.size)) {
+    is_good = (::posix_fallocate(fd, 0, size) == 0);
+  }
+
+  if (is_good && size > mapping.capacity) {
+    const auto capacity = std::max(size, 2 * mapping.capacity);
+    auto addr = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    is_good = (addr != MAP_FAILED);
+    if (is_good) {
+      if (mapping.addr) {
+        ::munmap(mapping.addr, mapping.capacity);
+      }
+      mapping.addr = static_cast<uint8_t*>(addr);
+      mapping.capacity = capacity;
+    }
+  }
+  ::close(fd);  // mapping remains valid after file is closed
+
+  if (is_good) {
+    mapping.size = size;
+  }
+  return is_good;
+}
+
+/**
+ * @brief Write function called by StoreAccessor to write data to file system storage after the
+ * data has been converted into a vector of unsigned integer types.
+ *
+ * Data is copied into the (shared) memory mapping of the file for the key. The file is resized
+ * to the size of the data first if its size changes.
+ *
+ * @param key The key under which the data will be stored in the file system store.
+ * @param buffer A span representing the range of memory containing the unsigned bytes to be
+ * written.
+ * @return True if the write operation is successful, false otherwise.
+ */
+bool MmapStore::write(const std::string_view key, const std::span<const uint8_t> buffer) {
+  ++naccesses;
+
+  const auto skey = std::string(key);
+  auto it = mappings.find(skey);
+  const auto is_new = (it == mappings.end());
+  if (is_new) {
+    if (mappings.size() >= max_mappings) {
+      unmap_least_recently_used();
+    }
+    it = mappings.insert({skey, Mapping{nullptr, 0, 0, naccesses}}).first;
+  }
+
+  auto& mapping = it->second;
+  mapping.last_use = naccesses;
+  if ((is_new || buffer.size() != mapping.size) && !resize(skey, mapping, buffer.size(), is_new)) {
+    std::cout << "can't write to " << basedir / key << "\n";
+    if (is_new) {
+      mappings.erase(it);
+    }
+    return false;
+  }
+
+  if (buffer.size() > 0) {
+    std::memcpy(mapping.addr, buffer.data(), buffer.size());
+  }
+
+  nbytes_written += buffer.size();
+  return true;
+}
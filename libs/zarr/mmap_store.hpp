@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: mmap_store.hpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Class for writing memory in a file system store under a given key by copying it into a memory
+ * mapping of the file for that key.
+ */
+
+#ifndef LIBS_ZARR_MMAP_STORE_HPP_
+#define LIBS_ZARR_MMAP_STORE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "zarr/store_accessor.hpp"
+
+/**
+ * @brief A file system store e.g. for Zarr arrays or groups, written via memory mappings.
+ *
+ * This class represents a file system store for a series of key-value pairs with the same
+ * interface (and the same layout of files) as FSStore. Instead of streaming data through write
+ * calls, the file for each key is mapped into memory with mmap and the data is copied into the
+ * mapping. Writing data back to the file is then left to the operating system, which suits very
+ * large arrays whose chunks are much larger than the page size.
+ *
+ * The mapping of each key is kept between writes (for up to "max_mappings" keys, after which the
+ * least recently used mapping is unmapped), so rewriting a key with data of the same size (e.g.
+ * metadata rewritten with every observation) is only a copy into memory. The file of a key is
+ * only resized (and its space allocated so that a full disk is reported as an error rather than
+ * a SIGBUS) when the size of its data changes, and its mapping is only remapped when the data
+ * grows beyond the size of the mapping, in which case the mapping grows geometrically.
+ */
+class MmapStore {
+ private:
+  /**
+   * @brief A memory mapping of the file for a key.
+   */
+  struct Mapping {
+    uint8_t* addr;    /**< start of mapping (nullptr if nothing is mapped) */
+    size_t capacity;  /**< size of mapping [bytes] */
+    size_t size;      /**< current size of file [bytes] */
+    size_t last_use;  /**< number of the last access to the mapping (for least recently used) */
+  };
+
+  const std::filesystem::path basedir; /**< The root directory of the file system store. */
+  size_t max_mappings;                 /**< Maximum number of keys kept mapped at once. */
+  std::unordered_map<std::string, Mapping> mappings; /**< Mappings of files by key */
+  size_t naccesses;                                  /**< Total number of accesses to mappings */
+  size_t nbytes_written; /**< Total number of bytes written to the store. */
+
+  /**
+   * @brief Unmaps the least recently used mapping.
+   */
+  void unmap_least_recently_used();
+
+  /**
+   * @brief Resizes the file for a key (creating it and its directory if necessary) and grows its
+   * mapping if the file becomes larger than the mapping.
+   *
+   * @param key The key of the file in the store.
+   * @param mapping The mapping of the file for the key.
+   * @param size The new size of the file [bytes].
+   * @param is_new True if the key has not been mapped before (i.e. the file's size is unknown).
+   * @return True if the file was successfully resized and mapped, false otherwise.
+   */
+  bool resize(const std::string& key, Mapping& mapping, const size_t size, const bool is_new);
+
+ public:
+  /**
+   * @brief Constructs an MmapStore object with the specified base directory.
+   *
+   * @param basedir The root directory of the file system store.
+   * @param max_mappings Maximum number of keys kept mapped at once (must be > 0).
+   */
+  explicit MmapStore(const std::filesystem::path basedir, const size_t max_mappings = 64);
+
+  /**
+   * @brief Destroys the MmapStore object and unmaps all the mappings.
+   */
+  ~MmapStore();
+
+  MmapStore(const MmapStore&) = delete;
+  MmapStore& operator=(const MmapStore&) = delete;
+
+  /**
+   * @brief Operator to use a StoreAccessor to write values under a given key.
+   *
+   * Usage: `operator[y] = x;` writes values x under a key called 'y' using the StoreAccessor.
+   *
+   * @param key The key for which the StoreAccessor is accessed.
+   * @return A StoreAccessor object associated with the specified key.
+   */
+  StoreAccessor<MmapStore> operator[](const std::string_view key) { return {*this, key}; }
+
+  /**
+   * @brief Write function called by StoreAccessor to write data to file system storage after the
+   * data has been converted into a vector of unsigned integer types.
+   *
+   * Data is copied into the (shared) memory mapping of the file for the key. The file is resized
+   * to the size of the data first if its size changes.
+   *
+   * @param key The key under which the data will be stored in the file system store.
+   * @param buffer A span representing the range of memory containing the unsigned bytes to be
+   * written.
+   * @return True if the write operation is successful, false otherwise.
+   */
+  bool write(const std::string_view key, const std::span<const uint8_t> buffer);
+
+  /**
+   * @brief Returns the total number of bytes successfully written to the store so far.
+   *
+   * @return Total number of bytes written (data and metadata).
+   */
+  size_t get_nbytes_written() const { return nbytes_written; }
+};
+
+#endif  // LIBS_ZARR_MMAP_STORE_HPP_
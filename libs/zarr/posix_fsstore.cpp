@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: posix_fsstore.cpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Functionality for class for writing memory in a file system store under a given key using POSIX
+ * file descriptors which are cached between writes.
+ */
+
+#include "./posix_fsstore.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Returns FsyncPolicy from its name, "never", "end" or "every".
+ *
+ * @param name The name of the policy.
+ * @return The FsyncPolicy with that name.
+ */
+FsyncPolicy fsync_policy_from_string(const std::string_view name) {
+  if (name == "never") {
+    return FsyncPolicy::never;
+  } else if (name == "end") {
+    return FsyncPolicy::at_end;
+  } else if (name == "every") {
+    return FsyncPolicy::every_nobs;
+  }
+  throw std::invalid_argument("unknown fsync policy '" + std::string(name) +
+                              "', must be 'never', 'end' or 'every'");
+}
+
+PosixFSStore::PosixFSStore(const std::filesystem::path basedir, const size_t max_open_files,
+                           const bool preallocate, const size_t batch_nbytes,
+                           const FsyncPolicy fsync_policy, const unsigned int fsync_nobs)
+    : basedir(basedir),
+      max_open_files(max_open_files),
+      preallocate(preallocate),
+      batch_nbytes(batch_nbytes),
+      fsync_policy(fsync_policy),
+      fsync_nobs(fsync_nobs),
+      handles(),
+      pending(),
+      pending_nbytes(0),
+      naccesses(0),
+      nobs(0),
+      nbytes_written(0) {
+  if (max_open_files == 0) {
+    throw std::invalid_argument("PosixFSStore must be allowed at least one open file");
+  }
+  if (fsync_policy == FsyncPolicy::every_nobs && fsync_nobs == 0) {
+    throw std::invalid_argument("number of observations between fsyncs must be > 0");
+  }
+}
+
+PosixFSStore::~PosixFSStore() {
+  flush();
+  for (const auto& [key, handle] : handles) {
+    close_file(handle);
+  }
+
+  if (fsync_policy == FsyncPolicy::at_end && nbytes_written > 0 && !sync_filesystem()) {
+    std::cout << "can't sync file system of " << basedir << "\n";
+  }
+}
+
+/**
+ * @brief Returns the open file for a key, opening it (and creating its directory if necessary)
+ * if it isn't already in the cache. Returns nullptr if the file cannot be opened.
+ *
+ * @param key The key of the file in the store.
+ * @return Pointer to the handle of the open file.
+ */
+PosixFSStore::FileHandle* PosixFSStore::open_file(const std::string& key) {
+  ++naccesses;
+
+  const auto it = handles.find(key);
+  if (it != handles.end()) {
+    it->second.last_use = naccesses;
+    return &it->second;
+  }
+
+  if (handles.size() >= max_open_files) {
+    close_least_recently_used();
+  }
+
+  const auto path = basedir / key;
+  auto fd = ::open(path.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd < 0 && errno == ENOENT) {
+    std::cout << "couldn't open " << path << ",\n " << "making directory " << path.parent_path()
+              << "\n";
+    std::filesystem::create_directories(path.parent_path());
+    fd = ::open(path.c_str(), O_WRONLY | O_CREAT, 0644);
+  }
+
+  struct stat st;
+  if (fd < 0 || ::fstat(fd, &st) != 0) {
+    std::cout << "can't write to " << path << "\n";
+    if (fd >= 0) {
+      ::close(fd);
+    }
+    return nullptr;
+  }
+
+  const auto handle = FileHandle{fd, static_cast<size_t>(st.st_size), naccesses};
+  return &handles.insert({key, handle}).first->second;
+}
+
+/**
+ * @brief Closes the least recently used file in the cache (with an fsync first if the
+ * FsyncPolicy is every_nobs).
+ */
+void PosixFSStore::close_least_recently_used() {
+  auto lru = handles.begin();
+  for (auto it = handles.begin(); it != handles.end(); ++it) {
+    if (it->second.last_use < lru->second.last_use) {
+      lru = it;
+    }
+  }
+
+  close_file(lru->second);
+  handles.erase(lru);
+}
+
+/**
+ * @brief Closes a file (with an fsync first if the FsyncPolicy is every_nobs).
+ *
+ * Files are only synchronised individually for the every_nobs policy, so that files closed
+ * between observations are synchronised no later than the next synchronisation of the store.
+ * For the at_end policy the whole file system is synchronised once when the store is destroyed.
+ *
+ * @param handle The handle of the open file.
+ * @return True if the file was successfully (synchronised and) closed.
+ */
+bool PosixFSStore::close_file(const FileHandle& handle) const {
+  auto is_good = true;
+  if (fsync_policy == FsyncPolicy::every_nobs) {
+    is_good = (::fsync(handle.fd) == 0);
+  }
+  return (::close(handle.fd) == 0) && is_good;
+}
+
+/**
+ * @brief Synchronises the whole file system containing the store with the storage device in one
+ * call (syncfs, or sync where syncfs is not available).
+ *
+ * @return True if the file system was successfully synchronised.
+ */
+bool PosixFSStore::sync_filesystem() const {
+#ifdef __linux__
+  const auto fd = ::open(basedir.c_str(), O_RDONLY | O_DIRECTORY);
+  if (fd < 0) {
+    return false;
+  }
+  const auto is_good = (::syncfs(fd) == 0);
+  return (::close(fd) == 0) && is_good;
+#else
+  ::sync();
+  return true;
+#endif
+}
+
+/**
+ * @brief Writes data for a key to its file with positional write(s).
+ *
+ * @param key The key under which the data will be stored in the file system store.
+ * @param buffer A span representing the range of memory containing the unsigned bytes to be
+ * written.
+ * @return True if the write operation is successful, false otherwise.
+ */
+bool PosixFSStore::write_file(const std::string& key, const std::span<const uint8_t> buffer) {
+  auto handle = open_file(key);
+  if (!handle) {
+    return false;
+  }
+
+  if (preallocate && handle->size == 0 && buffer.size() > 0) {
+    ::posix_fallocate(handle->fd, 0, buffer.size());  // failure only loses the optimisation
+  }
+
+  auto nbytes = size_t{0};
+  while (nbytes < buffer.size()) {
+    const auto n = ::pwrite(handle->fd, buffer.data() + nbytes, buffer.size() - nbytes, nbytes);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n <= 0) {
+      std::cout << "can't write to " << basedir / key << "\n";
+      return false;
+    }
+    nbytes += n;
+  }
+
+  if (buffer.size() < handle->size && ::ftruncate(handle->fd, buffer.size()) != 0) {
+    std::cout << "can't truncate " << basedir / key << "\n";
+    return false;
+  }
+  handle->size = buffer.size();
+
+  nbytes_written += buffer.size();
+  return true;
+}
+
+/**
+ * @brief Write function called by StoreAccessor to write data to file system storage after the
+ * data has been converted into a vector of unsigned integer types.
+ *
+ * Data smaller than batch_nbytes replaces any batched data for the same key and is batched in
+ * memory until batch_nbytes bytes are pending, otherwise it is written to its file straight
+ * away.
+ *
+ * @param key The key under which the data will be stored in the file system store.
+ * @param buffer A span representing the range of memory containing the unsigned bytes to be
+ * written.
+ * @return True if the write operation is successful, false otherwise.
+ */
+bool PosixFSStore::write(const std::string_view key, const std::span<const uint8_t> buffer) {
+  const auto skey = std::string(key);
+  const auto it = pending.find(skey);
+
+  if (buffer.size() >= batch_nbytes) {
+    if (it != pending.end()) {
+      pending_nbytes -= it->second.size();
+      pending.erase(it);
+    }
+    return write_file(skey, buffer);
+  }
+
+  auto& value = (it != pending.end()) ? it->second : pending[skey];
+  pending_nbytes = pending_nbytes - value.size() + buffer.size();
+  value.assign(buffer.begin(), buffer.end());
+
+  if (pending_nbytes >= batch_nbytes) {
+    return flush();
+  }
+  return true;
+}
+
+/**
+ * @brief Writes all batched writes to their files.
+ *
+ * @return True if all the write operations are successful, false otherwise.
+ */
+bool PosixFSStore::flush() {
+  auto is_good = true;
+  for (const auto& [key, value] : pending) {
+    is_good = write_file(key, value) && is_good;
+  }
+  pending.clear();
+  pending_nbytes = 0;
+
+  return is_good;
+}
+
+/**
+ * @brief Writes all batched writes to their files and then synchronises all the open files with
+ * the storage device (fsync).
+ *
+ * @return True if all the write and fsync operations are successful, false otherwise.
+ */
+bool PosixFSStore::sync() {
+  auto is_good = flush();
+  for (const auto& [key, handle] : handles) {
+    if (::fsync(handle.fd) != 0) {
+      std::cout << "can't fsync " << basedir / key << "\n";
+      is_good = false;
+    }
+  }
+
+  return is_good;
+}
+
+/**
+ * @brief Counts an observation and synchronises the store if an observation is due to be
+ * synchronised according to the FsyncPolicy.
+ */
+void PosixFSStore::end_observation() {
+  ++nobs;
+  if (fsync_policy == FsyncPolicy::every_nobs && nobs % fsync_nobs == 0) {
+    sync();
+  }
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: posix_fsstore.hpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Class for writing memory in a file system store under a given key using POSIX file
+ * descriptors which are cached between writes, with batching of small writes and an explicit
+ * policy for when data is synchronised with the storage device (fsync).
+ */
+
+#ifndef LIBS_ZARR_POSIX_FSSTORE_HPP_
+#define LIBS_ZARR_POSIX_FSSTORE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "zarr/store_accessor.hpp"
+
+/**
+ * @brief Policy for when data written to a PosixFSStore is synchronised with the storage device.
+ */
+enum class FsyncPolicy {
+  never,      /**< never fsync, leave it to the operating system */
+  at_end,     /**< sync file system of store once when store is destroyed (i.e. at end of run) */
+  every_nobs, /**< fsync all files every "fsync_nobs" observations and at the end */
+};
+
+/**
+ * @brief Returns FsyncPolicy from its name, "never", "end" or "every".
+ *
+ * @param name The name of the policy.
+ * @return The FsyncPolicy with that name.
+ */
+FsyncPolicy fsync_policy_from_string(const std::string_view name);
+
+/**
+ * @brief A file system store e.g. for Zarr arrays or groups, intended for high throughput.
+ *
+ * This class represents a file system store for a series of key-value pairs, with the same
+ * interface as FSStore, e.g. for storing Zarr data arrays or groups. Unlike FSStore which opens
+ * and closes a file for every write, this store:
+ * - keeps a cache of (at most "max_open_files") open file descriptors, closing the least
+ *   recently used when the cache is full,
+ * - writes with positional writes (pwrite) to the start of each file, truncating a file only if
+ *   its new value is shorter than its previous value,
+ * - optionally preallocates the space for new files (posix_fallocate),
+ * - batches writes of values smaller than "batch_nbytes" in memory until "batch_nbytes" bytes are
+ *   pending, so that repeated writes to the same key (e.g. .zarray or zarr.json metadata rewritten
+ *   with every observation) are coalesced into one write,
+ * - synchronises files with the storage device (fsync) according to an explicit FsyncPolicy.
+ *
+ * Batched writes are written to their files at the latest when the store is synchronised or
+ * destroyed. Observations are counted by calling end_observation (see SyncStoreObserver).
+ */
+class PosixFSStore {
+ private:
+  /**
+   * @brief An open file in the store.
+   */
+  struct FileHandle {
+    int fd;          /**< file descriptor */
+    size_t size;     /**< current size of file [bytes] */
+    size_t last_use; /**< number of the last access to the file (for least recently used) */
+  };
+
+  const std::filesystem::path basedir; /**< The root directory of the file system store. */
+  size_t max_open_files;               /**< Maximum number of files kept open at once. */
+  bool preallocate;                    /**< true = preallocate space for new files */
+  size_t batch_nbytes;                 /**< Maximum number of bytes of batched writes */
+  FsyncPolicy fsync_policy;            /**< When to synchronise files with storage device */
+  unsigned int fsync_nobs;             /**< Number of observations between fsyncs (every_nobs) */
+  std::unordered_map<std::string, FileHandle> handles; /**< Cache of open files by key */
+  std::map<std::string, std::vector<uint8_t>> pending; /**< Batched writes by key */
+  size_t pending_nbytes;                               /**< Total bytes of batched writes */
+  size_t naccesses;                                    /**< Total number of file accesses */
+  unsigned int nobs;                                   /**< Number of observations so far */
+  size_t nbytes_written; /**< Total number of bytes written to the store. */
+
+  /**
+   * @brief Returns the open file for a key, opening it (and creating its directory if necessary)
+   * if it isn't already in the cache. Returns nullptr if the file cannot be opened.
+   *
+   * @param key The key of the file in the store.
+   * @return Pointer to the handle of the open file.
+   */
+  FileHandle* open_file(const std::string& key);
+
+  /**
+   * @brief Closes the least recently used file in the cache (with an fsync first if the
+   * FsyncPolicy is every_nobs).
+   */
+  void close_least_recently_used();
+
+  /**
+   * @brief Closes a file (with an fsync first if the FsyncPolicy is every_nobs).
+   *
+   * Files are only synchronised individually for the every_nobs policy, so that files closed
+   * between observations are synchronised no later than the next synchronisation of the store.
+   * For the at_end policy the whole file system is synchronised once when the store is destroyed.
+   *
+   * @param handle The handle of the open file.
+   * @return True if the file was successfully (synchronised and) closed.
+   */
+  bool close_file(const FileHandle& handle) const;
+
+  /**
+   * @brief Synchronises the whole file system containing the store with the storage device in one
+   * call (syncfs, or sync where syncfs is not available).
+   *
+   * @return True if the file system was successfully synchronised.
+   */
+  bool sync_filesystem() const;
+
+  /**
+   * @brief Writes data for a key to its file with positional write(s).
+   *
+   * @param key The key under which the data will be stored in the file system store.
+   * @param buffer A span representing the range of memory containing the unsigned bytes to be
+   * written.
+   * @return True if the write operation is successful, false otherwise.
+   */
+  bool write_file(const std::string& key, const std::span<const uint8_t> buffer);
+
+ public:
+  /**
+   * @brief Constructs a PosixFSStore object with the specified base directory and settings.
+   *
+   * @param basedir The root directory of the file system store.
+   * @param max_open_files Maximum number of files kept open at once (must be > 0).
+   * @param preallocate true = preallocate space for new files.
+   * @param batch_nbytes Maximum number of bytes of batched writes (0 = no batching).
+   * @param fsync_policy When to synchronise files with storage device.
+   * @param fsync_nobs Number of observations between fsyncs if fsync_policy is every_nobs.
+   */
+  explicit PosixFSStore(const std::filesystem::path basedir, const size_t max_open_files = 64,
+                        const bool preallocate = false, const size_t batch_nbytes = 1048576,
+                        const FsyncPolicy fsync_policy = FsyncPolicy::at_end,
+                        const unsigned int fsync_nobs = 1);
+
+  /**
+   * @brief Destroys the PosixFSStore object.
+   *
+   * Writes any batched writes to their files then closes all the open files. Files are
+   * synchronised with the storage device according to the FsyncPolicy, i.e. each open file is
+   * synchronised for every_nobs, and the file system of the store is synchronised once for at_end.
+   */
+  ~PosixFSStore();
+
+  PosixFSStore(const PosixFSStore&) = delete;
+  PosixFSStore& operator=(const PosixFSStore&) = delete;
+
+  /**
+   * @brief Operator to use a StoreAccessor to write values under a given key.
+   *
+   * Usage: `operator[y] = x;` writes values x under a key called 'y' using the StoreAccessor.
+   *
+   * @param key The key for which the StoreAccessor is accessed.
+   * @return A StoreAccessor object associated with the specified key.
+   */
+  StoreAccessor<PosixFSStore> operator[](const std::string_view key) { return {*this, key}; }
+
+  /**
+   * @brief Write function called by StoreAccessor to write data to file system storage after the
+   * data has been converted into a vector of unsigned integer types.
+   *
+   * Data smaller than batch_nbytes replaces any batched data for the same key and is batched in
+   * memory until batch_nbytes bytes are pending, otherwise it is written to its file straight
+   * away.
+   *
+   * @param key The key under which the data will be stored in the file system store.
+   * @param buffer A span representing the range of memory containing the unsigned bytes to be
+   * written.
+   * @return True if the write operation is successful, false otherwise.
+   */
+  bool write(const std::string_view key, const std::span<const uint8_t> buffer);
+
+  /**
+   * @brief Writes all batched writes to their files.
+   *
+   * @return True if all the write operations are successful, false otherwise.
+   */
+  bool flush();
+
+  /**
+   * @brief Writes all batched writes to their files and then synchronises all the open files with
+   * the storage device (fsync).
+   *
+   * @return True if all the write and fsync operations are successful, false otherwise.
+   */
+  bool sync();
+
+  /**
+   * @brief Counts an observation and synchronises the store if an observation is due to be
+   * synchronised according to the FsyncPolicy.
+   */
+  void end_observation();
+
+  /**
+   * @brief Returns the total number of bytes successfully written to files in the store so far.
+   *
+   * Excludes batched writes which are not yet written to their files.
+   *
+   * @return Total number of bytes written (data and metadata).
+   */
+  size_t get_nbytes_written() const { return nbytes_written; }
+};
+
+#endif  // LIBS_ZARR_POSIX_FSSTORE_HPP_
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: shards.hpp
+ * Project: zarr
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * Class for packing many chunks of an array into a single shard in a store according to the
+ * sharding codec of the Zarr storage specification version 3
+ * (https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/v1.0.html)
+ */
+
+#ifndef LIBS_ZARR_SHARDS_HPP_
+#define LIBS_ZARR_SHARDS_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Class for writing chunks of an array to a store packed into shards.
+ *
+ * Each shard contains up to shard_nchunks chunks of an array which are consecutive along the
+ * array's outermost dimension. Chunks of a shard are kept in memory until the shard is complete,
+ * then the shard is written to the store as a single key containing the chunks followed by the
+ * shard's index (i.e. with index location "end"). The index is a little endian uint64 (offset,
+ * nbytes) pair for each chunk of the shard, with both values equal to 2^64-1 for chunks which are
+ * missing. Incomplete shards are written to the store by flush, e.g. at the end of a run.
+ */
+class Shards {
+ private:
+  /**
+   * @brief A shard being filled with chunks before it is written to the store.
+   */
+  struct OpenShard {
+    std::vector<uint8_t> data;   /**< bytes of the chunks in the shard so far */
+    std::vector<uint64_t> index; /**< (offset, nbytes) of each chunk in the shard */
+    size_t nchunks;              /**< number of chunks in the shard so far */
+  };
+
+  static constexpr uint64_t missing = std::numeric_limits<uint64_t>::max(); /**< empty chunk */
+  size_t shard_nchunks; /**< number of chunks of each shard along outermost dimension of array */
+  std::map<std::string, OpenShard> open_shards; /**< incomplete shards labelled by their key */
+
+  /**
+   * @brief Returns the key of the shard containing a chunk and the chunk's slot in that shard.
+   *
+   * The key of the shard is "c." followed by the label of the shard along each dimension
+   * (separated by "."), i.e. the default chunk key encoding with "." separator. Shard label is
+   * the same as the chunk's label except along the outermost dimension where it is
+   * chunk_labnums[0] / shard_nchunks.
+   *
+   * @param chunk_labnums Number of the chunk along each dimension of the array.
+   * @return Pair of the key of the shard and the slot of the chunk in the shard.
+   */
+  std::pair<std::string, size_t> shard_key(const std::vector<size_t>& chunk_labnums) const {
+    auto key = std::string{"c." + std::to_string(chunk_labnums.at(0) / shard_nchunks)};
+    for (size_t aa = 1; aa < chunk_labnums.size(); ++aa) {
+      key += "." + std::to_string(chunk_labnums.at(aa));
+    }
+    return {key, chunk_labnums.at(0) % shard_nchunks};
+  }
+
+  /**
+   * @brief Adds a chunk to its shard in a map of shards (creating the shard if it is new).
+   *
+   * @param shards Map of shards labelled by their key.
+   * @param chunk_labnums Number of the chunk along each dimension of the array.
+   * @param chunk The bytes of the chunk.
+   * @return Iterator to the shard which the chunk was added to.
+   */
+  std::map<std::string, OpenShard>::iterator add_chunk(std::map<std::string, OpenShard>& shards,
+                                                       const std::vector<size_t>& chunk_labnums,
+                                                       const std::span<const uint8_t> chunk) const {
+    const auto [key, slot] = shard_key(chunk_labnums);
+
+    auto [it, is_new] = shards.try_emplace(key);
+    auto& shard = it->second;
+    if (is_new) {
+      shard.index.assign(2 * shard_nchunks, missing);
+      shard.nchunks = 0;
+    }
+
+    shard.index.at(2 * slot) = shard.data.size();
+    shard.index.at(2 * slot + 1) = chunk.size();
+    shard.data.insert(shard.data.end(), chunk.begin(), chunk.end());
+    ++shard.nchunks;
+
+    return it;
+  }
+
+  /**
+   * @brief Writes a shard (chunks followed by index) to the store.
+   *
+   * The shard's data is appended with its index, so the shard must not have chunks added to it
+   * after it has been written.
+   *
+   * @tparam Store The type of the store.
+   * @param store Reference to the store where the shard will be written.
+   * @param name Name of the array in the store.
+   * @param key Key of the shard.
+   * @param shard The shard to write.
+   */
+  template <typename Store>
+  static void write_shard(Store& store, const std::string_view name, const std::string& key,
+                          OpenShard& shard) {
+    const auto index_bytes = reinterpret_cast<const uint8_t*>(shard.index.data());
+    shard.data.insert(shard.data.end(), index_bytes,
+                      index_bytes + shard.index.size() * sizeof(uint64_t));
+
+    store[std::string(name) + '/' + key] = std::span<const uint8_t>(shard.data);
+  }
+
+ public:
+  /**
+   * @brief Constructs a Shards object.
+   *
+   * @param shard_nchunks The number of chunks in each shard (0 means no sharding).
+   */
+  explicit Shards(const size_t shard_nchunks) : shard_nchunks(shard_nchunks), open_shards() {}
+
+  /**
+   * @brief Returns true if chunks are written packed into shards.
+   */
+  bool is_sharded() const { return shard_nchunks > 0; }
+
+  /**
+   * @brief Gets the number of chunks in each shard along the outermost dimension of the array.
+   */
+  size_t get_shard_nchunks() const { return shard_nchunks; }
+
+  /**
+   * @brief Adds a chunk to its shard and writes the shard to the store if it is then complete.
+   *
+   * @tparam Store The type of the store.
+   * @param store Reference to the store where the shard will be written.
+   * @param name Name of the array in the store.
+   * @param chunk_labnums Number of the chunk along each dimension of the array.
+   * @param chunk The bytes of the chunk.
+   */
+  template <typename Store>
+  void write_chunk(Store& store, const std::string_view name,
+                   const std::vector<size_t>& chunk_labnums, const std::span<const uint8_t> chunk) {
+    auto it = add_chunk(open_shards, chunk_labnums, chunk);
+
+    if (it->second.nchunks == shard_nchunks) {
+      write_shard(store, name, it->first, it->second);
+      open_shards.erase(it);
+    }
+  }
+
+  /**
+   * @brief Writes copies of all incomplete shards to the store, optionally with an extra chunk
+   * (e.g. a partially filled buffer) added to the copy of its shard, but without forgetting the
+   * shards (or adding the extra chunk to them).
+   *
+   * Useful to make chunks held in memory readable from the store before the shards are complete,
+   * e.g. to keep data consistent with an array's metadata in case a run does not end cleanly. The
+   * shards are overwritten in the store when they are complete or flushed.
+   *
+   * @tparam Store The type of the store.
+   * @param store Reference to the store where the shards will be written.
+   * @param name Name of the array in the store.
+   * @param chunk_labnums Number of the extra chunk along each dimension of the array.
+   * @param chunk The bytes of the extra chunk (empty for no extra chunk).
+   */
+  template <typename Store>
+  void write_snapshot(Store& store, const std::string_view name,
+                      const std::vector<size_t>& chunk_labnums,
+                      const std::span<const uint8_t> chunk) const {
+    auto snapshot = open_shards;
+    if (!chunk.empty()) {
+      add_chunk(snapshot, chunk_labnums, chunk);
+    }
+
+    for (auto& [key, shard] : snapshot) {
+      write_shard(store, name, key, shard);
+    }
+  }
+
+  /**
+   * @brief Writes all incomplete shards to the store (with their missing chunks marked as empty).
+   *
+   * @tparam Store The type of the store.
+   * @param store Reference to the store where the shards will be written.
+   * @param name Name of the array in the store.
+   */
+  template <typename Store>
+  void flush(Store& store, const std::string_view name) {
+    for (auto& [key, shard] : open_shards) {
+      write_shard(store, name, key, shard);
+    }
+    open_shards.clear();
+  }
+};
+
+#endif  // LIBS_ZARR_SHARDS_HPP_
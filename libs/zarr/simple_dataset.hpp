@@ -35,8 +35,8 @@
  * in a storage system.
  *
  * This class provides functionality to create a dataset as a group of arrays obeying the Zarr
- * storage specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html) that is also
- * compatible with Xarray and NetCDF.
+ * storage specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html), or version
+ * 3 if its arrays are sharded, that is also compatible with Xarray and NetCDF.
  *
  * @tparam Store The type of the store object used by the dataset.
  */
@@ -46,6 +46,8 @@ class SimpleDataset {
   ZarrGroup<Store> group; /**< Reference to the zarr group object. */
   std::unordered_map<std::string, size_t>
       datasetdims; /**< map from name of each dimension in dataset to their size */
+  size_t shard_nchunks;    /**< number of chunks in each shard of arrays (0 means no sharding) */
+  MetadataCommits commits; /**< settings for commits of the shape of arrays to the store */
 
   /**
    * @brief Adds a dimension to the dataset.
@@ -63,16 +65,42 @@ class SimpleDataset {
    * This constructor initializes a Dataset with the provided store object by initialising a
    * ZarrGroup and writing some additional metatdata for Xarray and NetCDF.
    *
+   * If shard_nchunks is greater than 0, the dataset obeys the Zarr storage specification version 3
+   * and the chunks of its arrays are packed into shards of shard_nchunks chunks along the
+   * outermost dimension of each array.
+   *
+   * The metadata for the shape of each array is committed to the store at most once every
+   * commit_interval writes to the array (and when the array is destroyed). In crash safe mode
+   * data held in memory by an array is written to the store before each commit so that the data
+   * in the store is consistent with the metadata up to the last commit.
+   *
    * @param store The store object associated with the Dataset.
+   * @param shard_nchunks The number of chunks in each shard of arrays (0 means no sharding).
+   * @param commit_interval The number of writes to an array between commits of its shape.
+   * @param crash_safe If true, data is written to the store before each commit of an array's shape.
    */
-  explicit SimpleDataset(Store& store) : group(store), datasetdims() {
-    store[".zattrs"] =
+  explicit SimpleDataset(Store& store, const size_t shard_nchunks = 0,
+                         const size_t commit_interval = 1, const bool crash_safe = false)
+      : group(store, shard_nchunks > 0),
+        datasetdims(),
+        shard_nchunks(shard_nchunks),
+        commits({commit_interval, crash_safe, group.consolidated}) {
+    group.write_attributes(
         "{\n"
         "  \"creator\": \"Clara Bayley\",\n"
         "  \"title\": \"Dataset from CLEO is Xarray and NetCDF compatible Zarr Group of Arrays\""
-        "\n}";
+        "\n}");
   }
 
+  /**
+   * @brief Destroys the Dataset and writes the consolidated metadata of its group and arrays.
+   *
+   * Arrays record their shape for the consolidated metadata every time it changes when they are
+   * written, so the consolidated metadata contains the final shapes of the arrays regardless of
+   * whether the arrays are destroyed before or after the dataset.
+   */
+  ~SimpleDataset() { group.write_consolidated_metadata(); }
+
   /**
    * @brief Returns the size of an existing dimension in the dataset.
    *
@@ -107,7 +135,7 @@ class SimpleDataset {
                                          const std::vector<size_t>& chunkshape,
                                          const std::vector<std::string>& dimnames) const {
     return XarrayZarrArray<Store, T>(group.store, datasetdims, name, units, scale_factor,
-                                     chunkshape, dimnames);
+                                     chunkshape, dimnames, shard_nchunks, commits);
   }
 
   /**
@@ -151,7 +179,8 @@ class SimpleDataset {
                                                 const std::vector<std::string>& dimnames,
                                                 const std::string_view sampledimname) const {
     return XarrayZarrArray<Store, T>(group.store, datasetdims, name, units, scale_factor,
-                                     chunkshape, dimnames, sampledimname);
+                                     chunkshape, dimnames, sampledimname, shard_nchunks,
+                                     commits);
   }
 
   /**
@@ -174,7 +203,8 @@ class SimpleDataset {
                                                      const std::vector<std::string>& dimnames,
                                                      const std::string_view sampledimname) const {
     return XarrayZarrArray<Store, T>(group.store, datasetdims, name, units, scale_factor,
-                                     chunkshape, dimnames, sampledimname);
+                                     chunkshape, dimnames, sampledimname, shard_nchunks,
+                                     commits);
   }
 
   /**
@@ -28,6 +28,15 @@
 #include <string_view>
 #include <vector>
 
+/**
+ * @brief Converts vector of strings, e.g. for names of dimensions,into a single list written
+ * as a string.
+ *
+ * @param dims The vector of strings to be converted.
+ * @return A string representing the converted list.
+ */
+std::string vecstr_to_string(const std::vector<std::string>& dims);
+
 /**
  * @brief Make string of array attributes metadata for .zattrs json which is used to make zarr array
  * compatible with Xarray and NetCDF for a certain data type, T.
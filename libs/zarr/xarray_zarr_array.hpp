@@ -25,6 +25,7 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Pair.hpp>
 #include <algorithm>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -32,6 +33,7 @@
 #include <vector>
 
 #include "configuration/communicator.hpp"
+#include "zarr/consolidated_metadata.hpp"
 #include "zarr/xarray_metadata.hpp"
 #include "zarr/zarr_array.hpp"
 
@@ -54,6 +56,30 @@ inline void write_zattrs_json(Store& store, std::string_view name, std::string_v
   store[std::string(name) + "/.zattrs"] = attrs;
 }
 
+/**
+ * @brief Write attributes of a Zarr array, either to a .zattrs key in the store or, if the array
+ * is sharded (i.e. obeys Zarr storage specification version 3), as part of its zarr.json metadata
+ * together with the names of its dimensions.
+ *
+ * @tparam Store The type of the store object where the metadata will be written.
+ * @tparam T The data type of the array.
+ * @param store The store object where the metadata will be written.
+ * @param zarr The Zarr array.
+ * @param name The name of the array in the store.
+ * @param attrs The attributes of the array.
+ * @param dimnames The names of each dimension of the array.
+ */
+template <typename Store, typename T>
+inline void write_array_attributes(Store& store, ZarrArray<Store, T>& zarr, std::string_view name,
+                                   std::string_view attrs,
+                                   const std::vector<std::string>& dimnames) {
+  if (zarr.is_sharded()) {
+    zarr.set_attributes(attrs, vecstr_to_string(dimnames));
+  } else {
+    write_zattrs_json(store, name, attrs);
+  }
+}
+
 /**
  * @brief Calculate the reduced array shape of an array given the name of its dimensions and the
  * dataset's dimensions.
@@ -81,6 +107,24 @@ inline std::vector<size_t> reduced_arrayshape_from_dims(
   return reduced_arrayshape;
 }
 
+/**
+ * @brief Settings for when an XarrayZarrArray commits (i.e. writes) the metadata for its shape to
+ * the store and where it records its metadata for consolidation.
+ *
+ * The array's shape is committed at most once every "interval" calls to write the array's shape
+ * (e.g. once every "interval" observations) and always when the array is destroyed. In crash safe
+ * mode all the data written to the array so far, including data held in memory in its buffer
+ * (and shards), is written to the store before each commit, so that the data in the store is
+ * consistent with the array's metadata up to the last commit if a run does not end cleanly.
+ */
+struct MetadataCommits {
+  size_t interval = 1;     /**< number of calls to write array's shape between commits */
+  bool crash_safe = false; /**< true if data in memory is written to store before each commit */
+
+  /** records array's metadata for consolidation (nullptr for no recording) */
+  std::shared_ptr<ConsolidatedMetadata> consolidated = nullptr;
+};
+
 /**
  * @brief Zarr array with additional metadata and functions to constrain the shape of array to the
  * shape of its dimensions in a dataset in order to ensure Zarr array is compatibile with NetCDF
@@ -94,11 +138,77 @@ class XarrayZarrArray {
  private:
   using viewh_buffer = Buffer<T>::viewh_buffer;
   ZarrArray<Store, T> zarr;          /**< zarr array in store */
+  std::string name;                  /**< name of array in store */
   std::vector<std::string> dimnames; /**< ordered list of names of each dimenion of array */
   std::vector<size_t> arrayshape;    /**< current size of the array along each of its dimensions */
+  std::vector<size_t> commitshape;   /**< size of array in its metadata in store (at last commit) */
   size_t last_totnchunks;            /**< Number of chunks of array since arrayshape last written */
+  size_t nshape_writes;              /**< Number of calls to write arrayshape since array created */
+  MetadataCommits commits;           /**< settings for commits of the array's shape */
   MPI_Comm comm; /**< (YAC compatible) communicator for MPI domain decomposition */
 
+  /**
+   * @brief Records the metadata of the array with the given shape (if recording for consolidated
+   * metadata).
+   *
+   * @param shape The shape of the array to record in its metadata.
+   */
+  void record_metadata(const std::vector<size_t>& shape) const {
+    if (commits.consolidated) {
+      const auto key = zarr.is_sharded() ? name : name + "/.zarray";
+      commits.consolidated->set(key, zarr.get_metadata(shape));
+    }
+  }
+
+  /**
+   * @brief Records the attributes of the array, and the metadata of the array with its current
+   * shape, (if recording for consolidated metadata).
+   *
+   * For a sharded array the attributes are part of its metadata, otherwise they are recorded
+   * separately as if under the array's .zattrs key.
+   *
+   * @param attrs The attributes of the array as a JSON object.
+   */
+  void record_attributes(const std::string& attrs) const {
+    if (commits.consolidated && !zarr.is_sharded()) {
+      commits.consolidated->set(name + "/.zattrs", attrs);
+    }
+    record_metadata(arrayshape);
+  }
+
+  /**
+   * @brief Writes the metadata for the current shape of the array to the store (after writing
+   * the data held in memory by the array if in crash safe mode).
+   */
+  void commit_arrayshape() {
+    if (commits.crash_safe) {
+      zarr.write_snapshot();
+    }
+    zarr.write_arrayshape(arrayshape);
+    commitshape = arrayshape;
+    last_totnchunks = zarr.get_totnchunks();
+  }
+
+  /**
+   * @brief Commits the current shape of the array if a commit is due and the shape has changed
+   * since the last commit.
+   *
+   * A commit is due once every "interval" calls of this function. In crash safe mode the shape is
+   * then committed if it has changed, otherwise it is only committed if it has changed and chunks
+   * have also been written since the last commit (the shape written may then include elements
+   * which are still in the buffer).
+   */
+  void commit_arrayshape_if_due() {
+    ++nshape_writes;
+    if (nshape_writes % commits.interval != 0 || arrayshape == commitshape) {
+      return;
+    }
+
+    if (commits.crash_safe || last_totnchunks != zarr.get_totnchunks()) {
+      commit_arrayshape();
+    }
+  }
+
   /**
    * @brief Sets shape of array along each dimension to be the same size as each of its dimensions
    * according to the dataset. Returns boolean for whether shape has changed (true) or not (false).
@@ -150,31 +260,45 @@ class XarrayZarrArray {
    * @param scale_factor The scale factor of array data.
    * @param chunkshape The shape of the array chunks.
    * @param dimnames The names of each dimension of the array (in order outermost->innermost).
+   * @param shard_nchunks The number of chunks in each shard (0 means no sharding).
+   * @param commits Settings for commits of the array's shape.
    */
   XarrayZarrArray(Store& store, const std::unordered_map<std::string, size_t>& datasetdims,
                   const std::string_view name, const std::string_view units,
                   const double scale_factor, const std::vector<size_t>& chunkshape,
-                  const std::vector<std::string>& dimnames)
-      : zarr(store, name, chunkshape, true, reduced_arrayshape_from_dims(datasetdims, dimnames)),
+                  const std::vector<std::string>& dimnames, const size_t shard_nchunks = 0,
+                  const MetadataCommits& commits = MetadataCommits{})
+      : zarr(store, name, chunkshape, true, reduced_arrayshape_from_dims(datasetdims, dimnames),
+             shard_nchunks),
+        name(name),
         dimnames(dimnames),
         arrayshape(dimnames.size(), 0),
-        last_totnchunks(0) {
+        commitshape(dimnames.size(), 0),
+        last_totnchunks(0),
+        nshape_writes(0),
+        commits(commits) {
     if (chunkshape.size() != dimnames.size()) {
       throw std::runtime_error(
           "number of named dimensions of array must match number dimensions of chunks");
     }
+    if (commits.interval == 0) {
+      throw std::invalid_argument("interval between commits of array shape must be > 0");
+    }
     int my_rank;
     my_rank = init_communicator::get_comm_rank();
 
     if (my_rank == 0) {
-      write_arrayshape(datasetdims);
-      write_zattrs_json(store, name, xarray_metadata<T>(units, scale_factor, dimnames));
+      set_arrayshape(datasetdims);
+      const auto attrs = xarray_metadata<T>(units, scale_factor, dimnames);
+      write_array_attributes(store, zarr, name, attrs, dimnames);
+      record_attributes(attrs);
     }
   }
 
   /**
    * @brief Constructs a new XarrayZarrArray object with additional variable called
-   * "sample_dimension" in the metadata .zattrs json and initially no set arrayshape.
+   * "sample_dimension" in the metadata .zattrs json (or zarr.json if array is sharded) and
+   * initially no set arrayshape.
    *
    * @param store The store where the array will be stored.
    * @param datasetdims Dictionary like object for the dimensions of the dataset.
@@ -184,31 +308,53 @@ class XarrayZarrArray {
    * @param chunkshape The shape of the array chunks.
    * @param dimnames The names of each dimension of the array (in order outermost->innermost).
    * @param sampledimname The name of the dimension the ragged count samples.
+   * @param shard_nchunks The number of chunks in each shard (0 means no sharding).
+   * @param commits Settings for commits of the array's shape.
    */
   XarrayZarrArray(Store& store, const std::unordered_map<std::string, size_t>& datasetdims,
                   const std::string_view name, const std::string_view units,
                   const double scale_factor, const std::vector<size_t>& chunkshape,
-                  const std::vector<std::string>& dimnames, const std::string_view sampledimname)
-      : zarr(store, name, chunkshape, true, reduced_arrayshape_from_dims(datasetdims, dimnames)),
+                  const std::vector<std::string>& dimnames, const std::string_view sampledimname,
+                  const size_t shard_nchunks = 0,
+                  const MetadataCommits& commits = MetadataCommits{})
+      : zarr(store, name, chunkshape, true, reduced_arrayshape_from_dims(datasetdims, dimnames),
+             shard_nchunks),
+        name(name),
         dimnames(dimnames),
         arrayshape(dimnames.size(), 0),
-        last_totnchunks(0) {
+        commitshape(dimnames.size(), 0),
+        last_totnchunks(0),
+        nshape_writes(0),
+        commits(commits) {
     if (chunkshape.size() != dimnames.size()) {
       throw std::runtime_error(
           "number of named dimensions of array must match number dimensions of chunks");
     }
+    if (commits.interval == 0) {
+      throw std::invalid_argument("interval between commits of array shape must be > 0");
+    }
     int my_rank;
     my_rank = init_communicator::get_comm_rank();
     if (my_rank == 0) {
-      write_zattrs_json(store, name,
-                        xarray_metadata<T>(units, scale_factor, dimnames, sampledimname));
+      const auto attrs = xarray_metadata<T>(units, scale_factor, dimnames, sampledimname);
+      write_array_attributes(store, zarr, name, attrs, dimnames);
+      record_attributes(attrs);
     }
   }
 
+  /**
+   * @brief Destroys the XarrayZarrArray object.
+   *
+   * Final shape of the array is always committed (on rank 0), regardless of the interval
+   * between commits, before the Zarr array writes any remaining data in its buffer to the store.
+   */
   ~XarrayZarrArray() {
     int my_rank;
     my_rank = init_communicator::get_comm_rank();
-    if (my_rank == 0) zarr.write_arrayshape(arrayshape);
+    if (my_rank == 0) {
+      zarr.write_arrayshape(arrayshape);
+      commitshape = arrayshape;
+    }
   }
 
   /**
@@ -256,20 +402,21 @@ class XarrayZarrArray {
    *
    * The order of the dimensions in the array's shape is the order of dimensions in dimnames
    * (outermost -> innermost). Setting the shape to be conistent with the size of the dataset's
-   * dimensions makes zarr array also consistent with Xarray and NetCDF conventions. If chunks have
-   * been written since last writing of the arrayshape, and the shape of the array has changed, then
+   * dimensions makes zarr array also consistent with Xarray and NetCDF conventions. If a commit of
+   * the array's shape is due, the shape of the array has changed since the last commit, and
+   * chunks have been written since the last commit (or the array is in crash safe mode), then
    * function also overwrites the .zarray json file with metadata containing the new shape of the
-   * array.
+   * array. The new shape is always recorded for the consolidated metadata (regardless of
+   * commits) so that the consolidated metadata has the final shape of the array once the array
+   * has been written, even if it is written to the store before the array is destroyed.
    *
    * @param datasetdims Dictionary like object for the dimensions of the dataset.
    */
   void write_arrayshape(const std::unordered_map<std::string, size_t>& datasetdims) {
-    auto ischange = set_arrayshape(datasetdims);
-
-    if (last_totnchunks != zarr.get_totnchunks() && ischange) {
-      zarr.write_arrayshape(arrayshape);
-      last_totnchunks = zarr.get_totnchunks();
+    if (set_arrayshape(datasetdims)) {
+      record_metadata(arrayshape);
     }
+    commit_arrayshape_if_due();
   }
 
   /**
@@ -278,17 +425,18 @@ class XarrayZarrArray {
    *
    * Expected shape is 1-D array with size of the total number of elements written to a zarr array.
    *
-   * If chunks have been written since last writing of the arrayshape, then function also overwrites
-   * the .zarray json file with metadata containing the new shape of the array.
+   * If a commit of the array's shape is due, the shape has changed since the last commit, and
+   * chunks have been written since the last commit (or the array is in crash safe mode), then
+   * function also overwrites the .zarray json file with metadata containing the new shape of the
+   * array. The new shape is always recorded for the consolidated metadata (regardless of
+   * commits) as for write_arrayshape.
    *
    */
   void write_ragged_arrayshape() {
-    auto ischange = set_ragged_arrayshape();
-
-    if (last_totnchunks != zarr.get_totnchunks() && ischange) {
-      zarr.write_arrayshape(arrayshape);
-      last_totnchunks = zarr.get_totnchunks();
+    if (set_ragged_arrayshape()) {
+      record_metadata(arrayshape);
     }
+    commit_arrayshape_if_due();
   }
 };
 
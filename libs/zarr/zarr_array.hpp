@@ -14,7 +14,9 @@
  * -----
  * File Description:
  * Class to write data to an array in a Zarr storage specification version 2
- * (https://zarr.readthedocs.io/en/stable/spec/v2.html) in a given memory store.
+ * (https://zarr.readthedocs.io/en/stable/spec/v2.html) in a given memory store, or optionally
+ * version 3 (https://zarr-specs.readthedocs.io/en/latest/v3/core/v3.0.html) with chunks of the
+ * array packed into shards.
  */
 
 #ifndef LIBS_ZARR_ZARR_ARRAY_HPP_
@@ -51,6 +53,25 @@ inline std::vector<size_t> good2Dchunkshape(const size_t maxchunk, const size_t
   return {shape0, dim1size};
 }
 
+/**
+ * @brief Given maximum chunk size 'maxchunk' and length of the two inner dimensions of one chunk
+ * of array 'dim1size' and 'dim2size', function returns the largest possible chunk shape that has
+ * the length of its inner dimensions = dim1size and dim2size.
+ *
+ * If dim1size * dim2size > maxchunk the length of the outer dimension of the chunk is clamped to
+ * 1, i.e. the chunk shape is [1, dim1size, dim2size] and chunks are larger than maxchunk.
+ *
+ * @param maxchunk The maximum chunk size (maximum number of elements in chunk).
+ * @param dim1size The length of (number of elements along) the middle dimension of one chunk.
+ * @param dim2size The length of (number of elements along) the innermost dimension of one chunk.
+ * @return std::vector<size_t> The largest possible 3-D chunk shape.
+ */
+inline std::vector<size_t> good3Dchunkshape(const size_t maxchunk, const size_t dim1size,
+                                            const size_t dim2size) {
+  const auto shape0 = size_t{maxchunk / (dim1size * dim2size)};  // same as floor for +ve integers
+  return {std::max(shape0, size_t{1}), dim1size, dim2size};
+}
+
 /**
  * @brief Write metadata string to a store under a .zarray key.
  *
@@ -69,11 +90,31 @@ inline void write_zarray_json(Store& store, std::string_view name, std::string_v
   store[std::string(name) + "/.zarray"] = metadata;
 }
 
+/**
+ * @brief Write metadata string to a store under a zarr.json key.
+ *
+ * write metadata under zarr.json key in store for an array called 'name'. For example zarr.json
+ * could be a json file in a file system store (see FSStore) for the metadata which must exist in
+ * order to decode shards of an array according to Zarr storage specification version 3
+ * (https://zarr-specs.readthedocs.io/en/latest/v3/core/v3.0.html).
+ *
+ * @tparam Store The type of the store object where the metadata will be written.
+ * @param store The store object where the metadata will be written.
+ * @param name The name under which the zarr.json key will be stored in the store.
+ * @param metadata The metadata to write for the zarr.json key.
+ */
+template <typename Store>
+inline void write_zarr_json(Store& store, std::string_view name, std::string_view metadata) {
+  store[std::string(name) + "/zarr.json"] = metadata;
+}
+
 /**
  * @brief A template class representing a Zarr array.
  *
  * This class provides functionality to write an array to a specified store via a buffer according
- * to the Zarr storage specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html).
+ * to the Zarr storage specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html),
+ * or if the array is sharded, according to the Zarr storage specification version 3 with the
+ * chunks of the array packed into shards of "shard_nchunks" chunks along its outermost dimension.
  *
  * @tparam Store The type of store where the array will be stored.
  * @tparam T The data type stored in the arrays.
@@ -175,17 +216,19 @@ class ZarrArray {
    * @param chunkshape The shape of individual data chunks along each dimension.
    * @param is_backend boolean is true if zarr array is a backend of something else e.g. xarray.
    * @param reduced_arrayshape The shape of the array along all but the outermost (0th) dimension.
+   * @param shard_nchunks The number of chunks in each shard (0 means no sharding).
    */
   ZarrArray(Store& store, const std::string_view name, const std::vector<size_t>& chunkshape,
             const bool is_backend,
-            const std::vector<size_t>& reduced_arrayshape = std::vector<size_t>({}))
+            const std::vector<size_t>& reduced_arrayshape = std::vector<size_t>({}),
+            const size_t shard_nchunks = 0)
       : store(store),
         name(name),
         totnchunks(0),
         totndata(0),
-        chunks(chunkshape, reduced_arrayshape),
+        chunks(chunkshape, reduced_arrayshape, shard_nchunks),
         buffer(vec_product(chunks.get_chunkshape())),
-        zarr_metadata(chunkshape),
+        zarr_metadata(chunkshape, shard_nchunks),
         is_backend(is_backend) {
     if (chunkshape.size() != reduced_arrayshape.size() + 1) {
       throw std::runtime_error(
@@ -200,7 +243,8 @@ class ZarrArray {
    * @brief Destroys the ZarrArray object.
    *
    * Writes the buffer to a chunk of the array in the store if it isn't empty and issues a warning
-   * if the data in buffer mismatches the array's expected dimensions. If the array is not a
+   * if the data in buffer mismatches the array's expected dimensions. Then writes any incomplete
+   * shards of the array to the store (if the array is sharded). If the array is not a
    * backend (e.g. of an array in an xarray or NetCDF dataset), then the metadata for the
    * array's shape is also updated and warnings are issued if the array is incomplete.
    */
@@ -214,6 +258,7 @@ class ZarrArray {
       totndata = totnchunks * buffer.get_chunksize() + buffer.get_fill();
       totnchunks = chunks.write_chunk<Store, T>(store, name, totnchunks, buffer);
     }
+    chunks.flush_shards(store, name);
 
     if (!(is_backend)) {
       write_arrayshape(get_arrayshape());
@@ -255,8 +300,9 @@ class ZarrArray {
    * @brief Write the array shape to the store.
    *
    * This function writes the given array shape to the store as part of the metadata in the Zarr
-   * .zarray json file. Function also tests that the number of dimensions of the given arrayshape
-   * is consitent with number of dimensions provided by the shape of each chunk.
+   * .zarray json file (or zarr.json file if the array is sharded). Function also tests that the
+   * number of dimensions of the given arrayshape is consitent with number of dimensions provided
+   * by the shape of each chunk.
    *
    * @param arrayshape The array shape to be written.
    *
@@ -267,7 +313,54 @@ class ZarrArray {
     if (arrayshape.size() != chunks.get_chunkshape().size()) {
       throw std::runtime_error("number of dimensions of array must not change");
     }
-    write_zarray_json(store, name, zarr_metadata(arrayshape));
+    if (chunks.is_sharded()) {
+      write_zarr_json(store, name, zarr_metadata(arrayshape));
+    } else {
+      write_zarray_json(store, name, zarr_metadata(arrayshape));
+    }
+  }
+
+  /**
+   * @brief Returns the metadata of the array for a given array shape, i.e. the contents of the
+   * .zarray json file (or zarr.json file if the array is sharded) written by write_arrayshape.
+   *
+   * @param arrayshape The shape of the array.
+   * @return The metadata of the array as a JSON object.
+   */
+  std::string get_metadata(const std::vector<size_t>& arrayshape) const {
+    return zarr_metadata(arrayshape);
+  }
+
+  /**
+   * @brief Writes the data in the buffer (and any incomplete shards) to the store without
+   * resetting the buffer, so that all data written to the array so far is in the store.
+   *
+   * The chunk written from the buffer (or the shard containing it) is overwritten in the store
+   * once the buffer is full. Useful before writing metadata for a shape of the array which
+   * includes elements of data in the buffer, e.g. to keep the data in the store consistent with
+   * the array's metadata in case a run does not end cleanly.
+   */
+  void write_snapshot() { chunks.write_snapshot<Store, T>(store, name, totnchunks, buffer); }
+
+  /**
+   * @brief Returns true if chunks of the array are packed into shards (i.e. the array obeys the
+   * Zarr storage specification version 3).
+   */
+  bool is_sharded() const { return chunks.is_sharded(); }
+
+  /**
+   * @brief Sets the attributes and names of dimensions of a sharded array and rewrites its metadata
+   * (with the current shape of the array) to include them.
+   *
+   * For a sharded array this replaces the .zattrs json file of a Zarr storage specification version
+   * 2 array, since attributes are part of the zarr.json metadata in version 3.
+   *
+   * @param attrs The attributes of the array as a JSON object.
+   * @param dimnames The names of the dimensions of the array as a JSON list.
+   */
+  void set_attributes(const std::string_view attrs, const std::string_view dimnames) {
+    zarr_metadata.set_attributes(attrs, dimnames);
+    write_arrayshape(get_arrayshape());
   }
 
   /**
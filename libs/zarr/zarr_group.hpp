@@ -14,42 +14,114 @@
  * -----
  * File Description:
  * Structure to create a group obeying the Zarr storage specification version 2
- * (https://zarr.readthedocs.io/en/stable/spec/v2.html) in a given memory store.
+ * (https://zarr.readthedocs.io/en/stable/spec/v2.html) or version 3
+ * (https://zarr-specs.readthedocs.io/en/latest/v3/core/v3.0.html) in a given memory store.
  */
 
 #ifndef LIBS_ZARR_ZARR_GROUP_HPP_
 #define LIBS_ZARR_ZARR_GROUP_HPP_
 
 #include <Kokkos_Core.hpp>
+#include <memory>
 #include <string>
+#include <string_view>
+
+#include "zarr/consolidated_metadata.hpp"
 
 /**
  * @brief A class representing a Zarr group (i.e. collection of Zarr arrays) in a storage system.
  *
  * This class provides functionality to create a group of arrays obeying the Zarr storage
- * specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html) within a store
- * object that manages the storage and retrieval of data and metadata.
+ * specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html), or version 3
+ * (https://zarr-specs.readthedocs.io/en/latest/v3/core/v3.0.html) e.g. for a group of sharded
+ * arrays, within a store object that manages the storage and retrieval of data and metadata.
+ * The metadata of the group and of its arrays is collected so that it can also be written as
+ * consolidated metadata when the group is closed.
  *
  * @tparam Store The type of the store object used by the Zarr group.
  */
 template <typename Store>
 struct ZarrGroup {
  public:
-  Store& store; /**< Reference to the store object. */
+  Store& store;      /**< Reference to the store object. */
+  bool is_zarr_v3;   /**< true if group obeys Zarr storage specification version 3 */
+  std::string attrs; /**< attributes of the group as a JSON object */
+
+  /** metadata of the group and its arrays to write as consolidated metadata */
+  std::shared_ptr<ConsolidatedMetadata> consolidated;
 
   /**
    * @brief Constructs a ZarrGroup with the specified store object.
    *
    * This constructor initializes a ZarrGroup with the provided store object.
    * It also writes the compulsory metatdata for the group in order to obey the Zarr storage
-   * specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html).
+   * specification version 2 (https://zarr.readthedocs.io/en/stable/spec/v2.html) or version 3.
    *
    * @param store The store object associated with the Zarr group.
+   * @param is_zarr_v3 true if group should obey Zarr storage specification version 3.
+   */
+  explicit ZarrGroup(Store& store, const bool is_zarr_v3 = false)
+      : store(store),
+        is_zarr_v3(is_zarr_v3),
+        attrs("{}"),
+        consolidated(std::make_shared<ConsolidatedMetadata>()) {
+    if (is_zarr_v3) {
+      write_attributes(attrs);
+    } else {
+      const std::string zarr_format("2");  // storage specification version 2
+      const std::string zgroupjson("{\n  \"zarr_format\": " + zarr_format + "\n}");
+      store[".zgroup"] = zgroupjson;
+      consolidated->set(".zgroup", zgroupjson);
+    }
+  }
+
+  /**
+   * @brief Writes attributes of the group to the store.
+   *
+   * Attributes are written under the .zattrs key for version 2, or as part of the group's
+   * zarr.json metadata for version 3.
+   *
+   * @param group_attrs The attributes of the group as a JSON object.
+   */
+  void write_attributes(const std::string_view group_attrs) {
+    attrs = group_attrs;
+    if (is_zarr_v3) {
+      store["zarr.json"] =
+          "{\n"
+          "  \"zarr_format\": 3,\n"
+          "  \"node_type\": \"group\",\n"
+          "  \"attributes\": " +
+          attrs + "\n}";
+    } else {
+      store[".zattrs"] = attrs;
+      consolidated->set(".zattrs", attrs);
+    }
+  }
+
+  /**
+   * @brief Writes the metadata of the group and of its arrays collected so far as consolidated
+   * metadata.
+   *
+   * For version 2 the consolidated metadata is written under the .zmetadata key, and for version 3
+   * it is written as the (inline) "consolidated_metadata" of the group's zarr.json. Either way a
+   * dataset can then be opened by reading a single key, e.g. with xarray's
+   * `open_zarr(consolidated=True)`. Consolidated metadata is only correct if it is written after
+   * the arrays of the group have written their final metadata, i.e. once they are destroyed.
    */
-  explicit ZarrGroup(Store& store) : store(store) {
-    const std::string zarr_format("2");  // storage specification version 2
-    const std::string zgroupjson("{\n  \"zarr_format\": " + zarr_format + "\n}");
-    store[".zgroup"] = zgroupjson;
+  void write_consolidated_metadata() const {
+    if (is_zarr_v3) {
+      store["zarr.json"] =
+          "{\n"
+          "  \"zarr_format\": 3,\n"
+          "  \"node_type\": \"group\",\n"
+          "  \"attributes\": " +
+          attrs +
+          ",\n"
+          "  \"consolidated_metadata\": " +
+          consolidated->zarr_v3_inline() + "\n}";
+    } else {
+      store[".zmetadata"] = consolidated->zmetadata();
+    }
   }
 };
 
@@ -79,3 +79,53 @@ std::string make_part_zarrmetadata(const std::vector<size_t>& chunkshape,
                                              zarr_format);
   return part_zarrmetadata;
 }
+
+/**
+ * @brief Generates part of the metadata for a sharded Zarr array zarr.json file.
+ *
+ * This function constructs a string containing all the compulsory metadata of a Zarr array for its
+ * zarr.json file according to the Zarr storage specification version 3 (excluding the array's
+ * zarr_format, node_type, shape, attributes and dimension names). The chunk grid of the array is
+ * made of shards which are "shard_nchunks" chunks long along the outermost dimension of the array,
+ * each encoded by the "sharding_indexed" codec.
+ *
+ * @param chunkshape The shape of individual data chunks (inner chunks of shards) along each
+ * dimension.
+ * @param data_type The data type stored in the arrays (e.g., "float64").
+ * @param fill_value The fill value for empty datapoints in the array (e.g. "\"NaN\"").
+ * @param shard_nchunks The number of chunks in each shard along the outermost dimension.
+ * @return A string view containing the partial metadata for the Zarr array.
+ */
+std::string make_part_zarrmetadata_v3(const std::vector<size_t>& chunkshape,
+                                      const std::string_view data_type,
+                                      const std::string_view fill_value,
+                                      const size_t shard_nchunks) {
+  auto shardshape = chunkshape;  // shape of each shard of array
+  shardshape.at(0) *= shard_nchunks;
+  const auto bytes_codec = std::string{
+      "{\"name\": \"bytes\", \"configuration\": {\"endian\": \"little\"}}"};  // no compression
+
+  const auto part_zarrmetadata = std::string(
+      "  \"data_type\": \"" + std::string(data_type) +
+      "\",\n"
+      "  \"chunk_grid\": {\"name\": \"regular\", \"configuration\": {\"chunk_shape\": " +
+      vec_to_string(shardshape) +
+      "}},\n"
+      "  \"chunk_key_encoding\": {\"name\": \"default\", \"configuration\": "
+      "{\"separator\": \".\"}},\n"
+      "  \"fill_value\": " +
+      std::string(fill_value) +
+      ",\n"
+      "  \"codecs\": [{\"name\": \"sharding_indexed\", \"configuration\": {\n"
+      "    \"chunk_shape\": " +
+      vec_to_string(chunkshape) +
+      ",\n"
+      "    \"codecs\": [" +
+      bytes_codec +
+      "],\n"
+      "    \"index_codecs\": [" +
+      bytes_codec +
+      "],\n"
+      "    \"index_location\": \"end\"}}]");
+  return part_zarrmetadata;
+}
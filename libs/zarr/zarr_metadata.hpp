@@ -50,10 +50,33 @@ std::string vec_to_string(const std::vector<size_t>& vals);
 std::string make_part_zarrmetadata(const std::vector<size_t>& chunkshape,
                                    const std::string_view dtype);
 
+/**
+ * @brief Generates part of the metadata for a sharded Zarr array zarr.json file.
+ *
+ * This function constructs a string containing all the compulsory metadata of a Zarr array for its
+ * zarr.json file according to the Zarr storage specification version 3 (excluding the array's
+ * zarr_format, node_type, shape, attributes and dimension names). The chunk grid of the array is
+ * made of shards which are "shard_nchunks" chunks long along the outermost dimension of the array,
+ * each encoded by the "sharding_indexed" codec.
+ *
+ * @param chunkshape The shape of individual data chunks (inner chunks of shards) along each
+ * dimension.
+ * @param data_type The data type stored in the arrays (e.g., "float64").
+ * @param fill_value The fill value for empty datapoints in the array (e.g. "\"NaN\"").
+ * @param shard_nchunks The number of chunks in each shard along the outermost dimension.
+ * @return A string view containing the partial metadata for the Zarr array.
+ */
+std::string make_part_zarrmetadata_v3(const std::vector<size_t>& chunkshape,
+                                      const std::string_view data_type,
+                                      const std::string_view fill_value,
+                                      const size_t shard_nchunks);
+
 /**
  * @brief Class for generating metadata required for a Zarr array.
  *
- * This class generates compulsory metadata for the Zarr array .zarray JSON file.
+ * This class generates compulsory metadata for the Zarr array .zarray JSON file, or if the array
+ * is sharded, for the Zarr array zarr.json file according to the Zarr storage specification
+ * version 3 (https://zarr-specs.readthedocs.io/en/latest/v3/core/v3.0.html).
  * The metadata includes information such as chunk shape, data type, etc.
  *
  * @tparam T The data type of the array's elements.
@@ -62,28 +85,71 @@ template <typename T>
 class ZarrMetadata {
  private:
   std::string part_zarrmetadata; /**< Metadata required for zarr array excluding array's shape */
+  bool is_sharded;               /**< true if metadata is for a sharded (version 3) array */
+  std::string attributes;        /**< Attributes of (version 3) array */
+  std::string dimension_names;   /**< Names of dimensions of (version 3) array */
 
  public:
   /**
    * @brief Constructs a ZarrMetadata object.
    *
-   * Constructs a ZarrMetadata object with the given chunk shape and data type.
+   * Constructs a ZarrMetadata object with the given chunk shape and data type. If shard_nchunks is
+   * greater than 0, the metadata is for an array whose chunks are packed into shards of
+   * shard_nchunks chunks along the outermost dimension of the array.
    *
    * @param chunkshape The shape of the chunks used to store array data.
    * @param dtype The data type of the array's elements in Zarr format (e.g., "<f8" for double).
+   * @param data_type The data type of the array's elements in Zarr version 3 format (e.g.,
+   * "float64" for double).
+   * @param fill_value The fill value of the array in Zarr version 3 format.
+   * @param shard_nchunks The number of chunks in each shard (0 means no sharding).
    */
-  ZarrMetadata(const std::vector<size_t>& chunkshape, const std::string_view dtype)
-      : part_zarrmetadata(make_part_zarrmetadata(chunkshape, dtype)) {}
+  ZarrMetadata(const std::vector<size_t>& chunkshape, const std::string_view dtype,
+               const std::string_view data_type, const std::string_view fill_value,
+               const size_t shard_nchunks)
+      : part_zarrmetadata(
+            shard_nchunks > 0
+                ? make_part_zarrmetadata_v3(chunkshape, data_type, fill_value, shard_nchunks)
+                : make_part_zarrmetadata(chunkshape, dtype)),
+        is_sharded(shard_nchunks > 0),
+        attributes("{}"),
+        dimension_names("") {}
+
+  /**
+   * @brief Sets the attributes and dimension names included in the metadata of a sharded array.
+   *
+   * @param attrs The attributes of the array as a JSON object.
+   * @param dimnames The names of the dimensions of the array as a JSON list.
+   */
+  void set_attributes(const std::string_view attrs, const std::string_view dimnames) {
+    attributes = std::string(attrs);
+    dimension_names = std::string(dimnames);
+  }
 
   /**
    * @brief Generates metadata for the Zarr array.
    *
-   * Generates compulsory metadata for the Zarr array .zarray JSON file.
+   * Generates compulsory metadata for the Zarr array .zarray JSON file (or zarr.json file if the
+   * array is sharded).
    *
    * @param arrayshape The shape of the Zarr array.
    * @return A string containing the metadata for the Zarr array.
    */
   std::string operator()(const std::vector<size_t>& arrayshape) const {
+    if (is_sharded) {
+      auto metadata = std::string(
+          "{\n"
+          "  \"zarr_format\": 3,\n"
+          "  \"node_type\": \"array\",\n"
+          "  \"shape\": " +
+          vec_to_string(arrayshape) + ",\n" + part_zarrmetadata + ",\n  \"attributes\": " +
+          attributes);
+      if (!dimension_names.empty()) {
+        metadata += ",\n  \"dimension_names\": " + dimension_names;
+      }
+      return metadata + "\n}";
+    }
+
     const auto metadata = std::string(
         "{\n"
         "  \"shape\": " +
@@ -96,37 +162,45 @@ class ZarrMetadata {
 template <>
 class ZarrMetadata<uint64_t> : public ZarrMetadata<void> {
   constexpr static char dtype[] = "<u8";
+  constexpr static char data_type[] = "uint64";
+  constexpr static char fill_value[] = "0";
 
  public:
-  explicit ZarrMetadata(const std::vector<size_t>& chunkshape)
-      : ZarrMetadata<void>(chunkshape, dtype) {}
+  explicit ZarrMetadata(const std::vector<size_t>& chunkshape, const size_t shard_nchunks = 0)
+      : ZarrMetadata<void>(chunkshape, dtype, data_type, fill_value, shard_nchunks) {}
 };
 
 template <>
 class ZarrMetadata<uint32_t> : public ZarrMetadata<void> {
   constexpr static char dtype[] = "<u4";
+  constexpr static char data_type[] = "uint32";
+  constexpr static char fill_value[] = "0";
 
  public:
-  explicit ZarrMetadata(const std::vector<size_t>& chunkshape)
-      : ZarrMetadata<void>(chunkshape, dtype) {}
+  explicit ZarrMetadata(const std::vector<size_t>& chunkshape, const size_t shard_nchunks = 0)
+      : ZarrMetadata<void>(chunkshape, dtype, data_type, fill_value, shard_nchunks) {}
 };
 
 template <>
 class ZarrMetadata<double> : public ZarrMetadata<void> {
   constexpr static char dtype[] = "<f8";
+  constexpr static char data_type[] = "float64";
+  constexpr static char fill_value[] = "\"NaN\"";
 
  public:
-  explicit ZarrMetadata(const std::vector<size_t>& chunkshape)
-      : ZarrMetadata<void>(chunkshape, dtype) {}
+  explicit ZarrMetadata(const std::vector<size_t>& chunkshape, const size_t shard_nchunks = 0)
+      : ZarrMetadata<void>(chunkshape, dtype, data_type, fill_value, shard_nchunks) {}
 };
 
 template <>
 class ZarrMetadata<float> : public ZarrMetadata<void> {
   constexpr static char dtype[] = "<f4";
+  constexpr static char data_type[] = "float32";
+  constexpr static char fill_value[] = "\"NaN\"";
 
  public:
-  explicit ZarrMetadata(const std::vector<size_t>& chunkshape)
-      : ZarrMetadata<void>(chunkshape, dtype) {}
+  explicit ZarrMetadata(const std::vector<size_t>& chunkshape, const size_t shard_nchunks = 0)
+      : ZarrMetadata<void>(chunkshape, dtype, data_type, fill_value, shard_nchunks) {}
 };
 
 #endif  // LIBS_ZARR_ZARR_METADATA_HPP_
@@ -51,6 +51,7 @@
 #include "observers/sdmmonitor/monitor_condensation_observer.hpp"
 #include "observers/sdmmonitor/monitor_massmoments_change_observer.hpp"
 #include "observers/sdmmonitor/monitor_precipitation_observer.hpp"
+#include "observers/sdmmonitor/monitor_solvercost_observer.hpp"
 #include "observers/state_observer.hpp"
 #include "observers/streamout_observer.hpp"
 #include "observers/superdrops_observer.hpp"
@@ -239,8 +240,10 @@ inline Observer auto create_sdmmonitor_observer(const unsigned int interval, Dat
       MonitorRainMassMomentsObserver(interval, dataset, store, maxchunk, ngbxs);
   const Observer auto obs_precip =
       MonitorPrecipitationObserver(interval, dataset, store, maxchunk, ngbxs);
+  const Observer auto obs_solvercost =
+      MonitorSolverCostObserver(interval, dataset, store, maxchunk, ngbxs);
 
-  return obs_cond >> obs_massmoms >> obs_rainmassmoms >> obs_precip;
+  return obs_cond >> obs_massmoms >> obs_rainmassmoms >> obs_precip >> obs_solvercost;
 }
 
 template <typename Dataset, typename Store>
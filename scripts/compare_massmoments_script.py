@@ -0,0 +1,127 @@
+"""
+Copyright (c) 2026 MPI-M, Clara Bayley
+
+
+----- CLEO -----
+File: compare_massmoments_script.py
+Project: scripts
+Created Date: Sunday 18th October 2026
+Author: Clara Bayley (CB)
+Additional Contributors:
+-----
+License: BSD 3-Clause "New" or "Revised" License
+https://opensource.org/licenses/BSD-3-Clause
+-----
+File Description:
+validation script to compare the mass moments (and number of superdroplets) output by two
+CLEO runs, e.g. a run with the default (double precision) build against the same run with a
+build where superdroplet msol is stored in single precision
+(i.e. cmake [...] -DCLEO_SUPERDROPS_SINGLE_PRECISION=ON). Optionally (--coords) also
+compares the coordinates of each superdroplet (matched by sdId at every output time).
+Exits with non-zero status if the maximum relative difference of any mass moment (or
+coordinate) exceeds the given tolerance.
+"""
+
+import argparse
+import sys
+import numpy as np
+import xarray as xr
+from pathlib import Path
+
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "reference_dataset",
+    type=Path,
+    help="Absolute path to reference (double precision) zarr dataset",
+)
+parser.add_argument(
+    "test_dataset", type=Path, help="Absolute path to zarr dataset to validate"
+)
+parser.add_argument(
+    "--rtol",
+    type=float,
+    default=1e-4,
+    help="Maximum allowed relative difference of mass moments (default 1e-4)",
+)
+parser.add_argument(
+    "--lab",
+    type=str,
+    default="",
+    help="label of mass moments e.g. '_raindrops' (default no label)",
+)
+parser.add_argument(
+    "--coords",
+    action="store_true",
+    help="also compare coordinates of superdroplets (requires superdroplet output)",
+)
+args = parser.parse_args()
+
+
+def max_relative_difference(ref, test):
+    """returns maximum of |test - ref| / |ref| ignoring elements where ref is zero
+    and nan if the arrays have different shapes"""
+    ref = np.asarray(ref, dtype=np.float64)
+    test = np.asarray(test, dtype=np.float64)
+    if ref.shape != test.shape:
+        return np.nan
+    diff = np.abs(test - ref)
+    nonzero = ref != 0.0
+    if not np.any(nonzero):
+        return np.amax(diff, initial=0.0)
+    return np.amax(diff[nonzero] / np.abs(ref[nonzero]))
+
+
+def max_relative_coord_difference(ref, test, coord):
+    """returns maximum of |test - ref| of coordinate of superdroplets with the same sdId
+    at each output time relative to the maximum |ref| of the coordinate, and nan if the
+    superdroplets at any time are different"""
+    ref_offsets = np.cumsum(ref["raggedcount"].values)
+    test_offsets = np.cumsum(test["raggedcount"].values)
+    if ref_offsets.shape != test_offsets.shape:
+        return np.nan
+    ref_sdId = np.split(ref["sdId"].values, ref_offsets[:-1])
+    test_sdId = np.split(test["sdId"].values, test_offsets[:-1])
+    ref_coord = np.split(ref[coord].values.astype(np.float64), ref_offsets[:-1])
+    test_coord = np.split(test[coord].values.astype(np.float64), test_offsets[:-1])
+
+    maxdiff, maxref = 0.0, 0.0
+    for r_id, t_id, r_c, t_c in zip(ref_sdId, test_sdId, ref_coord, test_coord):
+        r_order, t_order = np.argsort(r_id), np.argsort(t_id)
+        if not np.array_equal(r_id[r_order], t_id[t_order]):
+            return np.nan
+        diff = np.abs(t_c[t_order] - r_c[r_order])
+        maxdiff = max(maxdiff, np.amax(diff, initial=0.0))
+        maxref = max(maxref, np.amax(np.abs(r_c), initial=0.0))
+    return maxdiff / maxref if maxref != 0.0 else maxdiff
+
+
+def print_comparison(key, reldiff):
+    """prints comparison of key and returns True if it is within tolerance"""
+    is_ok = np.isfinite(reldiff) and reldiff <= args.rtol
+    status = "OK" if is_ok else "FAIL"
+    print(f"{key}: max relative difference = {reldiff:.3e} [{status}]")
+    return is_ok
+
+
+ref = xr.open_dataset(args.reference_dataset, engine="zarr", consolidated=False)
+test = xr.open_dataset(args.test_dataset, engine="zarr", consolidated=False)
+
+keys = ["massmom0" + args.lab, "massmom1" + args.lab, "massmom2" + args.lab]
+if "nsupers" in ref and "nsupers" in test:
+    keys.append("nsupers")
+
+is_valid = True
+print("----- mass moments comparison -----")
+print("reference: ", args.reference_dataset)
+print("test: ", args.test_dataset)
+for key in keys:
+    reldiff = max_relative_difference(ref[key].values, test[key].values)
+    is_valid = print_comparison(key, reldiff) and is_valid
+if args.coords:
+    for coord in ["coord3", "coord1", "coord2"]:
+        if coord in ref and coord in test:
+            reldiff = max_relative_coord_difference(ref, test, coord)
+            is_valid = print_comparison(coord, reldiff) and is_valid
+print("-----------------------------------")
+
+sys.exit(0 if is_valid else 1)
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+### ------------------ Input Parameters ---------------- ###
+### ------ You MUST edit these lines to set your ------- ###
+### ---- build type, directories, the executable(s) ---- ###
+### -------- to compile, and your python script -------- ###
+### ---------------------------------------------------- ###
+do_build="true"
+buildtype="openmp"
+compilername="gcc"
+path2CLEO=${CLEO_PATH2CLEO}
+path2build=${path2CLEO}/build_scaling_benchmark/
+build_flags="-DCLEO_DOMAIN=cartesian \
+  -DCLEO_NO_ROUGHPAPER=true -DCLEO_NO_PYBINDINGS=true"
+executables="scaling_benchmark"
+
+pythonscript=${path2CLEO}/examples/scaling_benchmark/scaling_benchmark.py
+src_config_filename=${path2CLEO}/examples/scaling_benchmark/src/config/scaling_benchmark_config.yaml
+script_args="${src_config_filename} \
+  --scaling=strong --nranks 1 2 4 --nthreads 1 2 4 8"
+### ---------------------------------------------------- ###
+### ---------------------------------------------------- ###
+### ---------------------------------------------------- ###
+
+### ---------- build, compile and run example ---------- ###
+${path2CLEO}/scripts/vanilla/examples/build_compile_run_plot.sh ${do_build} \
+  ${buildtype} ${compilername} ${path2CLEO} ${path2build} "${build_flags}" \
+  "${executables}" ${pythonscript} "${script_args}"
+### ---------------------------------------------------- ###
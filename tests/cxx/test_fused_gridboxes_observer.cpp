@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: test_fused_gridboxes_observer.cpp
+ * Project: cxx
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * test that the zarr output of a FusedGridboxesObserver (of the number of superdroplets, wind
+ * velocities, thermodynamics and mass moments of gridboxes) is identical to the output of the
+ * separate observers of each variable. Both write to an in-memory store and every key-value pair
+ * of the two stores is compared. Exits with non-zero status if a check fails.
+ */
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gridboxes/gbxindex.hpp"
+#include "gridboxes/gridbox.hpp"
+#include "initialise/timesteps.hpp"
+#include "kokkosaliases.hpp"
+#include "observers/collect_data_for_simple_dataset.hpp"
+#include "observers/fused_gridboxes_observer.hpp"
+#include "observers/gbxindex_observer.hpp"
+#include "observers/massmoments_observer.hpp"
+#include "observers/nsupers_observer.hpp"
+#include "observers/observers.hpp"
+#include "observers/thermo_observer.hpp"
+#include "observers/time_observer.hpp"
+#include "observers/windvel_observer.hpp"
+#include "superdrops/state.hpp"
+#include "superdrops/superdrop.hpp"
+#include "zarr/memory_store.hpp"
+#include "zarr/simple_dataset.hpp"
+
+/* throws error with message if check is false */
+void check(const bool is_true, const std::string& message) {
+  if (!is_true) {
+    throw std::runtime_error("FAILED: " + message);
+  }
+}
+
+/* returns superdroplets in device memory with (nsupers_per_gbx * ii) superdroplets in gridbox ii
+sorted by their gridbox index. Superdroplets' radii are chosen so that some are raindrops */
+viewd_supers create_supers(const size_t ngbxs, const size_t nsupers_per_gbx) {
+  auto nsupers = size_t{0};
+  for (size_t ii(0); ii < ngbxs; ++ii) {
+    nsupers += nsupers_per_gbx * ii;
+  }
+
+  auto d_supers = viewd_supers("supers", nsupers);
+  auto h_supers = Kokkos::create_mirror_view(d_supers);
+  auto kk = size_t{0};
+  for (size_t ii(0); ii < ngbxs; ++ii) {
+    for (size_t nn(0); nn < nsupers_per_gbx * ii; ++nn) {
+      const auto radius = 1.0 + 0.37 * static_cast<double>(kk);
+      const auto attrs = SuperdropAttrs(SoluteProperties{}, 10 + kk, radius, 0.001);
+      h_supers(kk) = Superdrop(ii, 0.0, 0.0, 0.0, attrs, Superdrop::IDType{kk});
+      ++kk;
+    }
+  }
+  Kokkos::deep_copy(d_supers, h_supers);
+  return d_supers;
+}
+
+/* returns gridboxes in device memory with references to their superdroplets (see create_supers)
+and states which differ for each gridbox and observation 'obs' */
+viewd_gbx create_gbxs(const size_t ngbxs, const size_t nsupers_per_gbx, const size_t obs) {
+  auto d_gbxs = viewd_gbx("gbxs", ngbxs);
+  auto h_gbxs = Kokkos::create_mirror_view(d_gbxs);
+  auto first = size_t{0};
+  for (size_t ii(0); ii < ngbxs; ++ii) {
+    const auto x = static_cast<double>(ii + ngbxs * obs);
+    const auto state = State(1.0, 1.0 + 0.1 * x, 1.5 + 0.01 * x, 0.001 * x, 0.0002 * x,
+                             {0.1 * x, 0.2 * x}, {-0.3 * x, 0.4 * x}, {0.5 * x, -0.6 * x});
+    const auto refs = kkpair_size_t{first, first + nsupers_per_gbx * ii};
+    h_gbxs(ii) = Gridbox(Gbxindex{static_cast<unsigned int>(ii)}, state, refs);
+    first = refs.second;
+  }
+  Kokkos::deep_copy(d_gbxs, h_gbxs);
+  return d_gbxs;
+}
+
+/* runs observer for nobs observations of the gridboxes and superdroplets */
+void run_observer(Observer auto& obs, const size_t ngbxs, const size_t nsupers_per_gbx,
+                  const size_t nobs, const unsigned int interval) {
+  const auto d_supers = create_supers(ngbxs, nsupers_per_gbx);
+  const subviewd_constsupers d_constsupers =
+      Kokkos::subview(d_supers, kkpair_size_t{0, d_supers.extent(0)});
+
+  obs.before_timestepping(create_gbxs(ngbxs, nsupers_per_gbx, 0), d_constsupers);
+  for (size_t n(0); n < nobs; ++n) {
+    const auto t_mdl = static_cast<unsigned int>(n) * interval;
+    check(obs.on_step(t_mdl), "observer observes on step " + std::to_string(t_mdl));
+    obs.at_start_step(t_mdl, create_gbxs(ngbxs, nsupers_per_gbx, n), d_constsupers);
+  }
+  obs.after_timestepping();
+}
+
+/* writes data of gridboxes to store with a fused gridboxes observer */
+void write_fused(MemoryStore& store, const size_t ngbxs, const size_t nsupers_per_gbx,
+                 const size_t nobs, const size_t maxchunk, const unsigned int interval) {
+  auto dataset = SimpleDataset(store);
+  {
+    const Observer auto obs0 = TimeObserver(interval, dataset, store, maxchunk, &step2dimlesstime);
+    const Observer auto obs1 = GbxindexObserver(dataset, store, maxchunk, ngbxs);
+
+    const auto nsupers = CollectNsupers(dataset, maxchunk, ngbxs);
+    const auto windvel = CollectWindVel(dataset, maxchunk, ngbxs);
+    const auto thermo = CollectThermo(dataset, maxchunk, ngbxs);
+    const auto massmoms = CollectDropletMassMoments(dataset, store, maxchunk, ngbxs);
+    const auto rainmassmoms = CollectRaindropMassMoments(dataset, store, maxchunk, ngbxs);
+    const Observer auto obs2 = FusedGridboxesObserver(
+        interval, dataset, nsupers >> windvel >> thermo >> massmoms >> rainmassmoms);
+
+    auto obs = obs0 >> obs1 >> obs2;
+    run_observer(obs, ngbxs, nsupers_per_gbx, nobs, interval);
+  }
+}
+
+/* writes data of gridboxes to store with the separate observers for each variable */
+void write_separate(MemoryStore& store, const size_t ngbxs, const size_t nsupers_per_gbx,
+                    const size_t nobs, const size_t maxchunk, const unsigned int interval) {
+  auto dataset = SimpleDataset(store);
+  {
+    const Observer auto obs0 = TimeObserver(interval, dataset, store, maxchunk, &step2dimlesstime);
+    const Observer auto obs1 = GbxindexObserver(dataset, store, maxchunk, ngbxs);
+    const Observer auto obs2 = NsupersObserver(interval, dataset, maxchunk, ngbxs);
+    const Observer auto obs3 = WindVelObserver(interval, dataset, maxchunk, ngbxs);
+    const Observer auto obs4 = ThermoObserver(interval, dataset, maxchunk, ngbxs);
+    const Observer auto obs5 = MassMomentsObserver(interval, dataset, store, maxchunk, ngbxs);
+    const Observer auto obs6 =
+        MassMomentsRaindropsObserver(interval, dataset, store, maxchunk, ngbxs);
+
+    auto obs = obs0 >> obs1 >> obs2 >> obs3 >> obs4 >> obs5 >> obs6;
+    run_observer(obs, ngbxs, nsupers_per_gbx, nobs, interval);
+  }
+}
+
+/* checks every key of both stores exists in the other store with identical values */
+void compare_stores(const MemoryStore& fused, const MemoryStore& separate) {
+  const auto keys = fused.keys();
+  check(keys == separate.keys(), "fused and separate stores have the same keys");
+  check(std::find(keys.begin(), keys.end(), "massmom0/.zarray") != keys.end(),
+        "stores contain mass moments");
+
+  for (const auto& key : keys) {
+    const auto a = fused.get(key);
+    const auto b = separate.get(key);
+    check(std::equal(a.begin(), a.end(), b.begin(), b.end()), "identical value of key " + key);
+  }
+  std::cout << "compared " << keys.size() << " keys\n";
+}
+
+int main(int argc, char* argv[]) {
+  Kokkos::initialize(argc, argv);
+  auto status = 0;
+  {
+    const auto ngbxs = size_t{13};
+    const auto nsupers_per_gbx = size_t{4};
+    const auto nobs = size_t{7};
+    const auto maxchunk = size_t{20};  // smaller than ngbxs * nobs so arrays have many chunks
+    const auto interval = (unsigned int){10};
+
+    try {
+      auto fused = MemoryStore();
+      auto separate = MemoryStore();
+      write_fused(fused, ngbxs, nsupers_per_gbx, nobs, maxchunk, interval);
+      write_separate(separate, ngbxs, nsupers_per_gbx, nobs, maxchunk, interval);
+      compare_stores(fused, separate);
+      std::cout << "test_fused_gridboxes_observer: PASSED\n";
+    } catch (const std::exception& e) {
+      std::cout << "test_fused_gridboxes_observer: " << e.what() << "\n";
+      status = 1;
+    }
+  }
+  Kokkos::finalize();
+
+  return status;
+}
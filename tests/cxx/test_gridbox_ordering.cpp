@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: test_gridbox_ordering.cpp
+ * Project: cxx
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * test that local and global gridbox indexes of a CartesianDecomposition round-trip and that the
+ * spatial index finds the local index of the gridbox bounding a coordinate when the gridboxes of
+ * each partition are in lexicographic or Morton order, including for partitions whose sizes are
+ * not powers of two. Every partition of the decomposition is checked, so the test can also be run
+ * with several MPI processes (e.g. mpiexec -n 3 ./test_gridbox_ordering). Exits with non-zero
+ * status if a check fails.
+ */
+
+#include <mpi.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Pair.hpp>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cartesiandomain/cartesian_decomposition.hpp"
+#include "cleoconstants.hpp"
+#include "configuration/communicator.hpp"
+#include "configuration/config.hpp"
+#include "initialise/gbx_bounds_from_binary.hpp"
+
+/* throws error with message if check is false */
+void check(const bool is_true, const std::string& message) {
+  if (!is_true) {
+    throw std::runtime_error("FAILED: " + message);
+  }
+}
+
+/* writes minimal configuration file (needed to initialise the communicator) and returns its path */
+std::filesystem::path write_config() {
+  const auto dir = std::filesystem::temp_directory_path();
+  const auto config_filename = dir / "test_gridbox_ordering_config.yaml";
+  std::ofstream file(config_filename);
+  file << "inputfiles:\n"
+       << "  constants_filename: " << config_filename.string() << "\n"
+       << "  grid_filename: " << (dir / "test_gridbox_ordering_grid.dat").string() << "\n"
+       << "outputdata:\n"
+       << "  setup_filename: " << (dir / "test_gridbox_ordering_setup.txt").string() << "\n"
+       << "  zarrbasedir: " << (dir / "test_gridbox_ordering.zarr").string() << "\n"
+       << "  maxchunk: 1\n"
+       << "domain:\n  nspacedims: 3\n  ngbxs: 1\n  maxnsupers: 1\n"
+       << "timesteps:\n  CONDTSTEP: 1\n  COLLTSTEP: 1\n  MOTIONTSTEP: 1\n  COUPLTSTEP: 1\n"
+       << "  OBSTSTEP: 1\n  T_END: 1\n";
+  return config_filename;
+}
+
+/* returns midpoint of {lower, upper} bounds */
+double centre(const Kokkos::pair<double, double> bounds) {
+  return (bounds.first + bounds.second) / 2.0;
+}
+
+/* checks every gridbox of every partition for the given domain and ordering */
+void test_ordering(const std::vector<size_t>& ndims, const std::string& ordering) {
+  const auto name = ordering + " [" + std::to_string(ndims.at(0)) + ", " +
+                    std::to_string(ndims.at(1)) + ", " + std::to_string(ndims.at(2)) + "] ";
+  const auto gfb = GbxBoundsFromBinary(ndims, {1.0, 2.0, 3.0}, 3);
+  auto decomposition = CartesianDecomposition();
+  decomposition.create(ndims, gfb, ordering);
+
+  const auto my_rank = init_communicator::get_comm_rank();
+  const auto nprocs = init_communicator::get_comm_size();
+  const auto nglobal = decomposition.get_total_global_gridboxes();
+  const auto& spatial_index = decomposition.get_spatial_index();
+
+  /* local to global to local for gridboxes of this process */
+  const auto nlocal = decomposition.get_total_local_gridboxes();
+  auto is_lexicographic = true;
+  for (size_t ii(0); ii < nlocal; ++ii) {
+    const auto idx = decomposition.local_to_global_gridbox_index(ii);
+    check(idx >= 0 && static_cast<size_t>(idx) < nglobal, name + "global index in domain");
+    check(decomposition.global_to_local_gridbox_index(idx) == static_cast<int>(ii),
+          name + "local index round-trip");
+    is_lexicographic &= (ii == 0 || idx > decomposition.local_to_global_gridbox_index(ii - 1));
+  }
+  if (ordering == "morton" && ndims.at(0) > 1 && ndims.at(1) > 1 && nprocs == 1) {
+    check(!is_lexicographic, name + "local indexes are not in lexicographic order");
+  }
+
+  /* every global gridbox is at exactly one local index of the process which owns it */
+  auto nowned = std::vector<size_t>(nprocs, 0);
+  for (size_t idx(0); idx < nglobal; ++idx) {
+    ++nowned.at(decomposition.get_gridbox_owner_process(idx));
+  }
+  check(nowned.at(my_rank) == nlocal, name + "number of local gridboxes");
+  auto nowners = std::vector<size_t>(nglobal, 0);
+  for (int proc(0); proc < nprocs; ++proc) {
+    for (size_t ii(0); ii < nowned.at(proc); ++ii) {
+      const auto idx = decomposition.local_to_global_gridbox_index(ii, proc);
+      check(decomposition.get_gridbox_owner_process(idx) == proc, name + "owner of gridbox");
+      ++nowners.at(idx);
+    }
+  }
+
+  /* spatial index returns local index (or owner process) of gridbox bounding its centre */
+  for (size_t idx(0); idx < nglobal; ++idx) {
+    check(nowners.at(idx) == 1, name + "gridbox " + std::to_string(idx) + " has one owner");
+
+    const auto gbxindex = static_cast<unsigned int>(idx);
+    auto coord3 = centre(gfb.get_coord3gbxbounds(gbxindex));
+    auto coord1 = centre(gfb.get_coord1gbxbounds(gbxindex));
+    auto coord2 = centre(gfb.get_coord2gbxbounds(gbxindex));
+    const auto owner = decomposition.get_gridbox_owner_process(idx);
+    const auto local = spatial_index.local_bounding_gridbox_index(coord3, coord1, coord2);
+    if (owner == my_rank) {
+      check(static_cast<int>(local) == decomposition.global_to_local_gridbox_index(idx),
+            name + "spatial index of local gridbox " + std::to_string(idx));
+    } else {
+      check(local == (LIMITVALUES::oob_gbxindex - 1) - owner,
+            name + "spatial index of gridbox of other process " + std::to_string(idx));
+    }
+    check(spatial_index.global_bounding_gridbox_index(coord3, coord1, coord2) == gbxindex,
+          name + "spatial index of global gridbox " + std::to_string(idx));
+  }
+}
+
+int main(int argc, char* argv[]) {
+  const auto config = Config(write_config());
+  init_communicator init_comm(argc, argv, config);
+  Kokkos::initialize(argc, argv);
+  auto status = 0;
+  {
+    try {
+      for (const auto ordering : {"lexicographic", "morton"}) {
+        test_ordering({4, 4, 4}, ordering);
+        test_ordering({5, 3, 7}, ordering);
+        test_ordering({6, 10, 1}, ordering);
+        test_ordering({9, 1, 1}, ordering);
+      }
+      std::cout << "test_gridbox_ordering: PASSED\n";
+    } catch (const std::exception& e) {
+      std::cout << "test_gridbox_ordering: " << e.what() << "\n";
+      status = 1;
+    }
+  }
+  Kokkos::finalize();
+
+  return status;
+}
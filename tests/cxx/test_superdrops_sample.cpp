@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 MPI-M, Clara Bayley
+ *
+ *
+ * ----- CLEO -----
+ * File: test_superdrops_sample.cpp
+ * Project: cxx
+ * Created Date: Sunday 18th October 2026
+ * Author: Clara Bayley (CB)
+ * Additional Contributors:
+ * -----
+ * License: BSD 3-Clause "New" or "Revised" License
+ * https://opensource.org/licenses/BSD-3-Clause
+ * -----
+ * File Description:
+ * test that SampleSuperdrops selects the indexes of the superdroplets which meet the criteria of a
+ * sample (by sdId stride, by fraction of sdIds chosen by hash and by range of radius and
+ * coordinates) and that selection by sdId is independent of the order of the superdroplets.
+ * Exits with non-zero status if a check fails.
+ */
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "kokkosaliases.hpp"
+#include "observers/superdrops_observer.hpp"
+#include "superdrops/superdrop.hpp"
+
+/* throws error with message if check is false */
+void check(const bool is_true, const std::string& message) {
+  if (!is_true) {
+    throw std::runtime_error("FAILED: " + message);
+  }
+}
+
+/* returns superdroplets in device memory with sdId = kk, coord3 = kk and radius = (kk + 1) for
+kk = 0, 1, ..., nsupers - 1 in the order given by the reverse flag */
+viewd_supers create_supers(const size_t nsupers, const bool is_reverse) {
+  auto d_supers = viewd_supers("supers", nsupers);
+  auto h_supers = Kokkos::create_mirror_view(d_supers);
+  for (size_t kk(0); kk < nsupers; ++kk) {
+    const auto id = is_reverse ? nsupers - 1 - kk : kk;
+    const auto attrs = SuperdropAttrs(SoluteProperties{}, 1, id + 1.0, 1.0);
+    h_supers(kk) = Superdrop(0, static_cast<double>(id), 0.0, 0.0, attrs, Superdrop::IDType{id});
+  }
+  Kokkos::deep_copy(d_supers, h_supers);
+  return d_supers;
+}
+
+/* returns indexes selected by sample in host memory */
+std::vector<size_t> sample_indexes(const SampleSuperdrops& sample, const viewd_supers d_supers) {
+  const subviewd_constsupers d_constsupers =
+      Kokkos::subview(d_supers, kkpair_size_t{0, d_supers.extent(0)});
+  const auto d_indexes = sample(d_constsupers);
+  const auto h_indexes = Kokkos::create_mirror_view_and_copy(HostSpace(), d_indexes);
+  return std::vector<size_t>(h_indexes.data(), h_indexes.data() + h_indexes.extent(0));
+}
+
+/* returns (ascending order) indexes of superdroplets meeting criteria found by serial loop */
+std::vector<size_t> expected_indexes(const SuperdropsSampleCriteria& criteria,
+                                     const viewd_supers d_supers) {
+  const auto h_supers = Kokkos::create_mirror_view_and_copy(HostSpace(), d_supers);
+  auto expected = std::vector<size_t>{};
+  for (size_t kk(0); kk < h_supers.extent(0); ++kk) {
+    if (criteria.is_selected(h_supers(kk))) {
+      expected.push_back(kk);
+    }
+  }
+  return expected;
+}
+
+/* returns sorted sdIds of superdroplets at indexes */
+std::vector<size_t> sample_ids(const std::vector<size_t>& indexes, const viewd_supers d_supers) {
+  const auto h_supers = Kokkos::create_mirror_view_and_copy(HostSpace(), d_supers);
+  auto ids = std::vector<size_t>{};
+  for (const auto kk : indexes) {
+    ids.push_back(h_supers(kk).sdId.get_value());
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+void test_id_stride(const viewd_supers d_supers) {
+  auto criteria = SuperdropsSampleCriteria{};
+  criteria.id_stride = 7;
+  const auto indexes = sample_indexes(SampleSuperdrops(criteria), d_supers);
+
+  check(indexes == expected_indexes(criteria, d_supers), "id_stride indexes");
+  check(indexes.size() == (d_supers.extent(0) + 6) / 7, "id_stride sample size");
+  for (const auto id : sample_ids(indexes, d_supers)) {
+    check(id % 7 == 0, "id_stride sdId " + std::to_string(id));
+  }
+}
+
+void test_id_fraction(const viewd_supers d_supers, const viewd_supers d_reversed) {
+  auto criteria = SuperdropsSampleCriteria{};
+  criteria.id_fraction = 0.25;
+  const auto sample = SampleSuperdrops(criteria);
+  const auto indexes = sample_indexes(sample, d_supers);
+
+  check(indexes == expected_indexes(criteria, d_supers), "id_fraction indexes");
+  const auto frac = static_cast<double>(indexes.size()) / d_supers.extent(0);
+  check(frac > 0.2 && frac < 0.3, "id_fraction sample fraction " + std::to_string(frac));
+
+  const auto reversed = sample_indexes(sample, d_reversed);
+  check(sample_ids(indexes, d_supers) == sample_ids(reversed, d_reversed),
+        "id_fraction independent of order of superdroplets");
+
+  criteria.id_fraction = 0.0;
+  check(sample_indexes(SampleSuperdrops(criteria), d_supers).empty(), "id_fraction of zero");
+  criteria.id_fraction = 1.0;
+  check(sample_indexes(SampleSuperdrops(criteria), d_supers).size() == d_supers.extent(0),
+        "id_fraction of one");
+}
+
+void test_ranges(const viewd_supers d_supers) {
+  auto criteria = SuperdropsSampleCriteria{};
+  criteria.radius_range = {100.0, 300.0};  // sdIds 99 <= id < 299
+  criteria.coord3_range = {150.0, 500.0};  // sdIds 150 <= id < 500
+  const auto indexes = sample_indexes(SampleSuperdrops(criteria), d_supers);
+
+  check(indexes == expected_indexes(criteria, d_supers), "range indexes");
+  auto expected_ids = std::vector<size_t>{};
+  for (size_t id(150); id < 299; ++id) {
+    expected_ids.push_back(id);
+  }
+  check(sample_ids(indexes, d_supers) == expected_ids, "range sdIds");
+
+  criteria.id_stride = 3;
+  criteria.id_fraction = 0.5;
+  const auto indexes_combined = sample_indexes(SampleSuperdrops(criteria), d_supers);
+  check(indexes_combined == expected_indexes(criteria, d_supers), "combined criteria indexes");
+}
+
+void test_reuse(const viewd_supers d_supers) {
+  auto criteria = SuperdropsSampleCriteria{};
+  criteria.id_stride = 2;
+  const auto sample = SampleSuperdrops(criteria);
+
+  const auto fewer = Kokkos::subview(d_supers, kkpair_size_t{0, 10});
+  const auto d_fewer = viewd_supers("fewer", 10);
+  Kokkos::deep_copy(d_fewer, fewer);
+
+  check(sample_indexes(sample, d_fewer) == expected_indexes(criteria, d_fewer), "first sample");
+  check(sample_indexes(sample, d_supers) == expected_indexes(criteria, d_supers), "grown sample");
+  check(sample_indexes(sample, d_fewer) == expected_indexes(criteria, d_fewer), "shrunk sample");
+}
+
+void test_invalid_criteria() {
+  auto criteria = SuperdropsSampleCriteria{};
+  criteria.id_stride = 0;
+  auto is_thrown = false;
+  try {
+    SampleSuperdrops{criteria};
+  } catch (const std::invalid_argument&) {
+    is_thrown = true;
+  }
+  check(is_thrown, "id_stride of zero throws");
+}
+
+int main(int argc, char* argv[]) {
+  Kokkos::initialize(argc, argv);
+  auto status = 0;
+  {
+    const auto nsupers = size_t{1000};
+    const auto d_supers = create_supers(nsupers, false);
+    const auto d_reversed = create_supers(nsupers, true);
+
+    try {
+      test_id_stride(d_supers);
+      test_id_fraction(d_supers, d_reversed);
+      test_ranges(d_supers);
+      test_reuse(d_supers);
+      test_invalid_criteria();
+      std::cout << "test_superdrops_sample: PASSED\n";
+    } catch (const std::exception& e) {
+      std::cout << "test_superdrops_sample: " << e.what() << "\n";
+      status = 1;
+    }
+  }
+  Kokkos::finalize();
+
+  return status;
+}